@@ -0,0 +1,99 @@
+/// @file display.hpp
+/// @brief Display (monitor) queries: bounds, content scale and display modes
+/// @date 2026-10-17
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../renderers/renderer_types.hpp"
+#include "../surfaces/pixel_format.hpp"
+#include "../windows/window_flags.hpp"
+#include "display_id.hpp"
+
+namespace laya {
+
+class window;
+
+/// Resolution, format and refresh rate of a display
+struct display_mode {
+    dimensions size{0, 0};                         ///< Size in screen coordinates
+    pixel_format format = pixel_format::unknown;
+    float pixel_density = 1.0f;                    ///< Pixels per screen coordinate
+    float refresh_rate = 0.0f;                     ///< Refresh rate in Hz, 0 if unspecified
+    int refresh_rate_numerator = 0;                ///< Precise refresh rate numerator, 0 if unspecified
+    int refresh_rate_denominator = 0;              ///< Precise refresh rate denominator, 0 if unspecified
+
+    /// Duration of one refresh, or zero if the refresh rate is unspecified
+    [[nodiscard]] std::chrono::nanoseconds frame_duration() const noexcept;
+};
+
+/// A connected display
+/// @note Displays belong to SDL, so this is only an id. Every query asks SDL and throws
+///       laya::error once the display has been disconnected.
+class display {
+public:
+    /// Refer to a display by id
+    explicit constexpr display(display_id id) noexcept;
+
+    /// The primary display
+    /// @throws laya::error if the video subsystem is not initialized
+    [[nodiscard]] static display primary();
+
+    /// Every connected display
+    /// @throws laya::error if the displays cannot be enumerated
+    [[nodiscard]] static std::vector<display> all();
+
+    /// The display containing the center of a window
+    /// @throws laya::error if the display cannot be determined
+    [[nodiscard]] static display of(const window& win);
+
+    /// Get the display ID
+    [[nodiscard]] constexpr display_id id() const noexcept;
+
+    /// Human readable name of the display
+    [[nodiscard]] std::string name() const;
+
+    /// Desktop area covered by the display, in screen coordinates
+    [[nodiscard]] rect bounds() const;
+
+    /// Desktop area usable by windows, excluding taskbars, docks and menu bars
+    [[nodiscard]] rect usable_bounds() const;
+
+    /// Scale the user asked for content on this display (1.0 = 100%)
+    [[nodiscard]] float content_scale() const;
+
+    /// Mode the display is currently using, which differs from the desktop mode in exclusive fullscreen
+    [[nodiscard]] display_mode current_mode() const;
+
+    /// Mode the desktop uses on this display
+    [[nodiscard]] display_mode desktop_mode() const;
+
+    /// Modes available for exclusive fullscreen, best first
+    [[nodiscard]] std::vector<display_mode> fullscreen_modes() const;
+
+    /// Equality comparison
+    [[nodiscard]] constexpr bool operator==(const display& other) const noexcept;
+
+private:
+    display_id m_id;
+};
+
+// ============================================================================
+// display inline implementations
+// ============================================================================
+
+constexpr display::display(display_id id) noexcept : m_id{id} {
+}
+
+constexpr display_id display::id() const noexcept {
+    return m_id;
+}
+
+constexpr bool display::operator==(const display& other) const noexcept {
+    return m_id == other.m_id;
+}
+
+}  // namespace laya
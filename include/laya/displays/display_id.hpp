@@ -0,0 +1,69 @@
+/// @file display_id.hpp
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstdint>
+
+namespace laya {
+
+/// Strong type wrapper for SDL display IDs
+/// @note Provides type safety and prevents accidental integer conversions
+class display_id {
+public:
+    /// Default constructor - invalid ID
+    constexpr display_id() noexcept;
+
+    /// Construct from raw SDL display ID
+    explicit constexpr display_id(std::uint32_t id) noexcept;
+
+    /// Get the underlying ID value
+    [[nodiscard]] constexpr std::uint32_t value() const noexcept;
+
+    /// Check if the ID is valid (non-zero)
+    [[nodiscard]] constexpr bool is_valid() const noexcept;
+
+    /// Equality comparison
+    [[nodiscard]] constexpr bool operator==(const display_id& other) const noexcept;
+
+    /// Inequality comparison
+    [[nodiscard]] constexpr bool operator!=(const display_id& other) const noexcept;
+
+    /// Less-than comparison (for ordered containers)
+    [[nodiscard]] constexpr bool operator<(const display_id& other) const noexcept;
+
+private:
+    std::uint32_t m_id;
+};
+
+// ============================================================================
+// display_id inline implementations
+// ============================================================================
+
+constexpr display_id::display_id() noexcept : m_id{0} {
+}
+
+constexpr display_id::display_id(std::uint32_t id) noexcept : m_id{id} {
+}
+
+constexpr std::uint32_t display_id::value() const noexcept {
+    return m_id;
+}
+
+constexpr bool display_id::is_valid() const noexcept {
+    return m_id != 0u;
+}
+
+constexpr bool display_id::operator==(const display_id& other) const noexcept {
+    return m_id == other.m_id;
+}
+
+constexpr bool display_id::operator!=(const display_id& other) const noexcept {
+    return m_id != other.m_id;
+}
+
+constexpr bool display_id::operator<(const display_id& other) const noexcept {
+    return m_id < other.m_id;
+}
+
+}  // namespace laya
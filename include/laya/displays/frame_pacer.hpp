@@ -0,0 +1,103 @@
+/// @file frame_pacer.hpp
+/// @brief Per-window frame durations that follow the refresh rate of the window's display
+/// @date 2026-10-17
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+#include "../events/event_types.hpp"
+#include "../windows/window_id.hpp"
+#include "display_id.hpp"
+
+namespace laya {
+
+class window;
+
+/// Keeps each window's frame duration matched to the display it is on
+/// @note track() looks up a window's display once. handle() then follows `display_changed`
+///       window events and display mode events, so a window dragged from a 144 Hz monitor to a
+///       60 Hz one is retuned on the next event poll. Refresh rates are cached per display and
+///       only queried again when SDL reports a mode change.
+/// @note SDL does not report variable refresh rate support, so a VRR display is paced at the
+///       maximum rate of its current mode.
+class frame_pacer {
+public:
+    /// @param fallback Frame duration used when a display does not report its refresh rate
+    explicit frame_pacer(std::chrono::nanoseconds fallback = std::chrono::nanoseconds{16'666'667}) noexcept;
+
+    /// Start pacing a window, querying its display once
+    /// @throws laya::error if the window's display cannot be determined
+    void track(const window& win);
+
+    /// Start pacing a window known to be on a display
+    void track(window_id id, display_id display);
+
+    /// Stop pacing a window
+    /// @return True if the window was tracked
+    bool untrack(window_id id) noexcept;
+
+    /// Set a display's refresh rate instead of asking SDL, e.g. for a user setting
+    /// @note The rate is replaced the next time SDL reports a mode change for that display
+    void set_refresh_rate(display_id display, float hz);
+
+    /// Follow window display changes and display mode changes, other events are ignored
+    /// @return True if the frame duration of a tracked window changed
+    bool handle(const event& ev);
+
+    /// Time between frames for a window, or the fallback if it is not tracked
+    [[nodiscard]] std::chrono::nanoseconds frame_duration(window_id id) const noexcept;
+
+    /// Refresh rate for a window in Hz
+    [[nodiscard]] double refresh_rate(window_id id) const noexcept;
+
+    /// Display a window is on, or an invalid id if it is not tracked
+    [[nodiscard]] display_id display_of(window_id id) const noexcept;
+
+    /// Number of tracked windows
+    [[nodiscard]] std::size_t size() const noexcept;
+
+private:
+    struct paced_window {
+        window_id id;
+        display_id display;
+        std::chrono::nanoseconds duration;
+    };
+
+    struct display_rate {
+        display_id display;
+        std::chrono::nanoseconds duration;
+    };
+
+    /// Cached frame duration of a display, queried from SDL on first use
+    [[nodiscard]] std::chrono::nanoseconds duration_of(display_id display);
+
+    /// Add or replace a display's cached frame duration
+    void store_rate(display_id display, std::chrono::nanoseconds duration);
+
+    /// Query SDL for a display's frame duration, falling back when it is unknown
+    [[nodiscard]] std::chrono::nanoseconds query_duration(display_id display) const noexcept;
+
+    /// Re-apply cached rates to every window on a display
+    bool retune(display_id display) noexcept;
+
+    [[nodiscard]] display_rate* find_rate(display_id display) noexcept;
+    [[nodiscard]] paced_window* find(window_id id) noexcept;
+    [[nodiscard]] const paced_window* find(window_id id) const noexcept;
+
+    std::vector<paced_window> m_windows;
+    std::vector<display_rate> m_rates;
+    std::chrono::nanoseconds m_fallback;
+};
+
+// ============================================================================
+// frame_pacer inline implementations
+// ============================================================================
+
+inline std::size_t frame_pacer::size() const noexcept {
+    return m_windows.size();
+}
+
+}  // namespace laya
@@ -4,19 +4,36 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <format>
 #include <source_location>
+#include <utility>
 
 namespace laya {
 
+/// Category of a failure, cheap to compare and switch on
+enum class error_code : std::uint8_t {
+    generic,           ///< Any failure without a more specific category
+    sdl,               ///< An SDL call failed, the message is SDL's
+    invalid_handle,    ///< The object no longer owns an SDL handle (e.g. it was moved from)
+    invalid_argument,  ///< An argument was rejected before reaching SDL
+    unsupported,       ///< The operation is not available in this build
+};
+
 /// Base exception class for all laya errors
+/// @note Construction only stores the message, a prefix literal and the source location. The
+///       "[file:line:function] message" text is built by the first what() call, so errors that are
+///       caught and discarded never pay for it. The message lives in std::runtime_error, so copies
+///       share it and never throw. what() may be called from several threads at once, e.g. on an
+///       exception_ptr rethrown to each of them; a copy formats its own text on first use.
 class error : public std::runtime_error {
 public:
     /// Construct error with simple message
-    explicit error(std::string_view message) : std::runtime_error(std::string(message)) {
+    explicit error(std::string_view message) : std::runtime_error(std::string{message}) {
     }
 
     /// Construct error with formatted message
@@ -27,22 +44,51 @@ public:
 
     /// Construct error with message and source location
     error(std::string_view message, const std::source_location& location = std::source_location::current())
-        : std::runtime_error(format_with_location(message, location)) {
+        : std::runtime_error(std::string{message}), m_location(location), m_has_location(true) {
     }
 
     /// Construct error with formatted message and source location
+    /// @note The arguments are formatted immediately since they may not outlive the error
     template <typename... Args>
     error(const std::source_location& location, std::format_string<Args...> fmt, Args&&... args)
-        : std::runtime_error(format_with_location(std::format(fmt, std::forward<Args>(args)...), location)) {
+        : std::runtime_error(std::format(fmt, std::forward<Args>(args)...)),
+          m_location(location),
+          m_has_location(true) {
     }
 
+    error(const error& other) noexcept;
+    error& operator=(const error& other) noexcept;
+    ~error() override;
+
     /// Create error from SDL error with source location
     static error from_sdl(const std::source_location& location = std::source_location::current());
 
+    /// Full message, formatted on first use
+    [[nodiscard]] const char* what() const noexcept override;
+
+    /// Category of the failure
+    [[nodiscard]] error_code code() const noexcept {
+        return m_code;
+    }
+
+    /// Where the error was raised, only meaningful if it was constructed with a location
+    [[nodiscard]] const std::source_location& location() const noexcept {
+        return m_location;
+    }
+
 private:
-    static std::string format_with_location(std::string_view message, const std::source_location& location) {
-        return std::format("[{}:{}:{}] {}", location.file_name(), location.line(), location.function_name(), message);
+    friend class error_info;
+
+    /// Construct error whose text is "prefix: message", used by from_sdl and error_info
+    error(error_code code, const char* prefix, const char* message, const std::source_location& location)
+        : std::runtime_error(message), m_location(location), m_prefix(prefix), m_code(code), m_has_location(true) {
     }
+
+    std::source_location m_location;
+    const char* m_prefix{nullptr};  ///< String literal put before the message, if any
+    error_code m_code{error_code::generic};
+    bool m_has_location{false};
+    mutable std::atomic<const std::string*> m_what{nullptr};  ///< Published once by the first what() call
 };
 
 }  // namespace laya
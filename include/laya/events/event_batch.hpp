@@ -0,0 +1,299 @@
+/// @file event_batch.hpp
+/// @date 2026-10-17
+/// @brief Structure-of-arrays event storage for bulk processing
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "event_types.hpp"
+
+namespace laya {
+
+/// Column view over batched key events
+struct key_columns {
+    std::span<const std::uint64_t> timestamp;
+    std::span<const std::uint32_t> window;
+    std::span<const std::uint32_t> scancode;
+    std::span<const std::uint32_t> keycode;
+    std::span<const std::uint16_t> mod;
+    std::span<const std::uint8_t> pressed;  ///< 1 for key down, 0 for key up
+    std::span<const std::uint8_t> repeat;   ///< 1 if the event is a key repeat
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return timestamp.size();
+    }
+};
+
+/// Column view over batched mouse motion events
+struct mouse_motion_columns {
+    std::span<const std::uint64_t> timestamp;
+    std::span<const std::uint32_t> window;
+    std::span<const float> x;
+    std::span<const float> y;
+    std::span<const float> xrel;
+    std::span<const float> yrel;
+    std::span<const std::uint32_t> state;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return timestamp.size();
+    }
+};
+
+/// Column view over batched mouse button events
+struct mouse_button_columns {
+    std::span<const std::uint64_t> timestamp;
+    std::span<const std::uint32_t> window;
+    std::span<const float> x;
+    std::span<const float> y;
+    std::span<const std::uint8_t> button;   ///< SDL button index (1 = left, 2 = middle, ...)
+    std::span<const std::uint8_t> pressed;  ///< 1 for button down, 0 for button up
+    std::span<const std::uint8_t> clicks;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return timestamp.size();
+    }
+};
+
+/// Column view over batched mouse wheel events
+struct mouse_wheel_columns {
+    std::span<const std::uint64_t> timestamp;
+    std::span<const std::uint32_t> window;
+    std::span<const float> x;
+    std::span<const float> y;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return timestamp.size();
+    }
+};
+
+/// Column view over batched window events
+struct window_columns {
+    std::span<const std::uint64_t> timestamp;
+    std::span<const std::uint32_t> window;
+    std::span<const window_event_type> type;
+    std::span<const std::int32_t> data1;  ///< x / width / display index, depending on `type`
+    std::span<const std::int32_t> data2;  ///< y / height, depending on `type`
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return timestamp.size();
+    }
+};
+
+/// Polled events stored as per-type columns instead of a vector of variants
+/// @note Only the fields useful for bulk processing are kept. Text, joystick and quit events are
+///       counted but not stored; use event_view when the full event is needed.
+/// @note Appending never shrinks storage, so a batch reused across frames stops allocating once warm
+class event_batch {
+public:
+    event_batch() = default;
+
+    /// Drain the SDL event queue into the batch
+    /// @return Number of SDL events consumed
+    /// @note Appends to the existing contents, call clear() between frames
+    std::size_t poll();
+
+    /// Append raw SDL events in bulk
+    /// @param events Pointer to the first SDL event
+    /// @param count Number of events
+    void append(const SDL_Event* events, std::size_t count);
+
+    /// Append a single converted event
+    /// @param ev The event to append
+    void append(const event& ev);
+
+    /// Remove all events while keeping the allocated storage
+    void clear() noexcept;
+
+    /// Reserve storage for the given number of events in every column
+    void reserve(std::size_t count);
+
+    /// Check if the batch holds no stored events
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Total number of stored events across all columns
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Number of quit events seen
+    [[nodiscard]] std::size_t quit_count() const noexcept;
+
+    /// Number of events that were not stored (unsupported or not batched)
+    [[nodiscard]] std::size_t skipped() const noexcept;
+
+    [[nodiscard]] key_columns keys() const noexcept;
+    [[nodiscard]] mouse_motion_columns mouse_motions() const noexcept;
+    [[nodiscard]] mouse_button_columns mouse_buttons() const noexcept;
+    [[nodiscard]] mouse_wheel_columns mouse_wheels() const noexcept;
+    [[nodiscard]] window_columns windows() const noexcept;
+
+    /// Total distance the mouse travelled across all motion events in the batch
+    [[nodiscard]] float mouse_travel() const noexcept;
+
+private:
+    void append_sdl(const SDL_Event& sdl_event);
+
+    template <class F>
+    void for_each_storage(F&& f);
+
+private:
+    struct key_storage {
+        std::vector<std::uint64_t> timestamp;
+        std::vector<std::uint32_t> window;
+        std::vector<std::uint32_t> scancode;
+        std::vector<std::uint32_t> keycode;
+        std::vector<std::uint16_t> mod;
+        std::vector<std::uint8_t> pressed;
+        std::vector<std::uint8_t> repeat;
+
+        template <class F>
+        void for_each_column(F&& f) {
+            f(timestamp);
+            f(window);
+            f(scancode);
+            f(keycode);
+            f(mod);
+            f(pressed);
+            f(repeat);
+        }
+    };
+
+    struct mouse_motion_storage {
+        std::vector<std::uint64_t> timestamp;
+        std::vector<std::uint32_t> window;
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> xrel;
+        std::vector<float> yrel;
+        std::vector<std::uint32_t> state;
+
+        template <class F>
+        void for_each_column(F&& f) {
+            f(timestamp);
+            f(window);
+            f(x);
+            f(y);
+            f(xrel);
+            f(yrel);
+            f(state);
+        }
+    };
+
+    struct mouse_button_storage {
+        std::vector<std::uint64_t> timestamp;
+        std::vector<std::uint32_t> window;
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<std::uint8_t> button;
+        std::vector<std::uint8_t> pressed;
+        std::vector<std::uint8_t> clicks;
+
+        template <class F>
+        void for_each_column(F&& f) {
+            f(timestamp);
+            f(window);
+            f(x);
+            f(y);
+            f(button);
+            f(pressed);
+            f(clicks);
+        }
+    };
+
+    struct mouse_wheel_storage {
+        std::vector<std::uint64_t> timestamp;
+        std::vector<std::uint32_t> window;
+        std::vector<float> x;
+        std::vector<float> y;
+
+        template <class F>
+        void for_each_column(F&& f) {
+            f(timestamp);
+            f(window);
+            f(x);
+            f(y);
+        }
+    };
+
+    struct window_storage {
+        std::vector<std::uint64_t> timestamp;
+        std::vector<std::uint32_t> window;
+        std::vector<window_event_type> type;
+        std::vector<std::int32_t> data1;
+        std::vector<std::int32_t> data2;
+
+        template <class F>
+        void for_each_column(F&& f) {
+            f(timestamp);
+            f(window);
+            f(type);
+            f(data1);
+            f(data2);
+        }
+    };
+
+    key_storage m_keys;
+    mouse_motion_storage m_motions;
+    mouse_button_storage m_buttons;
+    mouse_wheel_storage m_wheels;
+    window_storage m_windows;
+    std::size_t m_quit_count = 0;
+    std::size_t m_skipped = 0;
+};
+
+// ============================================================================
+// event_batch inline implementations
+// ============================================================================
+
+template <class F>
+void event_batch::for_each_storage(F&& f) {
+    f(m_keys);
+    f(m_motions);
+    f(m_buttons);
+    f(m_wheels);
+    f(m_windows);
+}
+
+inline bool event_batch::empty() const noexcept {
+    return size() == 0;
+}
+
+inline std::size_t event_batch::size() const noexcept {
+    return m_keys.timestamp.size() + m_motions.timestamp.size() + m_buttons.timestamp.size() +
+           m_wheels.timestamp.size() + m_windows.timestamp.size();
+}
+
+inline std::size_t event_batch::quit_count() const noexcept {
+    return m_quit_count;
+}
+
+inline std::size_t event_batch::skipped() const noexcept {
+    return m_skipped;
+}
+
+inline key_columns event_batch::keys() const noexcept {
+    return {m_keys.timestamp, m_keys.window, m_keys.scancode, m_keys.keycode,
+            m_keys.mod,       m_keys.pressed, m_keys.repeat};
+}
+
+inline mouse_motion_columns event_batch::mouse_motions() const noexcept {
+    return {m_motions.timestamp, m_motions.window, m_motions.x,    m_motions.y,
+            m_motions.xrel,      m_motions.yrel,   m_motions.state};
+}
+
+inline mouse_button_columns event_batch::mouse_buttons() const noexcept {
+    return {m_buttons.timestamp, m_buttons.window,  m_buttons.x,     m_buttons.y,
+            m_buttons.button,    m_buttons.pressed, m_buttons.clicks};
+}
+
+inline mouse_wheel_columns event_batch::mouse_wheels() const noexcept {
+    return {m_wheels.timestamp, m_wheels.window, m_wheels.x, m_wheels.y};
+}
+
+inline window_columns event_batch::windows() const noexcept {
+    return {m_windows.timestamp, m_windows.window, m_windows.type, m_windows.data1, m_windows.data2};
+}
+
+}  // namespace laya
@@ -0,0 +1,86 @@
+/// @file event_pen.hpp
+/// @date 2026-10-17
+/// @brief Pen (stylus) events
+
+#pragma once
+
+#include <cstdint>
+
+#include "../windows/window_id.hpp"
+
+namespace laya {
+
+/// Pen axes
+/// Maps to SDL_PenAxis
+enum class pen_axis : std::uint32_t {
+    pressure = 0,             ///< 0 (no pressure) to 1 (full pressure)
+    xtilt = 1,                ///< -90 to 90 degrees, positive is to the right
+    ytilt = 2,                ///< -90 to 90 degrees, positive is toward the user
+    distance = 3,             ///< 0 to 1, distance from the drawing surface
+    rotation = 4,             ///< -180 to 180 degrees, barrel rotation
+    slider = 5,               ///< 0 to 1, finger wheel or slider
+    tangential_pressure = 6,  ///< Barrel pressure
+    count = 7,
+};
+
+/// Pen entered or left proximity of the tablet
+struct pen_proximity_event {
+    enum class state { in, out };
+
+    std::uint64_t timestamp;
+    window_id id;
+    std::uint32_t which;  ///< The pen instance id
+    state proximity;
+};
+
+/// Pen moved (high frequency)
+struct pen_motion_event {
+    std::uint64_t timestamp;
+    window_id id;
+    std::uint32_t which;      ///< The pen instance id
+    std::uint32_t pen_state;  ///< SDL_PenInputFlags
+    float x;                  ///< X coordinate, relative to window
+    float y;                  ///< Y coordinate, relative to window
+};
+
+/// Pen tip or eraser touched or left the surface
+struct pen_touch_event {
+    enum class state { down, up };
+
+    std::uint64_t timestamp;
+    window_id id;
+    std::uint32_t which;      ///< The pen instance id
+    std::uint32_t pen_state;  ///< SDL_PenInputFlags
+    float x;                  ///< X coordinate, relative to window
+    float y;                  ///< Y coordinate, relative to window
+    bool eraser;              ///< True if the eraser end is used
+    state touch_state;
+};
+
+/// Pen barrel button events
+struct pen_button_event {
+    enum class state { pressed, released };
+
+    std::uint64_t timestamp;
+    window_id id;
+    std::uint32_t which;      ///< The pen instance id
+    std::uint32_t pen_state;  ///< SDL_PenInputFlags
+    float x;                  ///< X coordinate, relative to window
+    float y;                  ///< Y coordinate, relative to window
+    std::uint8_t button;      ///< The pen button index (first button is 1)
+    state button_state;
+};
+
+/// Pen axis changed, e.g. pressure or tilt (high frequency)
+struct pen_axis_event {
+    std::uint64_t timestamp;
+    window_id id;
+    std::uint32_t which;      ///< The pen instance id
+    std::uint32_t pen_state;  ///< SDL_PenInputFlags
+    float x;                  ///< X coordinate, relative to window
+    float y;                  ///< Y coordinate, relative to window
+    pen_axis axis;            ///< The axis that changed
+    float value;              ///< The new axis value
+};
+
+}  // namespace laya
@@ -0,0 +1,165 @@
+/// @file event_recording.hpp
+/// @date 2026-10-17
+/// @brief Capture converted events to a binary file and replay them deterministically
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "event_types.hpp"
+
+namespace laya {
+
+/// Timing used by event_player when injecting recorded events
+enum class playback_timing {
+    original,            ///< Preserve the recorded spacing between events
+    as_fast_as_possible  ///< Push every remaining event as soon as `pump()` is called
+};
+
+/// Records converted laya events into a compact binary file
+/// @note Recording hooks into SDL's event watch, so events are captured as they are queued
+///       regardless of how the application later polls them. Events pushed by event_player
+///       are skipped, so a replay is not recorded a second time.
+class event_recorder {
+public:
+    /// Default number of events kept in memory between flushes
+    static constexpr std::size_t default_max_pending = 65'536;
+
+    /// Create a recorder writing to the given file
+    /// @param path Output file path, truncated when the recorder is created
+    /// @param max_pending Events kept in memory until flush(), further events are dropped and counted
+    /// @throws laya::error if the file cannot be opened
+    explicit event_recorder(std::string_view path, std::size_t max_pending = default_max_pending);
+
+    /// Stops recording and writes any pending events
+    ~event_recorder() noexcept;
+
+    event_recorder(const event_recorder&) = delete;
+    event_recorder& operator=(const event_recorder&) = delete;
+    event_recorder(event_recorder&&) = delete;
+    event_recorder& operator=(event_recorder&&) = delete;
+
+    /// Start capturing events from the SDL event queue
+    /// @throws laya::error if the event watch cannot be installed
+    void start();
+
+    /// Stop capturing events and write pending events to disk
+    void stop();
+
+    /// Manually record a single event
+    /// @param ev The event to record
+    /// @note Dropped and counted in dropped() if `max_pending` events are waiting for flush()
+    void record(const event& ev);
+
+    /// Write all pending events to disk
+    /// @throws laya::error if writing fails
+    void flush();
+
+    /// Check if the recorder is currently capturing from SDL
+    [[nodiscard]] bool is_recording() const noexcept;
+
+    /// Get the total number of events recorded so far
+    [[nodiscard]] std::size_t size() const;
+
+    /// Get the number of events dropped because `max_pending` events were waiting for flush()
+    [[nodiscard]] std::size_t dropped() const;
+
+    /// Get the first exception thrown while recording from the event watch, if any
+    /// @note Exceptions cannot propagate out of SDL's event watch, so they are logged and kept here
+    [[nodiscard]] std::exception_ptr watch_error() const;
+
+private:
+    friend struct event_recorder_watch;
+
+    std::string m_path;
+    mutable std::mutex m_mutex;
+    std::vector<event> m_pending;
+    std::size_t m_max_pending;
+    std::size_t m_written;
+    std::size_t m_dropped;
+    std::exception_ptr m_watch_error;
+    bool m_recording;
+};
+
+/// Replays events from a file produced by event_recorder through SDL_PushEvent
+class event_player {
+public:
+    /// Load every event from a recording
+    /// @param path Recording file path
+    /// @throws laya::error if the file cannot be read or is not a valid recording
+    explicit event_player(std::string_view path);
+
+    /// Begin playback from the current position
+    /// @param timing How recorded timestamps map onto playback time
+    void start(playback_timing timing = playback_timing::original);
+
+    /// Push every event that is due into the SDL event queue
+    /// @return Number of events pushed this call
+    /// @note Stops early if the SDL queue is full; the remaining events are pushed on the next call
+    std::size_t pump();
+
+    /// Check if every event has been pushed
+    [[nodiscard]] bool finished() const noexcept;
+
+    /// Return to the first recorded event, playback must be started again
+    void rewind() noexcept;
+
+    /// Get the recorded events
+    [[nodiscard]] std::span<const event> events() const noexcept;
+
+    /// Get the number of recorded events
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Get the index of the next event to be pushed
+    [[nodiscard]] std::size_t position() const noexcept;
+
+private:
+    std::vector<event> m_events;
+    std::size_t m_position;
+    std::uint64_t m_start_ns;
+    std::uint64_t m_first_ns;
+    playback_timing m_timing;
+    bool m_started;
+};
+
+// ============================================================================
+// event_recorder inline implementations
+// ============================================================================
+
+inline bool event_recorder::is_recording() const noexcept {
+    return m_recording;
+}
+
+// ============================================================================
+// event_player inline implementations
+// ============================================================================
+
+inline bool event_player::finished() const noexcept {
+    return m_position >= m_events.size();
+}
+
+inline void event_player::rewind() noexcept {
+    m_position = 0;
+    m_started = false;
+}
+
+inline std::span<const event> event_player::events() const noexcept {
+    return m_events;
+}
+
+inline std::size_t event_player::size() const noexcept {
+    return m_events.size();
+}
+
+inline std::size_t event_player::position() const noexcept {
+    return m_position;
+}
+
+}  // namespace laya
@@ -0,0 +1,42 @@
+/// @file event_sensor.hpp
+/// @date 2026-10-17
+/// @brief Sensor events (accelerometer, gyroscope) from standalone sensors and gamepads
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace laya {
+
+/// Sensor types
+/// Maps to SDL_SensorType
+enum class sensor_type : std::int32_t {
+    invalid = -1,
+    unknown = 0,
+    accel = 1,    ///< Accelerometer, m/s² in data[0..2]
+    gyro = 2,     ///< Gyroscope, rad/s in data[0..2]
+    accel_l = 3,  ///< Accelerometer for the left Joy-Con controller
+    gyro_l = 4,   ///< Gyroscope for the left Joy-Con controller
+    accel_r = 5,  ///< Accelerometer for the right Joy-Con controller
+    gyro_r = 6,   ///< Gyroscope for the right Joy-Con controller
+};
+
+/// Standalone sensor update events
+struct sensor_event {
+    std::uint64_t timestamp;
+    std::uint32_t which;             ///< The sensor instance id
+    std::array<float, 6> data;       ///< Up to 6 values, meaning depends on the sensor type
+    std::uint64_t sensor_timestamp;  ///< Hardware timestamp in nanoseconds, or 0 if unavailable
+};
+
+/// Gamepad sensor update events
+struct gamepad_sensor_event {
+    std::uint64_t timestamp;
+    std::uint32_t which;             ///< The joystick instance id
+    sensor_type sensor;              ///< The gamepad sensor that was updated
+    std::array<float, 3> data;       ///< Up to 3 values from the sensor
+    std::uint64_t sensor_timestamp;  ///< Hardware timestamp in nanoseconds, or 0 if unavailable
+};
+
+}  // namespace laya
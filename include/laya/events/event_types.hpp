@@ -9,7 +9,11 @@
 #include <cstdint>
 
 #include "../windows/window_id.hpp"
+#include "../displays/display_id.hpp"
+#include "../input/gamepad_types.hpp"
 #include "event_window.hpp"
+#include "event_sensor.hpp"
+#include "event_pen.hpp"
 
 // Forward declarations for SDL types
 struct SDL_KeyboardEvent;
@@ -24,7 +28,7 @@ namespace laya {
 
 /// Application quit event
 struct quit_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
 };
 
 // window_event is now defined in event_window.hpp
@@ -33,7 +37,7 @@ struct quit_event {
 struct key_event {
     enum class state { pressed, released };
 
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     window_id id;
     state key_state;
     std::uint32_t scancode;  ///< SDL scancode
@@ -42,16 +46,22 @@ struct key_event {
     bool repeat;             ///< Non-zero if this is a key repeat
 };
 
+/// Keyboard layout or keymap changed
+/// @note Converting this event resets the cached keycode to scancode table (see invalidate_keycode_cache)
+struct keymap_changed_event {
+    std::uint64_t timestamp;
+};
+
 /// Text input events
 struct text_input_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     window_id id;
     char text[32];  ///< The input text in UTF-8 encoding
 };
 
 /// Text editing events (IME)
 struct text_editing_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     window_id id;
     char text[32];        ///< The editing text in UTF-8 encoding
     std::int32_t start;   ///< The start cursor of selected editing text
@@ -60,7 +70,7 @@ struct text_editing_event {
 
 /// Mouse motion events
 struct mouse_motion_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     window_id id;
     std::uint32_t which;  ///< The mouse instance id
     std::uint32_t state;  ///< The current button state
@@ -68,6 +78,10 @@ struct mouse_motion_event {
     std::int32_t y;       ///< Y coordinate, relative to window
     std::int32_t xrel;    ///< The relative motion in the X direction
     std::int32_t yrel;    ///< The relative motion in the Y direction
+    float precise_x;      ///< X coordinate, relative to window, with float precision
+    float precise_y;      ///< Y coordinate, relative to window, with float precision
+    float precise_xrel;   ///< The relative motion in the X direction, with float precision
+    float precise_yrel;   ///< The relative motion in the Y direction, with float precision
 };
 
 /// Mouse button events
@@ -75,7 +89,7 @@ struct mouse_button_event {
     enum class state { pressed, released };
     enum class button : std::uint8_t { left = 1, middle = 2, right = 3, x1 = 4, x2 = 5 };
 
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     window_id id;
     std::uint32_t which;  ///< The mouse instance id
     button mouse_button;  ///< The mouse button index
@@ -83,11 +97,13 @@ struct mouse_button_event {
     std::uint8_t clicks;  ///< 1 for single-click, 2 for double-click, etc.
     std::int32_t x;       ///< X coordinate, relative to window
     std::int32_t y;       ///< Y coordinate, relative to window
+    float precise_x;      ///< X coordinate, relative to window, with float precision
+    float precise_y;      ///< Y coordinate, relative to window, with float precision
 };
 
 /// Mouse wheel events
 struct mouse_wheel_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     window_id id;
     std::uint32_t which;  ///< The mouse instance id
     std::int32_t x;       ///< The amount scrolled horizontally, positive to the right and negative to the left
@@ -102,7 +118,7 @@ struct mouse_wheel_event {
 
 /// Joystick axis motion events
 struct joystick_axis_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     std::uint32_t which;  ///< The joystick instance id
     std::uint8_t axis;    ///< The joystick axis index
     std::int16_t value;   ///< The axis value (range: -32768 to 32767)
@@ -112,7 +128,7 @@ struct joystick_axis_event {
 struct joystick_button_event {
     enum class state { pressed, released };
 
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     std::uint32_t which;  ///< The joystick instance id
     std::uint8_t button;  ///< The joystick button index
     state button_state;   ///< Pressed or released
@@ -120,20 +136,75 @@ struct joystick_button_event {
 
 /// Joystick hat position change events
 struct joystick_hat_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     std::uint32_t which;  ///< The joystick instance id
     std::uint8_t hat;     ///< The joystick hat index
     std::uint8_t value;   ///< The hat position value
 };
 
+/// Gamepad axis motion events
+struct gamepad_axis_event {
+    std::uint64_t timestamp;
+    std::uint32_t which;  ///< The joystick instance id
+    gamepad_axis axis;    ///< The gamepad axis
+    std::int16_t value;   ///< The axis value (range: -32768 to 32767, triggers 0 to 32767)
+};
+
+/// Gamepad button events
+struct gamepad_button_event {
+    enum class state { pressed, released };
+
+    std::uint64_t timestamp;
+    std::uint32_t which;    ///< The joystick instance id
+    gamepad_button button;  ///< The gamepad button
+    state button_state;     ///< Pressed or released
+};
+
+/// Gamepad device events
+struct gamepad_device_event {
+    enum class type { added, removed, remapped };
+
+    std::uint64_t timestamp;
+    std::uint32_t which;  ///< The joystick instance id
+    type device_event;    ///< What happened to the device
+};
+
+/// Display events (connected, disconnected, mode or scale changes)
+struct display_event {
+    enum class type {
+        orientation_changed,    ///< data is the new SDL_DisplayOrientation
+        added,                  ///< A display was connected
+        removed,                ///< A display was disconnected
+        moved,                  ///< The display moved in the desktop layout
+        desktop_mode_changed,   ///< The desktop mode changed
+        current_mode_changed,   ///< The current mode (resolution, refresh rate) changed
+        content_scale_changed,  ///< The content scale changed
+    };
+
+    std::uint64_t timestamp;
+    display_id id;        ///< The display the event is about
+    type display_change;  ///< What happened to the display
+    std::int32_t data;    ///< Event dependent data
+};
+
 /// Main event variant containing all possible event types
+/// @note Every event's `timestamp` is in nanoseconds since SDL initialization, as reported by SDL
 using event =
     std::variant<quit_event, window_event, key_event, text_input_event, text_editing_event, mouse_motion_event,
-                 mouse_button_event, mouse_wheel_event, joystick_axis_event, joystick_button_event, joystick_hat_event>;
+                 mouse_button_event, mouse_wheel_event, joystick_axis_event, joystick_button_event, joystick_hat_event,
+                 gamepad_axis_event, gamepad_button_event, gamepad_device_event, gamepad_sensor_event, sensor_event,
+                 pen_proximity_event, pen_motion_event, pen_touch_event, pen_button_event, pen_axis_event, keymap_changed_event,
+                 display_event>;
 
 /// Convert SDL_Event to laya event
 /// @param sdl_event The SDL event to convert
 /// @return The converted laya event
 event from_sdl_event(const SDL_Event& sdl_event);
 
+/// Convert laya event back to SDL_Event (e.g. for SDL_PushEvent)
+/// @param ev The laya event to convert
+/// @param sdl_event Output SDL event, fully overwritten
+/// @note Text events point into `ev.text`, so `ev` must outlive any use of `sdl_event`
+void to_sdl_event(const event& ev, SDL_Event& sdl_event);
+
 }  // namespace laya
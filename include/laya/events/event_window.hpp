@@ -72,7 +72,7 @@ enum class window_event_type {
 
 /// Window events (resize, move, close, etc.)
 struct window_event {
-    std::uint32_t timestamp;
+    std::uint64_t timestamp;
     window_id id;
     window_event_type event_type;
     window_event_data data;
@@ -0,0 +1,229 @@
+/// @file sample_accumulator.hpp
+/// @date 2026-10-17
+/// @brief Per-device ring buffers for high-frequency sensor and pen samples
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "event_types.hpp"
+
+namespace laya {
+
+/// Samples of one device in arrival order
+/// @note A ring that wrapped around is exposed as two spans, `first` holds the oldest samples
+template <class T>
+struct sample_view {
+    std::span<const T> first;
+    std::span<const T> second;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return first.size() + second.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] const T& operator[](std::size_t index) const noexcept {
+        return index < first.size() ? first[index] : second[index - first.size()];
+    }
+
+    /// Most recent sample, the view must not be empty
+    [[nodiscard]] const T& back() const noexcept {
+        return second.empty() ? first.back() : second.back();
+    }
+};
+
+/// Fixed-capacity ring buffer that overwrites the oldest sample when full
+template <class T>
+class sample_ring {
+public:
+    explicit sample_ring(std::size_t capacity);
+
+    /// Append a sample, overwriting the oldest one if the ring is full
+    void push(const T& sample) noexcept;
+
+    /// Remove all samples and reset the dropped counter
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+    /// Number of samples overwritten since the last clear()
+    [[nodiscard]] std::size_t dropped() const noexcept;
+
+    /// View the samples from oldest to newest
+    [[nodiscard]] sample_view<T> view() const noexcept;
+
+private:
+    std::vector<T> m_samples;
+    std::size_t m_head;  ///< Index of the oldest sample
+    std::size_t m_size;
+    std::size_t m_dropped;
+};
+
+/// Collects high-frequency samples between frames so they stay out of the main event stream
+/// @note Call collect() once per frame before polling events. It removes standalone sensor,
+///       gamepad sensor, pen motion and pen axis events from the SDL queue and stores them in
+///       per-device rings. Discrete pen events (proximity, touch, buttons) stay in the queue.
+/// @note Sensors only report once opened through SDL (SDL_OpenSensor / SDL_SetGamepadSensorEnabled)
+class sample_accumulator {
+public:
+    /// @param capacity_per_device Samples kept per device and sample type, older ones are dropped
+    explicit sample_accumulator(std::size_t capacity_per_device = 512);
+
+    /// Drop the previous frame's samples and drain new ones from the SDL queue
+    /// @return Number of samples collected
+    std::size_t collect();
+
+    /// Append a single sample, e.g. from a replayed or synthetic event
+    /// @return True if the event is a sample type handled by the accumulator
+    bool add(const event& ev);
+
+    /// Remove all samples, known devices and their storage are kept
+    void clear() noexcept;
+
+    /// Instance ids of every device that has produced samples of type T
+    /// @note Devices are never forgotten, check samples() for the current frame's data
+    /// @tparam T One of sensor_event, gamepad_sensor_event, pen_motion_event, pen_axis_event
+    template <class T>
+    [[nodiscard]] std::span<const std::uint32_t> devices() const noexcept;
+
+    /// Samples of type T produced by a device, empty if the device is unknown
+    /// @tparam T One of sensor_event, gamepad_sensor_event, pen_motion_event, pen_axis_event
+    template <class T>
+    [[nodiscard]] sample_view<T> samples(std::uint32_t which) const noexcept;
+
+    /// Total number of samples overwritten because a device ring was full
+    [[nodiscard]] std::size_t dropped() const noexcept;
+
+private:
+    template <class T>
+    struct device_rings {
+        std::vector<std::uint32_t> ids;
+        std::vector<sample_ring<T>> rings;
+
+        sample_ring<T>& find_or_add(std::uint32_t which, std::size_t capacity);
+        [[nodiscard]] const sample_ring<T>* find(std::uint32_t which) const noexcept;
+    };
+
+    template <class T>
+    [[nodiscard]] const device_rings<T>& storage() const noexcept;
+
+    std::size_t m_capacity;
+    device_rings<sensor_event> m_sensors;
+    device_rings<gamepad_sensor_event> m_gamepad_sensors;
+    device_rings<pen_motion_event> m_pen_motion;
+    device_rings<pen_axis_event> m_pen_axis;
+};
+
+// ============================================================================
+// sample_ring inline implementations
+// ============================================================================
+
+template <class T>
+sample_ring<T>::sample_ring(std::size_t capacity)
+    : m_samples(capacity == 0 ? 1 : capacity), m_head{0}, m_size{0}, m_dropped{0} {
+}
+
+template <class T>
+void sample_ring<T>::push(const T& sample) noexcept {
+    const std::size_t cap = m_samples.size();
+    if (m_size < cap) {
+        m_samples[(m_head + m_size) % cap] = sample;
+        ++m_size;
+    } else {
+        m_samples[m_head] = sample;
+        m_head = (m_head + 1) % cap;
+        ++m_dropped;
+    }
+}
+
+template <class T>
+void sample_ring<T>::clear() noexcept {
+    m_head = 0;
+    m_size = 0;
+    m_dropped = 0;
+}
+
+template <class T>
+std::size_t sample_ring<T>::size() const noexcept {
+    return m_size;
+}
+
+template <class T>
+std::size_t sample_ring<T>::capacity() const noexcept {
+    return m_samples.size();
+}
+
+template <class T>
+std::size_t sample_ring<T>::dropped() const noexcept {
+    return m_dropped;
+}
+
+template <class T>
+sample_view<T> sample_ring<T>::view() const noexcept {
+    const std::span<const T> all{m_samples};
+    const std::size_t cap = m_samples.size();
+    if (m_head + m_size <= cap) {
+        return {all.subspan(m_head, m_size), {}};
+    }
+    return {all.subspan(m_head), all.first(m_head + m_size - cap)};
+}
+
+// ============================================================================
+// sample_accumulator inline implementations
+// ============================================================================
+
+template <class T>
+sample_ring<T>& sample_accumulator::device_rings<T>::find_or_add(std::uint32_t which, std::size_t capacity) {
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (ids[i] == which) {
+            return rings[i];
+        }
+    }
+    ids.push_back(which);
+    return rings.emplace_back(capacity);
+}
+
+template <class T>
+const sample_ring<T>* sample_accumulator::device_rings<T>::find(std::uint32_t which) const noexcept {
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        if (ids[i] == which) {
+            return &rings[i];
+        }
+    }
+    return nullptr;
+}
+
+template <class T>
+const sample_accumulator::device_rings<T>& sample_accumulator::storage() const noexcept {
+    if constexpr (std::is_same_v<T, sensor_event>) {
+        return m_sensors;
+    } else if constexpr (std::is_same_v<T, gamepad_sensor_event>) {
+        return m_gamepad_sensors;
+    } else if constexpr (std::is_same_v<T, pen_motion_event>) {
+        return m_pen_motion;
+    } else {
+        static_assert(std::is_same_v<T, pen_axis_event>, "sample_accumulator does not collect this event type");
+        return m_pen_axis;
+    }
+}
+
+template <class T>
+std::span<const std::uint32_t> sample_accumulator::devices() const noexcept {
+    return storage<T>().ids;
+}
+
+template <class T>
+sample_view<T> sample_accumulator::samples(std::uint32_t which) const noexcept {
+    const auto* ring = storage<T>().find(which);
+    return ring ? ring->view() : sample_view<T>{};
+}
+
+}  // namespace laya
@@ -0,0 +1,390 @@
+/// @file action_map.hpp
+/// @brief Keyboard, mouse and gamepad bindings evaluated into a bitset of game actions
+/// @date 2026-10-17
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "../errors.hpp"
+#include "gamepad_types.hpp"
+#include "keyboard.hpp"
+#include "keyboard_snapshot.hpp"
+#include "mouse.hpp"
+
+namespace laya {
+
+/// Maximum number of distinct actions, one bit each in an action_set
+inline constexpr std::size_t max_actions = 64;
+
+/// Action identifier, an integer or an enum with values below max_actions
+template <class T>
+concept action_id = std::is_integral_v<T> || std::is_enum_v<T>;
+
+/// Set of active actions
+class action_set {
+public:
+    constexpr action_set() noexcept = default;
+    constexpr explicit action_set(std::uint64_t bits) noexcept;
+
+    /// Check if an action is in the set
+    template <action_id Action>
+    [[nodiscard]] constexpr bool test(Action action) const noexcept;
+
+    /// Add an action to the set
+    template <action_id Action>
+    constexpr void set(Action action) noexcept;
+
+    [[nodiscard]] constexpr bool any() const noexcept;
+    [[nodiscard]] constexpr bool none() const noexcept;
+    [[nodiscard]] constexpr std::size_t count() const noexcept;
+
+    /// Actions in this set that are not in `previous`, e.g. actions that started this frame
+    [[nodiscard]] constexpr action_set started_since(action_set previous) const noexcept;
+
+    /// Actions in `previous` that are not in this set, e.g. actions that ended this frame
+    [[nodiscard]] constexpr action_set ended_since(action_set previous) const noexcept;
+
+    [[nodiscard]] constexpr std::uint64_t bits() const noexcept;
+
+    [[nodiscard]] constexpr bool operator==(const action_set&) const noexcept = default;
+
+private:
+    std::uint64_t m_bits = 0;
+};
+
+/// Device a binding reads from
+enum class binding_source : std::uint8_t { key, mouse, gamepad };
+
+/// One input bound to one action
+/// @note Bindings are stored as a flat input index so that keyboard, mouse and gamepad inputs are
+///       tested by the same code path: scancodes occupy 0-511, mouse buttons 512-543, gamepad
+///       buttons 544-575. Create them with bind_key(), bind_mouse() and bind_gamepad().
+struct action_binding {
+    static constexpr std::uint16_t mouse_base = 512;
+    static constexpr std::uint16_t gamepad_base = 544;
+    static constexpr std::uint16_t input_count = 576;
+
+    std::uint16_t input;      ///< Flat input index
+    std::uint16_t modifiers;  ///< Required key_modifier bits, keyboard bindings only
+    std::uint8_t action;      ///< Action index, below max_actions
+
+    [[nodiscard]] constexpr binding_source source() const noexcept;
+
+    [[nodiscard]] constexpr bool operator==(const action_binding&) const noexcept = default;
+};
+
+/// Bind a key, optionally requiring modifiers
+/// @param mods Modifiers that must be held. A combined flag such as key_modifier::ctrl accepts
+///        either side. Modifiers not listed are ignored, so a binding without modifiers also
+///        fires while shift is held.
+/// @throws laya::error if the action index is not below max_actions (a compile error in constexpr)
+template <action_id Action>
+[[nodiscard]] constexpr action_binding bind_key(Action action, scancode key, key_modifier mods = key_modifier::none);
+
+/// Bind a mouse button
+/// @throws laya::error if the action index is not below max_actions (a compile error in constexpr)
+template <action_id Action>
+[[nodiscard]] constexpr action_binding bind_mouse(Action action, mouse_button button);
+
+/// Bind a gamepad button
+/// @throws laya::error if the action index is not below max_actions (a compile error in constexpr)
+template <action_id Action>
+[[nodiscard]] constexpr action_binding bind_gamepad(Action action, gamepad_button button);
+
+/// Device state bindings are evaluated against, captured once per frame
+struct action_inputs {
+    scancode_set keys{};                                ///< e.g. keyboard_snapshot::held_keys()
+    key_modifier modifiers = key_modifier::none;        ///< e.g. get_key_modifiers()
+    mouse_button_mask mouse = mouse_button_mask::none;  ///< e.g. get_mouse_state()
+    std::uint32_t gamepad_buttons = 0;                  ///< gamepad_state::buttons, OR several pads to merge them
+
+    /// Capture keyboard state from a snapshot
+    [[nodiscard]] static action_inputs from(const keyboard_snapshot& keyboard, key_modifier modifiers,
+                                            mouse_button_mask mouse = mouse_button_mask::none,
+                                            std::uint32_t gamepad_buttons = 0) noexcept;
+};
+
+/// Evaluate a binding table in a single pass
+/// @return Every action with at least one binding whose input is held and whose modifiers match
+[[nodiscard]] constexpr action_set evaluate_bindings(std::span<const action_binding> bindings,
+                                                     const action_inputs& inputs) noexcept;
+
+/// Binding table fixed at compile time
+/// @note Build with make_action_map(), which sorts the bindings by input so evaluation walks the
+///       input bits in order. Convert to action_map for a rebindable copy with the same layout.
+template <std::size_t N>
+class static_action_map {
+public:
+    constexpr explicit static_action_map(const std::array<action_binding, N>& bindings) noexcept;
+
+    [[nodiscard]] constexpr action_set evaluate(const action_inputs& inputs) const noexcept;
+
+    [[nodiscard]] constexpr std::span<const action_binding, N> bindings() const noexcept;
+
+private:
+    std::array<action_binding, N> m_bindings;
+};
+
+/// Build a static_action_map from bindings
+/// @code
+/// enum class action : std::uint8_t { jump, fire };
+/// constexpr auto controls = laya::make_action_map(
+///     laya::bind_key(action::jump, laya::scancode::space),
+///     laya::bind_gamepad(action::jump, laya::gamepad_button::south),
+///     laya::bind_mouse(action::fire, laya::mouse_button::left));
+/// @endcode
+template <std::same_as<action_binding>... Bindings>
+[[nodiscard]] constexpr static_action_map<sizeof...(Bindings)> make_action_map(const Bindings&... bindings) noexcept;
+
+/// Rebindable binding table with the same flat, sorted layout as static_action_map
+class action_map {
+public:
+    action_map() = default;
+
+    /// Start from a compile-time default layout
+    template <std::size_t N>
+    explicit action_map(const static_action_map<N>& defaults);
+
+    /// Add a binding, duplicates are ignored
+    void bind(const action_binding& binding);
+
+    /// Remove a single binding
+    /// @return True if the binding existed
+    bool unbind(const action_binding& binding) noexcept;
+
+    /// Remove every binding of an action
+    /// @return Number of bindings removed
+    template <action_id Action>
+    std::size_t unbind_action(Action action) noexcept;
+
+    /// Replace every binding of an action with a single new one
+    void rebind(const action_binding& binding);
+
+    void clear() noexcept;
+
+    [[nodiscard]] action_set evaluate(const action_inputs& inputs) const noexcept;
+
+    [[nodiscard]] std::span<const action_binding> bindings() const noexcept;
+
+private:
+    std::size_t unbind_index(std::uint8_t action) noexcept;
+
+    std::vector<action_binding> m_bindings;  ///< Sorted by input, then modifiers, then action
+};
+
+// ============================================================================
+// Binding helpers
+// ============================================================================
+
+namespace detail {
+
+template <action_id Action>
+constexpr std::size_t action_index(Action action) noexcept {
+    if constexpr (std::is_enum_v<Action>) {
+        return static_cast<std::size_t>(static_cast<std::underlying_type_t<Action>>(action));
+    } else {
+        return static_cast<std::size_t>(action);
+    }
+}
+
+constexpr bool binding_less(const action_binding& lhs, const action_binding& rhs) noexcept {
+    if (lhs.input != rhs.input) {
+        return lhs.input < rhs.input;
+    }
+    if (lhs.modifiers != rhs.modifiers) {
+        return lhs.modifiers < rhs.modifiers;
+    }
+    return lhs.action < rhs.action;
+}
+
+template <action_id Action>
+constexpr action_binding make_binding(Action action, std::uint16_t input, std::uint16_t modifiers) {
+    const std::size_t index = action_index(action);
+    if (index >= max_actions) {
+        throw error("action index {} exceeds max_actions ({})", index, max_actions);
+    }
+    return action_binding{input, modifiers, static_cast<std::uint8_t>(index)};
+}
+
+/// Check required modifiers against the held ones
+/// @note Each side-pair (shift, ctrl, alt, gui) is satisfied by any required side being held;
+///       lock modifiers must all be on
+constexpr bool modifiers_match(std::uint16_t required, std::uint16_t held) noexcept {
+    constexpr std::array<std::uint16_t, 4> pairs{
+        static_cast<std::uint16_t>(key_modifier::shift), static_cast<std::uint16_t>(key_modifier::ctrl),
+        static_cast<std::uint16_t>(key_modifier::alt), static_cast<std::uint16_t>(key_modifier::gui)};
+
+    std::uint16_t paired = 0;
+    for (const auto pair : pairs) {
+        const std::uint16_t need = required & pair;
+        if (need != 0 && (held & need) == 0) {
+            return false;
+        }
+        paired |= pair;
+    }
+
+    const std::uint16_t locks = required & static_cast<std::uint16_t>(~paired);
+    return (held & locks) == locks;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// action_set inline implementations
+// ============================================================================
+
+constexpr action_set::action_set(std::uint64_t bits) noexcept : m_bits{bits} {
+}
+
+template <action_id Action>
+constexpr bool action_set::test(Action action) const noexcept {
+    const std::size_t index = detail::action_index(action);
+    return index < max_actions && ((m_bits >> index) & 1u) != 0;
+}
+
+template <action_id Action>
+constexpr void action_set::set(Action action) noexcept {
+    const std::size_t index = detail::action_index(action);
+    if (index < max_actions) {
+        m_bits |= std::uint64_t{1} << index;
+    }
+}
+
+constexpr bool action_set::any() const noexcept {
+    return m_bits != 0;
+}
+
+constexpr bool action_set::none() const noexcept {
+    return m_bits == 0;
+}
+
+constexpr std::size_t action_set::count() const noexcept {
+    return static_cast<std::size_t>(std::popcount(m_bits));
+}
+
+constexpr action_set action_set::started_since(action_set previous) const noexcept {
+    return action_set{m_bits & ~previous.m_bits};
+}
+
+constexpr action_set action_set::ended_since(action_set previous) const noexcept {
+    return action_set{previous.m_bits & ~m_bits};
+}
+
+constexpr std::uint64_t action_set::bits() const noexcept {
+    return m_bits;
+}
+
+// ============================================================================
+// action_binding inline implementations
+// ============================================================================
+
+constexpr binding_source action_binding::source() const noexcept {
+    if (input < mouse_base) {
+        return binding_source::key;
+    }
+    return input < gamepad_base ? binding_source::mouse : binding_source::gamepad;
+}
+
+template <action_id Action>
+constexpr action_binding bind_key(Action action, scancode key, key_modifier mods) {
+    const auto index = static_cast<std::size_t>(key);
+    if (index >= action_binding::mouse_base) {
+        throw error("scancode {} is outside the bindable range", index);
+    }
+    return detail::make_binding(action, static_cast<std::uint16_t>(index), static_cast<std::uint16_t>(mods));
+}
+
+template <action_id Action>
+constexpr action_binding bind_mouse(Action action, mouse_button button) {
+    // mouse_button_mask bit i belongs to mouse_button i + 1
+    const auto bit = static_cast<std::uint16_t>(static_cast<std::uint8_t>(button) - 1);
+    return detail::make_binding(action, static_cast<std::uint16_t>(action_binding::mouse_base + bit), 0);
+}
+
+template <action_id Action>
+constexpr action_binding bind_gamepad(Action action, gamepad_button button) {
+    const auto bit = static_cast<std::uint16_t>(button);
+    return detail::make_binding(action, static_cast<std::uint16_t>(action_binding::gamepad_base + bit), 0);
+}
+
+// ============================================================================
+// evaluate_bindings inline implementation
+// ============================================================================
+
+constexpr action_set evaluate_bindings(std::span<const action_binding> bindings, const action_inputs& inputs) noexcept {
+    // Lay every input out as one bit array so each binding is a single shift and mask
+    std::array<std::uint64_t, action_binding::input_count / 64> held{};
+    const auto& key_words = inputs.keys.bits();
+    std::copy(key_words.begin(), key_words.end(), held.begin());
+    held[action_binding::mouse_base / 64] = static_cast<std::uint64_t>(static_cast<std::uint32_t>(inputs.mouse)) |
+                                            (static_cast<std::uint64_t>(inputs.gamepad_buttons) << 32);
+
+    const auto modifiers = static_cast<std::uint16_t>(inputs.modifiers);
+
+    std::uint64_t active = 0;
+    for (const auto& binding : bindings) {
+        const std::uint64_t down = (held[binding.input / 64] >> (binding.input % 64)) & 1u;
+        const std::uint64_t mods_ok =
+            binding.modifiers == 0 || detail::modifiers_match(binding.modifiers, modifiers) ? 1u : 0u;
+        active |= (down & mods_ok) << binding.action;
+    }
+    return action_set{active};
+}
+
+// ============================================================================
+// static_action_map inline implementations
+// ============================================================================
+
+template <std::size_t N>
+constexpr static_action_map<N>::static_action_map(const std::array<action_binding, N>& bindings) noexcept
+    : m_bindings{bindings} {
+    std::sort(m_bindings.begin(), m_bindings.end(), detail::binding_less);
+}
+
+template <std::size_t N>
+constexpr action_set static_action_map<N>::evaluate(const action_inputs& inputs) const noexcept {
+    return evaluate_bindings(m_bindings, inputs);
+}
+
+template <std::size_t N>
+constexpr std::span<const action_binding, N> static_action_map<N>::bindings() const noexcept {
+    return m_bindings;
+}
+
+template <std::same_as<action_binding>... Bindings>
+constexpr static_action_map<sizeof...(Bindings)> make_action_map(const Bindings&... bindings) noexcept {
+    return static_action_map<sizeof...(Bindings)>{std::array<action_binding, sizeof...(Bindings)>{bindings...}};
+}
+
+// ============================================================================
+// action_map inline implementations
+// ============================================================================
+
+template <std::size_t N>
+action_map::action_map(const static_action_map<N>& defaults)
+    : m_bindings(defaults.bindings().begin(), defaults.bindings().end()) {
+}
+
+template <action_id Action>
+std::size_t action_map::unbind_action(Action action) noexcept {
+    const std::size_t index = detail::action_index(action);
+    return index < max_actions ? unbind_index(static_cast<std::uint8_t>(index)) : 0;
+}
+
+inline action_set action_map::evaluate(const action_inputs& inputs) const noexcept {
+    return evaluate_bindings(m_bindings, inputs);
+}
+
+inline std::span<const action_binding> action_map::bindings() const noexcept {
+    return m_bindings;
+}
+
+}  // namespace laya
@@ -0,0 +1,125 @@
+/// @file gamepad.hpp
+/// @brief RAII gamepad handles and batched gamepad state snapshots
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "gamepad_types.hpp"
+
+struct SDL_Gamepad;
+
+namespace laya {
+
+/// Get the instance ids of every connected gamepad
+/// @return Joystick instance ids of the devices SDL recognizes as gamepads
+/// @note Requires subsystem::gamepad
+[[nodiscard]] std::vector<std::uint32_t> gamepad_ids();
+
+/// Check if a joystick instance is recognized as a gamepad
+[[nodiscard]] bool is_gamepad(std::uint32_t instance_id);
+
+/// RAII wrapper for an opened SDL gamepad
+class gamepad {
+public:
+    /// Open a gamepad by instance id
+    /// @param instance_id Instance id from gamepad_ids() or a gamepad_device_event
+    /// @throws laya::error if the gamepad cannot be opened
+    explicit gamepad(std::uint32_t instance_id);
+
+    ~gamepad() noexcept;
+
+    gamepad(const gamepad&) = delete;
+    gamepad& operator=(const gamepad&) = delete;
+    gamepad(gamepad&& other) noexcept;
+    gamepad& operator=(gamepad&& other) noexcept;
+
+    /// Get the instance id of the gamepad
+    [[nodiscard]] std::uint32_t id() const noexcept;
+
+    /// Get the implementation dependent name of the gamepad
+    [[nodiscard]] std::string_view name() const;
+
+    /// Check if the gamepad is still connected
+    [[nodiscard]] bool is_connected() const;
+
+    /// Get the current value of an axis
+    /// @return -32768 to 32767 for sticks, 0 to 32767 for triggers
+    [[nodiscard]] std::int16_t axis(gamepad_axis a) const;
+
+    /// Check if a button is currently held down
+    [[nodiscard]] bool button(gamepad_button b) const;
+
+    [[nodiscard]] SDL_Gamepad* native_handle() const noexcept;
+
+private:
+    SDL_Gamepad* m_gamepad;
+    std::uint32_t m_id;
+};
+
+/// State of one gamepad at the time of a snapshot
+struct gamepad_state {
+    std::uint32_t id;
+    std::array<std::int16_t, static_cast<std::size_t>(gamepad_axis::count)> axes;
+    std::uint32_t buttons;  ///< One bit per gamepad_button
+
+    [[nodiscard]] std::int16_t axis(gamepad_axis a) const noexcept;
+    [[nodiscard]] bool pressed(gamepad_button b) const noexcept;
+};
+
+static_assert(static_cast<std::size_t>(gamepad_button::count) <= 32, "gamepad_state::buttons holds one bit per button");
+
+/// Gamepad state captured for every gamepad in a single pass
+/// @note States are stored contiguously and reused between captures
+class gamepad_snapshot {
+public:
+    /// Read the state of every gamepad into the snapshot
+    /// @param gamepads Opened gamepads to read
+    void capture(std::span<const gamepad> gamepads);
+
+    /// Captured states, in the same order as the gamepads passed to capture()
+    [[nodiscard]] std::span<const gamepad_state> states() const noexcept;
+
+private:
+    std::vector<gamepad_state> m_states;
+};
+
+// ============================================================================
+// gamepad inline implementations
+// ============================================================================
+
+inline std::uint32_t gamepad::id() const noexcept {
+    return m_id;
+}
+
+inline SDL_Gamepad* gamepad::native_handle() const noexcept {
+    return m_gamepad;
+}
+
+// ============================================================================
+// gamepad_state inline implementations
+// ============================================================================
+
+inline std::int16_t gamepad_state::axis(gamepad_axis a) const noexcept {
+    return axes[static_cast<std::size_t>(a)];
+}
+
+inline bool gamepad_state::pressed(gamepad_button b) const noexcept {
+    return (buttons >> static_cast<std::uint32_t>(b)) & 1u;
+}
+
+// ============================================================================
+// gamepad_snapshot inline implementations
+// ============================================================================
+
+inline std::span<const gamepad_state> gamepad_snapshot::states() const noexcept {
+    return m_states;
+}
+
+}  // namespace laya
@@ -0,0 +1,55 @@
+/// @file gamepad_types.hpp
+/// @brief Gamepad axis and button enumerations
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstdint>
+
+namespace laya {
+
+/// Standard gamepad axes
+/// Maps to SDL_GamepadAxis
+enum class gamepad_axis : std::uint8_t {
+    left_x = 0,
+    left_y = 1,
+    right_x = 2,
+    right_y = 3,
+    left_trigger = 4,
+    right_trigger = 5,
+    count = 6,
+};
+
+/// Standard gamepad buttons, named by position
+/// Maps to SDL_GamepadButton
+enum class gamepad_button : std::uint8_t {
+    south = 0,  ///< Bottom face button (e.g. Xbox A)
+    east = 1,   ///< Right face button (e.g. Xbox B)
+    west = 2,   ///< Left face button (e.g. Xbox X)
+    north = 3,  ///< Top face button (e.g. Xbox Y)
+    back = 4,
+    guide = 5,
+    start = 6,
+    left_stick = 7,
+    right_stick = 8,
+    left_shoulder = 9,
+    right_shoulder = 10,
+    dpad_up = 11,
+    dpad_down = 12,
+    dpad_left = 13,
+    dpad_right = 14,
+    misc1 = 15,
+    right_paddle1 = 16,
+    left_paddle1 = 17,
+    right_paddle2 = 18,
+    left_paddle2 = 19,
+    touchpad = 20,
+    misc2 = 21,
+    misc3 = 22,
+    misc4 = 23,
+    misc5 = 24,
+    misc6 = 25,
+    count = 26,
+};
+
+}  // namespace laya
@@ -0,0 +1,250 @@
+/// @file input_history.hpp
+/// @brief Ring buffer of recent button input with multi-click, hold and sequence detectors
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../events/event_types.hpp"
+#include "../events/sample_accumulator.hpp"  // for sample_view
+#include "gamepad_types.hpp"
+#include "keyboard.hpp"
+#include "mouse.hpp"
+
+namespace laya {
+
+/// Kind of device an input record came from
+enum class input_device : std::uint8_t { key, mouse, gamepad };
+
+/// Identifies one button on one kind of device
+struct input_code {
+    input_device device;
+    std::uint16_t code;  ///< Scancode, mouse button or gamepad button
+
+    [[nodiscard]] static constexpr input_code key(scancode key) noexcept;
+    [[nodiscard]] static constexpr input_code mouse(mouse_button button) noexcept;
+    [[nodiscard]] static constexpr input_code gamepad(gamepad_button button) noexcept;
+
+    [[nodiscard]] constexpr bool operator==(const input_code&) const noexcept = default;
+};
+
+/// Compact record of a single button press or release
+struct input_record {
+    std::uint64_t timestamp;  ///< Nanoseconds, same clock as event timestamps
+    std::uint32_t which;      ///< Device instance id (mouse or joystick), 0 for keys
+    std::uint16_t code;       ///< Scancode, mouse button or gamepad button
+    input_device device;
+    bool pressed;
+
+    [[nodiscard]] constexpr input_code input() const noexcept;
+};
+
+static_assert(sizeof(input_record) == 16, "input_record is meant to stay compact");
+
+/// Fixed-size history of button input
+/// @note Records are numbered with a sequence that keeps counting when the ring wraps around.
+///       Detectors remember the last sequence they processed, so each update only looks at
+///       records added since the previous one. Records must be added in timestamp order, which
+///       is the order SDL delivers events in.
+class input_history {
+public:
+    /// @param capacity Number of records kept, older ones are overwritten
+    explicit input_history(std::size_t capacity = 256);
+
+    /// Add a record, overwriting the oldest one if the history is full
+    void push(const input_record& record) noexcept;
+
+    /// Add a key, mouse button or gamepad button event
+    /// @return True if the event was recorded. Key repeats and other event types are ignored.
+    bool record(const event& ev) noexcept;
+
+    /// Remove every record, sequence numbers keep counting
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] std::size_t capacity() const noexcept;
+
+    /// Sequence number of the oldest record still in the history
+    [[nodiscard]] std::uint64_t first_sequence() const noexcept;
+
+    /// Sequence number the next record will get
+    [[nodiscard]] std::uint64_t end_sequence() const noexcept;
+
+    /// Record by sequence number, must be in [first_sequence(), end_sequence())
+    [[nodiscard]] const input_record& at(std::uint64_t sequence) const noexcept;
+
+    /// Every record, oldest first
+    [[nodiscard]] sample_view<input_record> records() const noexcept;
+
+    /// Records with `timestamp >= since`, found by binary search
+    [[nodiscard]] sample_view<input_record> since(std::uint64_t since) const noexcept;
+
+    /// Records with `begin <= timestamp < end`, found by binary search
+    [[nodiscard]] sample_view<input_record> between(std::uint64_t begin, std::uint64_t end) const noexcept;
+
+    /// Records added since a sequence number, clamped to what is still in the history
+    [[nodiscard]] sample_view<input_record> from_sequence(std::uint64_t sequence) const noexcept;
+
+private:
+    /// First sequence number whose timestamp is not below `timestamp`
+    [[nodiscard]] std::uint64_t lower_bound(std::uint64_t timestamp) const noexcept;
+
+    /// Records in [first, last) as one or two spans
+    [[nodiscard]] sample_view<input_record> view(std::uint64_t first, std::uint64_t last) const noexcept;
+
+    std::vector<input_record> m_records;
+    std::uint64_t m_end;    ///< Sequence number of the next record
+    std::uint64_t m_first;  ///< Sequence number of the oldest record
+};
+
+/// Detects N presses of the same input in quick succession (double-click, triple-tap, ...)
+class multi_click_detector {
+public:
+    /// @param input Button to watch
+    /// @param clicks Presses required
+    /// @param max_interval_ns Maximum time between two consecutive presses
+    multi_click_detector(input_code input, std::uint32_t clicks, std::uint64_t max_interval_ns) noexcept;
+
+    /// Process the records added since the last update
+    /// @return Number of multi-clicks completed by the new records
+    std::size_t update(const input_history& history) noexcept;
+
+    /// Timestamp of the press that completed the last multi-click
+    [[nodiscard]] std::uint64_t last_timestamp() const noexcept;
+
+private:
+    input_code m_input;
+    std::uint32_t m_clicks;
+    std::uint64_t m_max_interval;
+    std::uint64_t m_cursor = 0;
+    std::uint32_t m_streak = 0;
+    std::uint64_t m_last_press = 0;
+    std::uint64_t m_last_timestamp = 0;
+};
+
+/// Detects an input held down for a minimum duration
+class hold_detector {
+public:
+    /// @param input Button to watch
+    /// @param duration_ns How long the button must stay down
+    hold_detector(input_code input, std::uint64_t duration_ns) noexcept;
+
+    /// Process the records added since the last update
+    /// @param now_ns Current time on the event clock, e.g. SDL_GetTicksNS()
+    /// @return True once per hold, on the update where the duration is first reached
+    bool update(const input_history& history, std::uint64_t now_ns) noexcept;
+
+    /// Check if the button is currently down
+    [[nodiscard]] bool is_down() const noexcept;
+
+    /// Check if the current press has already lasted the full duration
+    [[nodiscard]] bool is_held() const noexcept;
+
+private:
+    input_code m_input;
+    std::uint64_t m_duration;
+    std::uint64_t m_cursor = 0;
+    std::uint64_t m_press_timestamp = 0;
+    bool m_down = false;
+    bool m_fired = false;
+};
+
+/// Detects a sequence of presses, such as a fighting game combo
+/// @note Any other press breaks the sequence, as does a gap longer than the allowed step
+///       interval. After a wrong press, the recent presses that begin the sequence still count,
+///       so {down, down, forward} matches down, down, down, forward. Releases are ignored.
+class sequence_detector {
+public:
+    /// @param steps Inputs to press in order
+    /// @param max_step_interval_ns Maximum time between two consecutive steps
+    sequence_detector(std::span<const input_code> steps, std::uint64_t max_step_interval_ns);
+
+    /// Process the records added since the last update
+    /// @return Number of sequences completed by the new records
+    std::size_t update(const input_history& history) noexcept;
+
+    /// Number of steps matched so far
+    [[nodiscard]] std::size_t progress() const noexcept;
+
+private:
+    std::vector<input_code> m_steps;
+    std::vector<std::size_t> m_fallback;  ///< Progress kept when the next step does not match
+    std::uint64_t m_max_interval;
+    std::uint64_t m_cursor = 0;
+    std::size_t m_progress = 0;
+    std::uint64_t m_last_step = 0;
+};
+
+// ============================================================================
+// input_code inline implementations
+// ============================================================================
+
+constexpr input_code input_code::key(scancode key) noexcept {
+    return {input_device::key, static_cast<std::uint16_t>(key)};
+}
+
+constexpr input_code input_code::mouse(mouse_button button) noexcept {
+    return {input_device::mouse, static_cast<std::uint16_t>(button)};
+}
+
+constexpr input_code input_code::gamepad(gamepad_button button) noexcept {
+    return {input_device::gamepad, static_cast<std::uint16_t>(button)};
+}
+
+constexpr input_code input_record::input() const noexcept {
+    return {device, code};
+}
+
+// ============================================================================
+// input_history inline implementations
+// ============================================================================
+
+inline std::size_t input_history::size() const noexcept {
+    return static_cast<std::size_t>(m_end - m_first);
+}
+
+inline std::size_t input_history::capacity() const noexcept {
+    return m_records.size();
+}
+
+inline std::uint64_t input_history::first_sequence() const noexcept {
+    return m_first;
+}
+
+inline std::uint64_t input_history::end_sequence() const noexcept {
+    return m_end;
+}
+
+inline const input_record& input_history::at(std::uint64_t sequence) const noexcept {
+    return m_records[static_cast<std::size_t>(sequence % m_records.size())];
+}
+
+inline sample_view<input_record> input_history::records() const noexcept {
+    return view(m_first, m_end);
+}
+
+// ============================================================================
+// Detector inline implementations
+// ============================================================================
+
+inline std::uint64_t multi_click_detector::last_timestamp() const noexcept {
+    return m_last_timestamp;
+}
+
+inline bool hold_detector::is_down() const noexcept {
+    return m_down;
+}
+
+inline bool hold_detector::is_held() const noexcept {
+    return m_down && m_fired;
+}
+
+inline std::size_t sequence_detector::progress() const noexcept {
+    return m_progress;
+}
+
+}  // namespace laya
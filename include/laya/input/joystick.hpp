@@ -0,0 +1,172 @@
+/// @file joystick.hpp
+/// @brief RAII joystick handles and batched joystick state snapshots
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+struct SDL_Joystick;
+
+namespace laya {
+
+/// Get the instance ids of every connected joystick
+/// @return Joystick instance ids (the `which` field of joystick events)
+/// @note Requires subsystem::joystick
+[[nodiscard]] std::vector<std::uint32_t> joystick_ids();
+
+/// RAII wrapper for an opened SDL joystick
+class joystick {
+public:
+    /// Open a joystick by instance id
+    /// @param instance_id Joystick instance id from joystick_ids() or a device event
+    /// @throws laya::error if the joystick cannot be opened or its axes, buttons or hats cannot be counted
+    explicit joystick(std::uint32_t instance_id);
+
+    ~joystick() noexcept;
+
+    joystick(const joystick&) = delete;
+    joystick& operator=(const joystick&) = delete;
+    joystick(joystick&& other) noexcept;
+    joystick& operator=(joystick&& other) noexcept;
+
+    /// Get the instance id of the joystick
+    [[nodiscard]] std::uint32_t id() const noexcept;
+
+    /// Get the implementation dependent name of the joystick
+    [[nodiscard]] std::string_view name() const;
+
+    /// Check if the joystick is still connected
+    [[nodiscard]] bool is_connected() const;
+
+    [[nodiscard]] int axis_count() const noexcept;
+    [[nodiscard]] int button_count() const noexcept;
+    [[nodiscard]] int hat_count() const noexcept;
+
+    /// Get the current value of an axis (range: -32768 to 32767)
+    [[nodiscard]] std::int16_t axis(int index) const;
+
+    /// Check if a button is currently held down
+    [[nodiscard]] bool button(int index) const;
+
+    /// Get the current position of a hat (SDL_HAT_* bitmask)
+    [[nodiscard]] std::uint8_t hat(int index) const;
+
+    [[nodiscard]] SDL_Joystick* native_handle() const noexcept;
+
+private:
+    SDL_Joystick* m_joystick;
+    std::uint32_t m_id;
+    int m_axis_count;    ///< Cached, the layout of an opened joystick never changes
+    int m_button_count;  ///< Cached, the layout of an opened joystick never changes
+    int m_hat_count;     ///< Cached, the layout of an opened joystick never changes
+};
+
+/// Holds SDL's joystick lock for a scope, so state read under it comes from one update
+/// @note Joysticks and gamepads share the lock, it also covers gamepad state
+class joystick_lock {
+public:
+    joystick_lock() noexcept;
+    ~joystick_lock() noexcept;
+
+    joystick_lock(const joystick_lock&) = delete;
+    joystick_lock& operator=(const joystick_lock&) = delete;
+};
+
+/// Joystick state captured for every joystick in a single pass
+/// @note All devices share three flat arrays (axes, buttons, hats); each device owns a slice.
+///       Storage is reused between captures, so capturing every frame does not allocate once warm.
+class joystick_snapshot {
+public:
+    /// Read the state of every joystick into the snapshot
+    /// @param joysticks Opened joysticks to read
+    void capture(std::span<const joystick> joysticks);
+
+    /// Number of joysticks captured
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Instance id of the joystick at `index`
+    [[nodiscard]] std::uint32_t id(std::size_t index) const;
+
+    /// Axis values of the joystick at `index`
+    [[nodiscard]] std::span<const std::int16_t> axes(std::size_t index) const;
+
+    /// Button states of the joystick at `index` (1 = pressed)
+    [[nodiscard]] std::span<const std::uint8_t> buttons(std::size_t index) const;
+
+    /// Hat positions of the joystick at `index`
+    [[nodiscard]] std::span<const std::uint8_t> hats(std::size_t index) const;
+
+private:
+    struct device_slice {
+        std::uint32_t id;
+        std::uint32_t axis_offset;
+        std::uint32_t button_offset;
+        std::uint32_t hat_offset;
+        std::uint16_t axis_count;
+        std::uint16_t button_count;
+        std::uint16_t hat_count;
+    };
+
+    std::vector<device_slice> m_devices;
+    std::vector<std::int16_t> m_axes;
+    std::vector<std::uint8_t> m_buttons;
+    std::vector<std::uint8_t> m_hats;
+};
+
+// ============================================================================
+// joystick inline implementations
+// ============================================================================
+
+inline std::uint32_t joystick::id() const noexcept {
+    return m_id;
+}
+
+inline int joystick::axis_count() const noexcept {
+    return m_axis_count;
+}
+
+inline int joystick::button_count() const noexcept {
+    return m_button_count;
+}
+
+inline int joystick::hat_count() const noexcept {
+    return m_hat_count;
+}
+
+inline SDL_Joystick* joystick::native_handle() const noexcept {
+    return m_joystick;
+}
+
+// ============================================================================
+// joystick_snapshot inline implementations
+// ============================================================================
+
+inline std::size_t joystick_snapshot::size() const noexcept {
+    return m_devices.size();
+}
+
+inline std::uint32_t joystick_snapshot::id(std::size_t index) const {
+    return m_devices[index].id;
+}
+
+inline std::span<const std::int16_t> joystick_snapshot::axes(std::size_t index) const {
+    const auto& device = m_devices[index];
+    return std::span<const std::int16_t>{m_axes}.subspan(device.axis_offset, device.axis_count);
+}
+
+inline std::span<const std::uint8_t> joystick_snapshot::buttons(std::size_t index) const {
+    const auto& device = m_devices[index];
+    return std::span<const std::uint8_t>{m_buttons}.subspan(device.button_offset, device.button_count);
+}
+
+inline std::span<const std::uint8_t> joystick_snapshot::hats(std::size_t index) const {
+    const auto& device = m_devices[index];
+    return std::span<const std::uint8_t>{m_hats}.subspan(device.hat_offset, device.hat_count);
+}
+
+}  // namespace laya
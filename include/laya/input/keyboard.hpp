@@ -278,6 +278,7 @@ struct enable_bitmask_operators<key_modifier> : std::true_type {};
 /// Check if a specific keycode is currently pressed
 /// @param key Virtual keycode to check
 /// @return true if key is currently held down
+/// @note The keycode is resolved through the cached table used by keycode_to_scancode
 [[nodiscard]] bool is_key_pressed(keycode key);
 
 /// Get current keyboard modifier state
@@ -297,8 +298,17 @@ struct enable_bitmask_operators<key_modifier> : std::true_type {};
 /// Convert keycode to scancode
 /// @param key Virtual keycode
 /// @return Corresponding physical scancode
+/// @note Results are cached in a laya-owned table, so repeated lookups are O(1) instead of a
+///       linear search of the SDL keymap. The table is reset by invalidate_keycode_cache().
 [[nodiscard]] scancode keycode_to_scancode(keycode key);
 
+/// Drop every cached keycode to scancode mapping
+/// @note Called automatically when laya converts or batches an SDL_EVENT_KEYMAP_CHANGED event.
+///       Call it yourself if you drain SDL events without going through laya.
+///       Safe to call from any thread, e.g. an SDL event watch; each thread's table is reset on
+///       its next lookup.
+void invalidate_keycode_cache() noexcept;
+
 /// Get human-readable name for scancode
 /// @param scan Scancode to name
 /// @return String name (e.g., "A", "Space", "Left Ctrl")
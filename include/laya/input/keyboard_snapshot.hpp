@@ -0,0 +1,229 @@
+/// @file keyboard_snapshot.hpp
+/// @brief Per-frame keyboard state snapshots with edge detection
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#include "keyboard.hpp"
+
+namespace laya {
+
+/// Set of scancodes stored as a 512-bit bitset
+/// @note Iteration visits set bits only, so walking the changed keys of a frame is O(changed)
+class scancode_set {
+public:
+    static constexpr std::size_t bit_count = 512;
+    static constexpr std::size_t word_count = bit_count / 64;
+    using words = std::array<std::uint64_t, word_count>;
+
+    /// Forward iterator over the scancodes in the set, in ascending order
+    class iterator {
+    public:
+        using value_type = scancode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = scancode;
+        using iterator_category = std::forward_iterator_tag;
+
+        /// Construct end iterator
+        constexpr iterator() noexcept = default;
+
+        [[nodiscard]] constexpr scancode operator*() const noexcept;
+        constexpr iterator& operator++() noexcept;
+        constexpr iterator operator++(int) noexcept;
+        [[nodiscard]] constexpr bool operator==(const iterator& other) const noexcept;
+
+    private:
+        friend class scancode_set;
+
+        constexpr explicit iterator(const words* bits) noexcept;
+
+        /// Move to the next non-empty word if the current one is exhausted
+        constexpr void skip_empty() noexcept;
+
+    private:
+        const words* m_bits = nullptr;
+        std::size_t m_word = word_count;
+        std::uint64_t m_remaining = 0;  ///< Bits of the current word not yet visited
+    };
+
+    constexpr scancode_set() noexcept = default;
+    constexpr explicit scancode_set(const words& bits) noexcept;
+
+    [[nodiscard]] constexpr bool contains(scancode key) const noexcept;
+    [[nodiscard]] constexpr bool empty() const noexcept;
+    [[nodiscard]] constexpr std::size_t size() const noexcept;
+
+    [[nodiscard]] constexpr iterator begin() const noexcept;
+    [[nodiscard]] constexpr iterator end() const noexcept;
+
+    [[nodiscard]] constexpr const words& bits() const noexcept;
+
+private:
+    words m_bits{};
+};
+
+/// Keyboard state copied once per frame
+/// @note Call update() once per frame after polling events. Queries then read the local
+///       bitset instead of calling into SDL, and compare against the previous frame.
+class keyboard_snapshot {
+public:
+    /// Copy the current SDL keyboard state and diff it against the previous snapshot
+    void update();
+
+    /// Take a snapshot from an explicit key state array (e.g. replayed input)
+    /// @param state One byte per scancode, non-zero when held
+    /// @param num_keys Number of entries in `state`, entries past 512 are ignored
+    void update(const std::uint8_t* state, int num_keys) noexcept;
+
+    /// Check if the key is held down in this snapshot
+    [[nodiscard]] bool held(scancode key) const noexcept;
+
+    /// Check if the key went down since the previous snapshot
+    [[nodiscard]] bool pressed(scancode key) const noexcept;
+
+    /// Check if the key went up since the previous snapshot
+    [[nodiscard]] bool released(scancode key) const noexcept;
+
+    /// Check if the key changed state since the previous snapshot
+    [[nodiscard]] bool changed(scancode key) const noexcept;
+
+    /// Check if any key is held down
+    [[nodiscard]] bool any_held() const noexcept;
+
+    /// Every key held down in this snapshot
+    [[nodiscard]] scancode_set held_keys() const noexcept;
+
+    /// Keys that went down since the previous snapshot
+    [[nodiscard]] scancode_set pressed_keys() const noexcept;
+
+    /// Keys that went up since the previous snapshot
+    [[nodiscard]] scancode_set released_keys() const noexcept;
+
+    /// Keys that changed state since the previous snapshot
+    [[nodiscard]] scancode_set changed_keys() const noexcept;
+
+private:
+    /// Diff the freshly packed current state against the previous one
+    void diff() noexcept;
+
+    [[nodiscard]] static bool test(const scancode_set::words& bits, scancode key) noexcept;
+
+private:
+    scancode_set::words m_current{};
+    scancode_set::words m_previous{};
+    scancode_set::words m_changed{};
+};
+
+// ============================================================================
+// scancode_set inline implementations
+// ============================================================================
+
+constexpr scancode_set::iterator::iterator(const words* bits) noexcept
+    : m_bits{bits}, m_word{0}, m_remaining{(*bits)[0]} {
+    skip_empty();
+}
+
+constexpr void scancode_set::iterator::skip_empty() noexcept {
+    while (m_remaining == 0 && m_word < word_count) {
+        ++m_word;
+        m_remaining = m_word < word_count ? (*m_bits)[m_word] : 0;
+    }
+}
+
+constexpr scancode scancode_set::iterator::operator*() const noexcept {
+    return static_cast<scancode>(m_word * 64 + static_cast<std::size_t>(std::countr_zero(m_remaining)));
+}
+
+constexpr scancode_set::iterator& scancode_set::iterator::operator++() noexcept {
+    m_remaining &= m_remaining - 1;  // clear lowest set bit
+    skip_empty();
+    return *this;
+}
+
+constexpr scancode_set::iterator scancode_set::iterator::operator++(int) noexcept {
+    iterator tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+constexpr bool scancode_set::iterator::operator==(const iterator& other) const noexcept {
+    return m_word == other.m_word && m_remaining == other.m_remaining;
+}
+
+constexpr scancode_set::scancode_set(const words& bits) noexcept : m_bits{bits} {
+}
+
+constexpr bool scancode_set::contains(scancode key) const noexcept {
+    const auto index = static_cast<std::size_t>(key);
+    return index < bit_count && ((m_bits[index / 64] >> (index % 64)) & 1u) != 0;
+}
+
+constexpr bool scancode_set::empty() const noexcept {
+    std::uint64_t any = 0;
+    for (const auto word : m_bits) {
+        any |= word;
+    }
+    return any == 0;
+}
+
+constexpr std::size_t scancode_set::size() const noexcept {
+    std::size_t count = 0;
+    for (const auto word : m_bits) {
+        count += static_cast<std::size_t>(std::popcount(word));
+    }
+    return count;
+}
+
+constexpr scancode_set::iterator scancode_set::begin() const noexcept {
+    return iterator{&m_bits};
+}
+
+constexpr scancode_set::iterator scancode_set::end() const noexcept {
+    return iterator{};
+}
+
+constexpr const scancode_set::words& scancode_set::bits() const noexcept {
+    return m_bits;
+}
+
+// ============================================================================
+// keyboard_snapshot inline implementations
+// ============================================================================
+
+inline bool keyboard_snapshot::test(const scancode_set::words& bits, scancode key) noexcept {
+    const auto index = static_cast<std::size_t>(key);
+    return index < scancode_set::bit_count && ((bits[index / 64] >> (index % 64)) & 1u) != 0;
+}
+
+inline bool keyboard_snapshot::held(scancode key) const noexcept {
+    return test(m_current, key);
+}
+
+inline bool keyboard_snapshot::pressed(scancode key) const noexcept {
+    return test(m_changed, key) && test(m_current, key);
+}
+
+inline bool keyboard_snapshot::released(scancode key) const noexcept {
+    return test(m_changed, key) && !test(m_current, key);
+}
+
+inline bool keyboard_snapshot::changed(scancode key) const noexcept {
+    return test(m_changed, key);
+}
+
+inline scancode_set keyboard_snapshot::held_keys() const noexcept {
+    return scancode_set{m_current};
+}
+
+inline scancode_set keyboard_snapshot::changed_keys() const noexcept {
+    return scancode_set{m_changed};
+}
+
+}  // namespace laya
@@ -7,7 +7,7 @@
 #include <cstdint>
 
 #include "../bitmask.hpp"
-#include "../renderers/renderer_types.hpp"  // for point
+#include "../renderers/renderer_types.hpp"  // for point, point_f
 
 namespace laya {
 
@@ -71,8 +71,23 @@ enum class system_cursor {
 /// Get current mouse position relative to specific window
 /// @param win Window to query relative position
 /// @return Mouse position relative to window
+/// @note Queries the window position from SDL when the window does not have mouse focus.
+///       Use mouse_tracker to query several windows per frame.
 [[nodiscard]] point get_mouse_position(const window& win);
 
+/// Get current mouse position relative to focused window, with sub-pixel precision
+/// @return Current mouse position, or {0, 0} if no window has focus
+[[nodiscard]] point_f get_mouse_position_f();
+
+/// Get current mouse position in global screen coordinates, with sub-pixel precision
+/// @return Global mouse position
+[[nodiscard]] point_f get_global_mouse_position_f();
+
+/// Get current mouse position relative to specific window, with sub-pixel precision
+/// @param win Window to query relative position
+/// @return Mouse position relative to window
+[[nodiscard]] point_f get_mouse_position_f(const window& win);
+
 /// Get current mouse button state
 /// @return Bitmask of pressed buttons
 [[nodiscard]] mouse_button_mask get_mouse_state();
@@ -83,6 +98,12 @@ enum class system_cursor {
 /// @return Bitmask of pressed buttons
 [[nodiscard]] mouse_button_mask get_mouse_state(int& x, int& y);
 
+/// Get current mouse position and button state, with sub-pixel precision
+/// @param x Output: current X position
+/// @param y Output: current Y position
+/// @return Bitmask of pressed buttons
+[[nodiscard]] mouse_button_mask get_mouse_state(float& x, float& y);
+
 /// Check if specific mouse button is pressed
 /// @param button Button to check
 /// @return true if button is currently pressed
@@ -94,6 +115,14 @@ enum class system_cursor {
 /// @return Bitmask of pressed buttons during motion
 [[nodiscard]] mouse_button_mask get_relative_mouse_state(int& x, int& y);
 
+/// Get relative mouse motion since last call, with sub-pixel precision
+/// @param x Output: X motion
+/// @param y Output: Y motion
+/// @return Bitmask of pressed buttons during motion
+/// @note The int overload truncates, so fractional motion is lost on every call. Use this
+///       overload or mouse_motion_accumulator to keep it.
+[[nodiscard]] mouse_button_mask get_relative_mouse_state(float& x, float& y);
+
 // ============================================================================
 // Mouse control
 // ============================================================================
@@ -103,6 +132,11 @@ enum class system_cursor {
 /// @param pos Position in window coordinates
 void warp_mouse_in_window(window& win, point pos);
 
+/// Warp mouse to sub-pixel position in window
+/// @param win Target window
+/// @param pos Position in window coordinates
+void warp_mouse_in_window(window& win, point_f pos);
+
 /// Warp mouse to global screen position
 /// @param pos Global screen coordinates
 void warp_mouse_global(point pos);
@@ -0,0 +1,81 @@
+/// @file mouse_motion_accumulator.hpp
+/// @brief Lossless per-frame accumulation of relative mouse motion
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+
+#include "../events/event_types.hpp"
+#include "../renderers/renderer_types.hpp"
+
+namespace laya {
+
+/// Integrates relative mouse motion between frames without losing sub-pixel movement
+/// @note High-rate mice report many small motion events per frame. Feed every event to add()
+///       while polling, then read the frame's motion with take() or take_pixels(). Sums are kept
+///       in double precision so thousands of fractional samples do not drift.
+class mouse_motion_accumulator {
+public:
+    /// Add the relative motion of a mouse_motion_event, other events are ignored
+    /// @return True if the event was a mouse motion event
+    bool add(const event& ev) noexcept;
+
+    /// Add the relative motion of a motion event
+    void add(const mouse_motion_event& ev) noexcept;
+
+    /// Add raw relative motion, e.g. from get_relative_mouse_state(float&, float&)
+    void add(float xrel, float yrel) noexcept;
+
+    /// Motion accumulated since the last take or reset
+    [[nodiscard]] point_f delta() const noexcept;
+
+    /// Number of motion samples added since the last take or reset
+    [[nodiscard]] std::size_t sample_count() const noexcept;
+
+    /// Return the accumulated motion and start over
+    point_f take() noexcept;
+
+    /// Return the whole-pixel part of the accumulated motion
+    /// @note The fractional remainder is kept and carried into the next frame, so slow
+    ///       movement eventually moves a pixel instead of being truncated away every frame
+    point take_pixels() noexcept;
+
+    /// Drop all accumulated motion, including any carried remainder
+    void reset() noexcept;
+
+private:
+    double m_x = 0.0;
+    double m_y = 0.0;
+    std::size_t m_samples = 0;
+};
+
+// ============================================================================
+// mouse_motion_accumulator inline implementations
+// ============================================================================
+
+inline void mouse_motion_accumulator::add(const mouse_motion_event& ev) noexcept {
+    add(ev.precise_xrel, ev.precise_yrel);
+}
+
+inline void mouse_motion_accumulator::add(float xrel, float yrel) noexcept {
+    m_x += static_cast<double>(xrel);
+    m_y += static_cast<double>(yrel);
+    ++m_samples;
+}
+
+inline point_f mouse_motion_accumulator::delta() const noexcept {
+    return {static_cast<float>(m_x), static_cast<float>(m_y)};
+}
+
+inline std::size_t mouse_motion_accumulator::sample_count() const noexcept {
+    return m_samples;
+}
+
+inline void mouse_motion_accumulator::reset() noexcept {
+    m_x = 0.0;
+    m_y = 0.0;
+    m_samples = 0;
+}
+
+}  // namespace laya
@@ -0,0 +1,88 @@
+/// @file mouse_tracker.hpp
+/// @brief Window-relative mouse positions for many windows from one query per frame
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "../events/event_types.hpp"
+#include "../renderers/renderer_types.hpp"
+#include "../windows/window_flags.hpp"
+#include "../windows/window_id.hpp"
+
+namespace laya {
+
+class window;
+
+/// Tracks the mouse position relative to a set of windows
+/// @note Window geometry is queried once in track() and then kept current from `moved` and
+///       `resized` window events passed to handle(). update() then costs one global mouse query
+///       per frame no matter how many windows are tracked, where get_mouse_position(const window&)
+///       queries SDL for the window position on every call.
+class mouse_tracker {
+public:
+    /// Start tracking a window, querying its position and size once
+    /// @throws laya::error if the window geometry cannot be queried
+    void track(const window& win);
+
+    /// Start tracking a window with known geometry, without querying SDL
+    void track(window_id id, laya::position pos, dimensions size);
+
+    /// Stop tracking a window
+    /// @return True if the window was tracked
+    bool untrack(window_id id) noexcept;
+
+    /// Update cached geometry from a window event, other events are ignored
+    void handle(const event& ev) noexcept;
+
+    /// Query the global mouse position and recompute every window-relative position
+    void update();
+
+    /// Recompute every window-relative position from a known global position
+    void update(point_f global) noexcept;
+
+    /// Global mouse position as of the last update
+    [[nodiscard]] point_f global_position() const noexcept;
+
+    /// Mouse position relative to a window as of the last update
+    /// @return std::nullopt if the window is not tracked
+    [[nodiscard]] std::optional<point_f> position(window_id id) const noexcept;
+
+    /// Check if the mouse was inside a window's client area at the last update
+    [[nodiscard]] bool is_inside(window_id id) const noexcept;
+
+    /// Number of tracked windows
+    [[nodiscard]] std::size_t size() const noexcept;
+
+private:
+    struct tracked_window {
+        window_id id;
+        laya::position pos;
+        dimensions size;
+        point_f relative;
+        bool inside;
+    };
+
+    [[nodiscard]] tracked_window* find(window_id id) noexcept;
+    [[nodiscard]] const tracked_window* find(window_id id) const noexcept;
+
+    std::vector<tracked_window> m_windows;
+    point_f m_global{};
+};
+
+// ============================================================================
+// mouse_tracker inline implementations
+// ============================================================================
+
+inline point_f mouse_tracker::global_position() const noexcept {
+    return m_global;
+}
+
+inline std::size_t mouse_tracker::size() const noexcept {
+    return m_windows.size();
+}
+
+}  // namespace laya
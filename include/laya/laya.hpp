@@ -6,15 +6,34 @@
 
 #include "events/event_types.hpp"
 #include "events/event_polling.hpp"
+#include "events/event_recording.hpp"
+#include "events/event_batch.hpp"
+#include "events/sample_accumulator.hpp"
 #include "input/keyboard.hpp"
+#include "input/keyboard_snapshot.hpp"
+#include "input/action_map.hpp"
 #include "input/mouse.hpp"
+#include "input/mouse_motion_accumulator.hpp"
+#include "input/mouse_tracker.hpp"
+#include "input/input_history.hpp"
+#include "input/joystick.hpp"
+#include "input/gamepad.hpp"
 #include "renderers/renderer.hpp"
+#include "renderers/command_list.hpp"
+#include "renderers/command_list_group.hpp"
+#include "renderers/frame_handoff.hpp"
 #include "surfaces/pixel_format.hpp"
 #include "surfaces/surface_flags.hpp"
 #include "surfaces/surface.hpp"
 #include "textures/texture_access.hpp"
 #include "textures/texture.hpp"
 #include "windows/window.hpp"
+#include "windows/window_registry.hpp"
+#include "displays/display.hpp"
+#include "displays/frame_pacer.hpp"
+#include "tasks/main_thread.hpp"
+#include "tasks/job_system.hpp"
 #include "subsystems.hpp"
 #include "errors.hpp"
+#include "result.hpp"
 #include "logging/log.hpp"
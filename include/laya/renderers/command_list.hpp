@@ -0,0 +1,213 @@
+/// @file command_list.hpp
+/// @brief Recorded draw commands replayed on the thread that owns the renderer
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "renderer_types.hpp"
+#include <laya/result.hpp>
+
+struct SDL_Texture;
+
+namespace laya {
+
+// Forward declarations
+class renderer;
+class texture;
+
+namespace detail {
+
+/// Rectangle stored in the layout SDL_RenderFillRects and friends take
+struct recorded_rect {
+    float x, y, w, h;
+
+    [[nodiscard]] constexpr bool operator==(const recorded_rect&) const noexcept = default;
+};
+
+/// Arguments of one recorded texture draw
+struct recorded_copy {
+    SDL_Texture* texture;
+    recorded_rect src;
+    recorded_rect dst;
+    point_f center;
+    double angle;
+    flip_mode flip;
+    bool has_src;
+    bool has_center;
+
+    [[nodiscard]] constexpr bool operator==(const recorded_copy&) const noexcept = default;
+};
+
+}  // namespace detail
+
+/// Draw commands recorded on any thread and replayed later on the thread that owns the renderer
+/// @note Recording only appends to vectors and converts coordinates to the float layout SDL uses,
+///       so replay issues SDL calls straight from the stored arrays. Consecutive points, rectangle
+///       outlines and filled rectangles are merged into one batched SDL call. reset() keeps the
+///       storage, so a list reused every frame stops allocating once it has seen its largest frame.
+/// @note Textures are referenced, not owned, and must outlive the replay of the frame.
+class command_list {
+public:
+    command_list() = default;
+
+    // ========================================================================
+    // Frame operations
+    // ========================================================================
+
+    /// Record clearing the target with the current draw color
+    void clear();
+
+    // ========================================================================
+    // State management
+    // ========================================================================
+
+    /// Record setting the color used for drawing operations
+    void set_draw_color(color c);
+
+    /// Record setting the blend mode used for drawing operations
+    void set_blend_mode(blend_mode mode);
+
+    /// Record setting the drawing area for rendering on the current target
+    void set_viewport(const rect& viewport);
+
+    /// Record resetting the viewport to the entire target
+    void reset_viewport();
+
+    // ========================================================================
+    // Primitive drawing operations
+    // ========================================================================
+
+    /// Record drawing a point
+    void draw_point(point p);
+
+    /// Record drawing multiple points
+    void draw_points(const point* points, int count);
+
+    /// Record drawing a line between two points
+    void draw_line(point from, point to);
+
+    /// Record drawing a series of connected lines
+    void draw_lines(const point* points, int count);
+
+    /// Record drawing the outline of a rectangle
+    void draw_rect(const rect& r);
+
+    /// Record drawing the outlines of multiple rectangles
+    void draw_rects(const rect* rects, int count);
+
+    /// Record filling a rectangle with the current draw color
+    void fill_rect(const rect& r);
+
+    /// Record filling multiple rectangles with the current draw color
+    void fill_rects(const rect* rects, int count);
+
+    // ========================================================================
+    // Texture rendering operations
+    // ========================================================================
+
+    /// Record rendering an entire texture at destination position
+    void render(const texture& tex, point dst_pos);
+
+    /// Record rendering an entire texture to destination rectangle
+    void render(const texture& tex, const rect& dst_rect);
+
+    /// Record rendering a texture region to destination rectangle
+    void render(const texture& tex, const rect& src_rect, const rect& dst_rect);
+
+    /// Record rendering a texture with rotation around its center
+    void render(const texture& tex, const rect& dst_rect, double angle);
+
+    /// Record rendering a texture with full control (rotation, center, flip)
+    void render(const texture& tex, const rect& src_rect, const rect& dst_rect, double angle, point center,
+                flip_mode flip);
+
+    /// Record rendering a texture with flipping
+    void render(const texture& tex, const rect& dst_rect, flip_mode flip);
+
+    // ========================================================================
+    // Combining lists
+    // ========================================================================
+
+    /// Record every command of another list after this list's commands
+    /// @param other A different list
+    /// @note A batched draw at the start of `other` merges with a matching one at the end of this list
+    void append(const command_list& other);
+
+    // ========================================================================
+    // Replay
+    // ========================================================================
+
+    /// Issue the recorded commands to a renderer, in recording order
+    /// @throws laya::error if a command fails; the commands before it have been issued
+    void replay(renderer& r) const;
+
+    /// Issue the recorded commands, reporting the first failure instead of throwing
+    result<void> try_replay(renderer& r) const;
+
+    /// Remove all commands while keeping the allocated storage
+    void reset() noexcept;
+
+    /// Reserve storage for the given number of commands and of points, rectangles or copies each
+    void reserve(std::size_t commands, std::size_t items);
+
+    /// Number of recorded commands after merging
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Check if no commands are recorded
+    [[nodiscard]] bool empty() const noexcept;
+
+    /// Check if two lists hold the same commands with the same arguments, in the same order
+    [[nodiscard]] bool operator==(const command_list&) const = default;
+
+private:
+    enum class op : std::uint8_t {
+        clear,
+        set_draw_color,
+        set_blend_mode,
+        set_viewport,
+        reset_viewport,
+        draw_points,
+        draw_lines,
+        draw_rects,
+        fill_rects,
+        render_texture,
+    };
+
+    /// One recorded command, its arguments live in the pools below
+    struct command {
+        op type;
+        std::uint32_t first;  ///< Index into the pool for the op, or the packed argument itself
+        std::uint32_t count;
+
+        [[nodiscard]] constexpr bool operator==(const command&) const noexcept = default;
+    };
+
+    /// Add `count` items to the last command if it is the same op and ends at `first`, else start one
+    void append_batched(op type, std::uint32_t first, std::uint32_t count);
+
+    void record_copy(const texture& tex, const rect* src_rect, const rect& dst_rect, double angle,
+                     const point* center, flip_mode flip);
+
+    std::vector<command> m_commands;
+    std::vector<point_f> m_points;
+    std::vector<detail::recorded_rect> m_rects;
+    std::vector<detail::recorded_copy> m_copies;
+};
+
+// ============================================================================
+// Inline implementations
+// ============================================================================
+
+inline std::size_t command_list::size() const noexcept {
+    return m_commands.size();
+}
+
+inline bool command_list::empty() const noexcept {
+    return m_commands.empty();
+}
+
+}  // namespace laya
@@ -0,0 +1,88 @@
+/// @file command_list_group.hpp
+/// @brief Command lists recorded in parallel and merged in a fixed order
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "command_list.hpp"
+
+namespace laya {
+
+/// A set of command lists, one per independently drawn region, replayed in sort key order
+/// @note Each slot belongs to one thread while recording, so workers record side by side without
+///       locks, e.g. one slot per UI panel inside job_system::parallel_for(). Merging orders slots by
+///       key, then by slot index, so the result does not depend on which thread recorded what or
+///       when it finished. Submission to the renderer stays on the thread that owns it.
+class command_list_group {
+public:
+    command_list_group() = default;
+
+    /// Create a group with `count` slots, keyed by their index
+    explicit command_list_group(std::size_t count);
+
+    /// Change the number of slots, new slots are keyed by their index
+    void resize(std::size_t count);
+
+    /// Number of slots
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// List of a slot, to be recorded by one thread at a time
+    [[nodiscard]] command_list& operator[](std::size_t slot) noexcept;
+    [[nodiscard]] const command_list& operator[](std::size_t slot) const noexcept;
+
+    /// Set the sort key of a slot, lower keys are drawn first
+    /// @note Safe to call for different slots from different threads
+    void set_key(std::size_t slot, std::uint64_t key) noexcept;
+
+    /// Sort key of a slot
+    [[nodiscard]] std::uint64_t key(std::size_t slot) const noexcept;
+
+    /// Append every slot's commands to `out` in key order
+    /// @note Batched draws at the seams of neighbouring slots merge into one SDL call
+    void merge_into(command_list& out);
+
+    /// Replay every slot in key order without building a merged list
+    /// @throws laya::error if a command fails
+    void replay(renderer& r);
+
+    /// Clear every slot's commands while keeping the storage and the keys
+    void reset() noexcept;
+
+private:
+    /// Refresh m_order to the slot indices sorted by (key, index)
+    void sort_slots();
+
+    std::vector<command_list> m_lists;
+    std::vector<std::uint64_t> m_keys;
+    std::vector<std::size_t> m_order;  ///< Reused by every merge
+};
+
+// ============================================================================
+// Inline implementations
+// ============================================================================
+
+inline std::size_t command_list_group::size() const noexcept {
+    return m_lists.size();
+}
+
+inline command_list& command_list_group::operator[](std::size_t slot) noexcept {
+    return m_lists[slot];
+}
+
+inline const command_list& command_list_group::operator[](std::size_t slot) const noexcept {
+    return m_lists[slot];
+}
+
+inline void command_list_group::set_key(std::size_t slot, std::uint64_t key) noexcept {
+    m_keys[slot] = key;
+}
+
+inline std::uint64_t command_list_group::key(std::size_t slot) const noexcept {
+    return m_keys[slot];
+}
+
+}  // namespace laya
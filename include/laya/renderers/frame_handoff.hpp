@@ -0,0 +1,84 @@
+/// @file frame_handoff.hpp
+/// @brief Double-buffered command lists between a simulation thread and the render thread
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "command_list.hpp"
+
+namespace laya {
+
+/// Counters collected by frame_handoff
+struct frame_handoff_stats {
+    std::uint64_t frames_submitted = 0;
+    std::uint64_t frames_rendered = 0;
+    std::chrono::nanoseconds submit_wait{0};  ///< Time the recording thread spent blocked in submit()
+    std::chrono::nanoseconds render_wait{0};  ///< Time the render thread spent waiting for a frame
+};
+
+/// Two command lists passed back and forth so frame N+1 is recorded while frame N is replayed
+/// @note The recording thread fills recording() and calls submit(). The thread that owns the
+///       renderer (the main thread, per SDL rules) calls render(), which replays the submitted list
+///       and presents it, so a present blocked on vsync overlaps with recording the next frame.
+///       submit() waits only while the render thread still replays the other list, so the recording
+///       side runs at most one frame ahead. The lists are swapped, never copied, and keep their
+///       storage, so the handoff does not allocate once both lists have seen a full frame.
+class frame_handoff {
+public:
+    frame_handoff() = default;
+
+    frame_handoff(const frame_handoff&) = delete;
+    frame_handoff& operator=(const frame_handoff&) = delete;
+    frame_handoff(frame_handoff&&) = delete;
+    frame_handoff& operator=(frame_handoff&&) = delete;
+
+    /// List the recording thread fills for the next frame
+    /// @note Only valid on the recording thread, between submit() calls
+    [[nodiscard]] command_list& recording() noexcept;
+
+    /// Hand the recorded list to the render thread and start an empty one
+    /// @return false if close() was called, in which case the frame is dropped
+    bool submit();
+
+    /// Replay and present the next submitted frame on the thread that owns the renderer
+    /// @param timeout How long to wait for a frame, so the caller can keep pumping events
+    /// @return true if a frame was presented, false on timeout or once closed with no frame left
+    /// @throws laya::error if a command or the present fails; the frame still counts as consumed
+    bool render(renderer& r, std::chrono::nanoseconds timeout = std::chrono::nanoseconds::max());
+
+    /// Wake both sides and make submit() and render() return false from now on
+    void close();
+
+    /// Counters since construction
+    [[nodiscard]] frame_handoff_stats stats() const;
+
+private:
+    /// Mark the list render() replayed as free again and wake submit()
+    void release_replayed() noexcept;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_frame_ready;     ///< Signalled by submit()
+    std::condition_variable m_list_released;  ///< Signalled when render() is done with a list
+    std::array<command_list, 2> m_lists;
+    int m_recording = 0;      ///< Index of the list owned by the recording thread
+    bool m_pending = false;   ///< The other list holds a submitted frame not yet taken by render()
+    bool m_replaying = false;  ///< render() is replaying the other list
+    bool m_closed = false;
+    frame_handoff_stats m_stats;
+};
+
+// ============================================================================
+// Inline implementations
+// ============================================================================
+
+inline command_list& frame_handoff::recording() noexcept {
+    return m_lists[static_cast<std::size_t>(m_recording)];
+}
+
+}  // namespace laya
@@ -4,9 +4,14 @@
 
 #pragma once
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "renderer_flags.hpp"
 #include "renderer_id.hpp"
 #include "renderer_types.hpp"
+#include <laya/result.hpp>
 #include <laya/textures/texture_access.hpp>
 
 struct SDL_Renderer;
@@ -25,8 +30,16 @@ class texture;
 struct renderer_args {
     renderer_flags flags = renderer_flags::accelerated;  ///< Renderer creation flags
     vsync_mode vsync = vsync_mode::enabled;              ///< VSync mode (default: enabled)
+    std::string_view driver{};                           ///< From available_render_drivers(), empty lets SDL choose
+    line_method lines = line_method::automatic;          ///< Line drawing method, read once at creation
+    int vsync_interval = 1;                              ///< With vsync enabled, present on every Nth refresh
 };
 
+/// Get the names of the render drivers built into SDL, in the order SDL tries them
+/// @note Names can be passed as renderer_args::driver. A listed driver may still fail to create
+///       a renderer on the current system, e.g. a GPU driver without a usable device.
+[[nodiscard]] std::vector<std::string> available_render_drivers();
+
 // ============================================================================
 // RAII state guards
 // ============================================================================
@@ -123,6 +136,11 @@ public:
     /// Update the screen with any rendering performed since the previous call
     void present();
 
+    /// Send the batched draw calls to the driver now
+    /// @note SDL batches draw calls and sends them on present or when state requires it. Call this
+    ///       only before drawing through the native graphics API behind native_handle().
+    void flush();
+
     // ========================================================================
     // State management
     // ========================================================================
@@ -224,6 +242,54 @@ public:
     /// Render part of texture with flipping
     void render(const texture& tex, const rect& src_rect, const rect& dst_rect, flip_mode flip);
 
+    // ========================================================================
+    // Non-throwing operations
+    // ========================================================================
+    /// Create renderer for window, reporting failure instead of throwing
+    [[nodiscard]] static result<renderer> try_create(window& win, const renderer_args& args = {});
+
+    /// Clear the render target, reporting failure instead of throwing
+    result<void> try_clear();
+
+    /// Present the rendered frame, reporting failure instead of throwing
+    result<void> try_present();
+
+    /// Submit pending render commands, reporting failure instead of throwing
+    result<void> try_flush();
+
+    /// Set the draw color, reporting failure instead of throwing
+    result<void> try_set_draw_color(color c);
+
+    /// Set the blend mode, reporting failure instead of throwing
+    result<void> try_set_blend_mode(blend_mode mode);
+
+    /// Set the viewport, reporting failure instead of throwing
+    result<void> try_set_viewport(const rect& viewport);
+
+    /// Draw a point, reporting failure instead of throwing
+    result<void> try_draw_point(point p);
+
+    /// Draw a line, reporting failure instead of throwing
+    result<void> try_draw_line(point from, point to);
+
+    /// Draw a rectangle outline, reporting failure instead of throwing
+    result<void> try_draw_rect(const rect& r);
+
+    /// Fill a rectangle, reporting failure instead of throwing
+    result<void> try_fill_rect(const rect& r);
+
+    /// Fill several rectangles in one call, reporting failure instead of throwing
+    result<void> try_fill_rects(const rect* rects, int count);
+
+    /// Render a whole texture at a position, reporting failure instead of throwing
+    result<void> try_render(const texture& tex, point dst_pos);
+
+    /// Render a whole texture into a rectangle, reporting failure instead of throwing
+    result<void> try_render(const texture& tex, const rect& dst_rect);
+
+    /// Render part of a texture into a rectangle, reporting failure instead of throwing
+    result<void> try_render(const texture& tex, const rect& src_rect, const rect& dst_rect);
+
     // ========================================================================
     // Accessors
     // ========================================================================
@@ -231,10 +297,16 @@ public:
     /// Get the renderer ID for correlation with events
     [[nodiscard]] renderer_id id() const noexcept;
 
+    /// Get the name of the driver this renderer uses, as listed by available_render_drivers()
+    [[nodiscard]] std::string_view driver_name() const;
+
     /// Get the native SDL renderer handle
     [[nodiscard]] SDL_Renderer* native_handle() const noexcept;
 
 private:
+    /// Take ownership of a created SDL renderer
+    explicit renderer(SDL_Renderer* handle) noexcept;
+
     SDL_Renderer* m_renderer;
     renderer_id m_id;
 };
@@ -38,6 +38,30 @@ struct point {
     }
 };
 
+/// 2D point with floating-point coordinates
+struct point_f {
+    float x;  ///< X coordinate
+    float y;  ///< Y coordinate
+
+    /// Construct point at origin
+    constexpr point_f() noexcept : x(0.0f), y(0.0f) {
+    }
+
+    /// Construct point with coordinates
+    constexpr point_f(float x_pos, float y_pos) noexcept : x(x_pos), y(y_pos) {
+    }
+
+    /// Equality comparison
+    [[nodiscard]] constexpr bool operator==(const point_f& other) const noexcept {
+        return x == other.x && y == other.y;
+    }
+
+    /// Inequality comparison
+    [[nodiscard]] constexpr bool operator!=(const point_f& other) const noexcept {
+        return !(*this == other);
+    }
+};
+
 /// Rectangle with integer coordinates and dimensions
 struct rect {
     int x;  ///< X coordinate of top-left corner
@@ -188,4 +212,16 @@ enum class vsync_mode : int {
     adaptive = -1  ///< Adaptive vsync (tear if late)
 };
 
+// ============================================================================
+// Line drawing methods
+// ============================================================================
+
+/// How a renderer draws lines (SDL_HINT_RENDER_LINE_METHOD)
+enum class line_method : int {
+    automatic = 0,  ///< Leave the SDL hint untouched, SDL falls back to points when it is unset
+    points = 1,     ///< Draw lines as point lists (SDL default), slow but exact on every driver
+    lines = 2,      ///< Use the driver's line primitive, endpoints may differ between drivers
+    geometry = 3    ///< Draw lines as triangles, exact and fast on most drivers
+};
+
 }  // namespace laya
@@ -0,0 +1,196 @@
+/// @file result.hpp
+/// @brief Non-throwing return type used by the try_ variants of wrapper operations
+/// @date 2026-10-17
+
+#pragma once
+
+#include <optional>
+#include <source_location>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "errors.hpp"
+
+namespace laya {
+
+/// Why a try_ operation failed
+/// @note Construction copies SDL's message, since SDL overwrites it on the next failing call,
+///       and keeps the context as a pointer to a string literal. Nothing is formatted until
+///       message() or what() on the converted laya::error is called.
+class error_info {
+public:
+    /// @param context String literal describing the operation, e.g. "Failed to clear renderer"
+    error_info(error_code code, const char* context, std::string detail = {},
+               const std::source_location& location = std::source_location::current()) noexcept;
+
+    /// Capture the current SDL error
+    [[nodiscard]] static error_info from_sdl(const char* context,
+                                             const std::source_location& location = std::source_location::current());
+
+    [[nodiscard]] error_code code() const noexcept;
+    [[nodiscard]] const char* context() const noexcept;
+    [[nodiscard]] const std::string& detail() const noexcept;
+    [[nodiscard]] const std::source_location& location() const noexcept;
+
+    /// "context: detail", formatted on each call
+    [[nodiscard]] std::string message() const;
+
+    /// Exception equivalent to what the throwing API reports for the same failure
+    [[nodiscard]] error to_error() const;
+
+private:
+    std::string m_detail;
+    std::source_location m_location;
+    const char* m_context;
+    error_code m_code;
+};
+
+/// Value of an operation that may fail, or the reason it failed
+/// @note Mirrors the subset of C++23 std::expected that laya needs. value() throws laya::error
+///       so code can mix both styles, e.g. `auto tex = texture::try_create(r, args).value();`
+/// @note Every try_ method does the same work as the throwing method of the same name and reports
+///       failure through a result instead, for hot paths that should not pay for exception
+///       handling. Called on a moved-from object, they report error_code::invalid_handle.
+template <class T>
+class [[nodiscard]] result {
+public:
+    using value_type = T;
+
+    result(T value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : m_storage{std::in_place_index<0>, std::move(value)} {
+    }
+
+    result(error_info err) noexcept : m_storage{std::in_place_index<1>, std::move(err)} {
+    }
+
+    /// Check whether the operation succeeded
+    [[nodiscard]] bool has_value() const noexcept {
+        return m_storage.index() == 0;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    /// Access the value, throwing laya::error if the operation failed
+    [[nodiscard]] T& value() & {
+        throw_if_failed();
+        return *std::get_if<0>(&m_storage);
+    }
+
+    [[nodiscard]] const T& value() const& {
+        throw_if_failed();
+        return *std::get_if<0>(&m_storage);
+    }
+
+    [[nodiscard]] T&& value() && {
+        throw_if_failed();
+        return std::move(*std::get_if<0>(&m_storage));
+    }
+
+    /// Access the value or use a default if the operation failed
+    template <class U>
+    [[nodiscard]] T value_or(U&& fallback) const& {
+        return has_value() ? *std::get_if<0>(&m_storage) : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    template <class U>
+    [[nodiscard]] T value_or(U&& fallback) && {
+        return has_value() ? std::move(*std::get_if<0>(&m_storage)) : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    /// Unchecked access, only valid when has_value() is true
+    [[nodiscard]] T& operator*() & noexcept {
+        return *std::get_if<0>(&m_storage);
+    }
+
+    [[nodiscard]] const T& operator*() const& noexcept {
+        return *std::get_if<0>(&m_storage);
+    }
+
+    [[nodiscard]] T* operator->() noexcept {
+        return std::get_if<0>(&m_storage);
+    }
+
+    [[nodiscard]] const T* operator->() const noexcept {
+        return std::get_if<0>(&m_storage);
+    }
+
+    /// Reason for the failure, only valid when has_value() is false
+    [[nodiscard]] const error_info& error() const noexcept {
+        return *std::get_if<1>(&m_storage);
+    }
+
+private:
+    void throw_if_failed() const {
+        if (const auto* err = std::get_if<1>(&m_storage)) {
+            throw err->to_error();
+        }
+    }
+
+    std::variant<T, error_info> m_storage;
+};
+
+/// Outcome of an operation that produces no value
+template <>
+class [[nodiscard]] result<void> {
+public:
+    using value_type = void;
+
+    result() noexcept = default;
+
+    result(error_info err) noexcept : m_error{std::move(err)} {
+    }
+
+    [[nodiscard]] bool has_value() const noexcept {
+        return !m_error.has_value();
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    /// Throw laya::error if the operation failed
+    void value() const {
+        if (m_error) {
+            throw m_error->to_error();
+        }
+    }
+
+    /// Reason for the failure, only valid when has_value() is false
+    [[nodiscard]] const error_info& error() const noexcept {
+        return *m_error;
+    }
+
+private:
+    std::optional<error_info> m_error;
+};
+
+// ============================================================================
+// error_info inline implementations
+// ============================================================================
+
+inline error_info::error_info(error_code code, const char* context, std::string detail,
+                              const std::source_location& location) noexcept
+    : m_detail{std::move(detail)}, m_location{location}, m_context{context}, m_code{code} {
+}
+
+inline error_code error_info::code() const noexcept {
+    return m_code;
+}
+
+inline const char* error_info::context() const noexcept {
+    return m_context;
+}
+
+inline const std::string& error_info::detail() const noexcept {
+    return m_detail;
+}
+
+inline const std::source_location& error_info::location() const noexcept {
+    return m_location;
+}
+
+}  // namespace laya
@@ -3,11 +3,18 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
 #include "bitmask.hpp"
+#include "result.hpp"
 
 namespace laya {
 
 enum class subsystem : unsigned {
+    none = 0x00000000u,       ///< no subsystems.
     audio = 0x00000010u,      ///< implies subsystem::events.
     video = 0x00000020u,      ///< implies subsystem::events, must be initialized on main thread.
     joystick = 0x00000200u,   ///< implies subsystem::events.
@@ -19,15 +26,61 @@ enum class subsystem : unsigned {
     everything = 0x0000FFFFu  ///< implies subsystem::everything.
 };
 
+/// Initialize subsystems, each one is reference counted and only the first reference calls SDL
 void create_subsystem(subsystem system);
+
+/// Release subsystems from create_subsystem(), the last reference shuts each one down
 void destroy_subsystem(subsystem system) noexcept;
+
 void destroy() noexcept;
 
 template <>
 struct enable_bitmask_operators<subsystem> : std::true_type {};
 
+// ============================================================================
+// Initialization on first use
+// ============================================================================
+
+/// Arguments for context creation
+struct context_args {
+    subsystem init = subsystem::none;          ///< Initialized by the constructor
+    subsystem on_first_use = subsystem::none;  ///< Initialized by the first laya call that needs them
+};
+
+/// Initialize the parts of `system` a live context deferred to first use
+/// @note A single atomic load when nothing is pending. laya calls it before creating windows,
+///       querying displays, opening joysticks or gamepads and polling events, so only call it
+///       before using SDL directly, e.g. for audio. Subsystems that no context deferred are
+///       left alone. Video must be initialized on the main thread.
+void use_subsystem(subsystem system);
+
+/// Same as use_subsystem(), reporting failure instead of throwing
+result<void> try_use_subsystem(subsystem system);
+
+/// Time the first SDL_InitSubSystem call for a subsystem took
+struct subsystem_timing {
+    subsystem system;                   ///< A single subsystem
+    std::chrono::nanoseconds duration;  ///< Includes implied subsystems not yet initialized
+    bool on_first_use;                  ///< Initialized by use_subsystem() rather than up front
+    std::uint32_t init_count;           ///< Times laya initialized it, counting each one after a shutdown
+};
+
+/// The first initialization of every subsystem laya has initialized, in call order
+/// @note Subsystems are initialized one at a time, events first, so each entry times one
+///       subsystem. Later initializations only bump init_count, so the list never grows past
+///       one entry per subsystem. Use it to find which subsystems are worth deferring to first use.
+[[nodiscard]] std::vector<subsystem_timing> subsystem_timings();
+
+/// Get the name of a single subsystem, e.g. "video"
+[[nodiscard]] std::string_view subsystem_name(subsystem system) noexcept;
+
 struct context {
+    /// Initialize `system` up front
     explicit context(subsystem system);
+
+    /// Initialize `args.init` up front and allow `args.on_first_use` to be initialized on demand
+    explicit context(const context_args& args);
+
     ~context() noexcept;
 
     context(const context&) = delete;
@@ -37,6 +90,7 @@ struct context {
 
 private:
     subsystem m_system;
+    subsystem m_on_first_use = subsystem::none;
 };
 
 }  // namespace laya
@@ -9,6 +9,7 @@
 #include <string_view>
 
 #include "../renderers/renderer_types.hpp"
+#include "../result.hpp"
 #include "../windows/window_flags.hpp"
 #include "pixel_format.hpp"
 #include "surface_flags.hpp"
@@ -62,6 +63,9 @@ public:
     /// Load surface from PNG file (requires SDL_image)
     [[nodiscard]] static surface load_png(std::string_view path);
 
+    /// Wrap a surface owned by SDL, such as a window surface, without taking ownership
+    [[nodiscard]] static surface borrow(SDL_Surface* surf) noexcept;
+
     // RAII
     ~surface() noexcept;
     surface(const surface&) = delete;
@@ -77,6 +81,14 @@ public:
     void blit(const surface& src, const rect& src_rect, const rect& dst_rect);
     void blit(const surface& src, point dst_pos);
 
+    // Non-throwing variants, failures are reported through laya::result instead
+    [[nodiscard]] static result<surface> try_create(const surface_args& args);
+    result<void> try_fill(color c);
+    result<void> try_fill_rect(const rect& r, color c);
+    result<void> try_fill_rects(std::span<const rect> rects, color c);
+    result<void> try_blit(const surface& src, const rect& src_rect, const rect& dst_rect);
+    result<void> try_blit(const surface& src, point dst_pos);
+
     // Transformations (return new surface)
     [[nodiscard]] surface convert(pixel_format format) const;
     [[nodiscard]] surface duplicate() const;
@@ -101,6 +113,9 @@ public:
     [[nodiscard]] pixel_format format() const noexcept;
     [[nodiscard]] bool must_lock() const noexcept;
 
+    /// Check if destroying this object also destroys the SDL surface
+    [[nodiscard]] bool owns_handle() const noexcept;
+
     // Low-level access
     [[nodiscard]] surface_lock_guard lock();
     void save_bmp(std::string_view path) const;
@@ -111,7 +126,8 @@ public:
 
 private:
     SDL_Surface* m_surface;
-    explicit surface(SDL_Surface* surf);  // For factory methods
+    bool m_owned{true};
+    explicit surface(SDL_Surface* surf, bool owned = true);  // For factory methods
 };
 
 }  // namespace laya
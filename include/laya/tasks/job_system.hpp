@@ -0,0 +1,201 @@
+/// @file job_system.hpp
+/// @brief Shared work-stealing thread pool for CPU-side work
+/// @date 2026-10-17
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "main_thread.hpp"
+
+namespace laya {
+
+namespace detail {
+struct job;
+struct job_worker;
+}  // namespace detail
+
+// ============================================================================
+// Job system configuration
+// ============================================================================
+
+/// Where a job may run
+enum class job_affinity : std::uint8_t {
+    any,          ///< Any worker thread, or a thread helping in wait()
+    main_thread,  ///< Only inside job_system::run_main_thread_jobs(), e.g. texture uploads
+};
+
+/// Arguments for job system creation
+struct job_system_args {
+    std::size_t thread_count = 0;  ///< Worker threads, 0 uses one less than the hardware threads
+};
+
+/// Counters collected while jobs run
+struct job_system_stats {
+    std::uint64_t jobs_executed = 0;          ///< Jobs run, including those run by helping threads
+    std::uint64_t steals = 0;                 ///< Jobs taken from another worker's deque
+    std::chrono::nanoseconds idle_time{0};  ///< Time workers spent asleep waiting for work
+};
+
+// ============================================================================
+// Job handle
+// ============================================================================
+
+/// Shared reference to a submitted job, used to wait on it or depend on it
+class job_handle {
+public:
+    job_handle() noexcept = default;
+
+    /// Check if the handle refers to a job
+    [[nodiscard]] bool valid() const noexcept;
+
+    /// Check if the job has finished running
+    /// @note An empty handle counts as done
+    [[nodiscard]] bool done() const noexcept;
+
+private:
+    friend class job_system;
+
+    explicit job_handle(std::shared_ptr<detail::job> job) noexcept;
+
+    std::shared_ptr<detail::job> m_job;
+};
+
+// ============================================================================
+// Job system
+// ============================================================================
+
+/// Work-stealing pool shared by CPU-heavy operations such as surface conversion and decoding
+/// @note Each worker owns a deque: it pushes and pops its own jobs at the back, idle workers steal
+///       from the front of the others. Jobs submitted from outside the pool are spread round-robin.
+///       A thread blocked in wait() or parallel_for() runs queued jobs instead of sleeping, so jobs
+///       may wait on other jobs. Create the job system on the main thread; that thread also runs
+///       main-thread jobs while it waits.
+class job_system {
+public:
+    /// Start the worker threads
+    explicit job_system(const job_system_args& args = {});
+
+    /// Finish queued jobs and join the worker threads
+    /// @note Jobs still waiting on dependencies or on run_main_thread_jobs() are dropped
+    ~job_system() noexcept;
+
+    job_system(const job_system&) = delete;
+    job_system& operator=(const job_system&) = delete;
+    job_system(job_system&&) = delete;
+    job_system& operator=(job_system&&) = delete;
+
+    /// Queue a job that runs once all of its dependencies have finished
+    /// @param fn Callable taking no arguments
+    /// @param dependencies Jobs that must finish first, empty handles are ignored
+    /// @param affinity Where the job may run
+    /// @note If a job throws, the exception is rethrown by wait() on its handle. Jobs depending on
+    ///       it still run.
+    template <task_callable F>
+    job_handle submit(F&& fn, std::initializer_list<job_handle> dependencies = {},
+                      job_affinity affinity = job_affinity::any);
+
+    template <task_callable F>
+    job_handle submit(F&& fn, std::span<const job_handle> dependencies, job_affinity affinity = job_affinity::any);
+
+    /// Block until a job has finished, running other queued jobs meanwhile
+    /// @throws Whatever the job threw
+    void wait(const job_handle& handle);
+
+    /// Split the rows [first, last) into chunks and run fn(row_begin, row_end) on each in parallel
+    /// @param grain Rows per chunk, 0 picks about four chunks per thread
+    /// @note The calling thread takes part and returns once every chunk has run. The first exception
+    ///       thrown by a chunk is rethrown after the rest have finished.
+    template <std::invocable<int, int> F>
+    void parallel_for(int first, int last, F&& fn, int grain = 0);
+
+    /// Run main-thread jobs that are ready, see main_thread_queue::drain()
+    /// @return Number of jobs run
+    std::size_t run_main_thread_jobs(std::chrono::nanoseconds budget = std::chrono::nanoseconds::max());
+
+    /// Number of worker threads
+    [[nodiscard]] std::size_t thread_count() const noexcept;
+
+    /// Counters summed over all workers and helping threads
+    [[nodiscard]] job_system_stats stats() const noexcept;
+
+    /// Counters of a single worker
+    [[nodiscard]] job_system_stats worker_stats(std::size_t index) const;
+
+    /// Reset every counter to zero
+    void reset_stats() noexcept;
+
+private:
+    using range_fn = void (*)(void* context, int row_begin, int row_end);
+
+    job_handle submit_task(std::unique_ptr<detail::task> work, std::span<const job_handle> dependencies,
+                           job_affinity affinity);
+    void run_parallel_for(int first, int last, int grain, range_fn fn, void* context);
+
+    void schedule(std::shared_ptr<detail::job> job);
+    void execute(detail::job& job, detail::job_worker& counters);
+    void finish(detail::job& job);
+
+    /// Pop a job from the calling worker's deque or steal one from another deque
+    [[nodiscard]] std::shared_ptr<detail::job> find_job(std::size_t own_index, detail::job_worker& counters);
+
+    /// Run one queued job on the calling thread, used while waiting
+    bool help_once();
+
+    void worker_loop(std::stop_token stop, std::size_t index);
+
+    std::vector<std::unique_ptr<detail::job_worker>> m_workers;
+    std::unique_ptr<detail::job_worker> m_external;  ///< Counters of threads outside the pool
+    std::atomic<std::size_t> m_next_worker{0};          ///< Round-robin target for outside submits
+    std::atomic<std::size_t> m_queued{0};               ///< Jobs sitting in the deques
+    std::atomic<std::size_t> m_sleeping{0};
+    std::mutex m_sleep_mutex;
+    std::condition_variable_any m_wake;
+    main_thread_queue m_main_jobs;
+    std::thread::id m_main_thread;
+    std::vector<std::jthread> m_threads;  ///< Last, so workers stop before the state they use goes away
+};
+
+// ============================================================================
+// job_system inline implementations
+// ============================================================================
+
+template <task_callable F>
+job_handle job_system::submit(F&& fn, std::initializer_list<job_handle> dependencies, job_affinity affinity) {
+    return submit_task(detail::make_task(std::forward<F>(fn)),
+                       std::span<const job_handle>{dependencies.begin(), dependencies.size()}, affinity);
+}
+
+template <task_callable F>
+job_handle job_system::submit(F&& fn, std::span<const job_handle> dependencies, job_affinity affinity) {
+    return submit_task(detail::make_task(std::forward<F>(fn)), dependencies, affinity);
+}
+
+template <std::invocable<int, int> F>
+void job_system::parallel_for(int first, int last, F&& fn, int grain) {
+    using fn_type = std::remove_reference_t<F>;
+    run_parallel_for(
+        first, last, grain,
+        [](void* context, int row_begin, int row_end) { (*static_cast<fn_type*>(context))(row_begin, row_end); },
+        const_cast<void*>(static_cast<const void*>(std::addressof(fn))));
+}
+
+inline std::size_t job_system::thread_count() const noexcept {
+    return m_workers.size();
+}
+
+}  // namespace laya
@@ -0,0 +1,195 @@
+/// @file main_thread.hpp
+/// @brief Hand work from worker threads to the main thread
+/// @date 2026-10-17
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace laya {
+
+/// Check if the calling thread is the main thread
+/// @note SDL requires window, renderer and texture calls to be made from the main thread
+[[nodiscard]] bool is_main_thread() noexcept;
+
+/// Callable that can be moved to another thread and run there without arguments
+template <class F>
+concept task_callable = std::is_invocable_v<std::decay_t<F>&> && std::is_constructible_v<std::decay_t<F>, F>;
+
+namespace detail {
+
+/// Type-erased callable shared by the task queues, linked intrusively while queued
+struct task {
+    task* next = nullptr;
+
+    virtual ~task() = default;
+    virtual void run() = 0;
+};
+
+template <class F>
+struct task_impl final : task {
+    template <class U>
+    explicit task_impl(U&& f) : fn(std::forward<U>(f)) {
+    }
+
+    void run() override {
+        fn();
+    }
+
+    F fn;
+};
+
+template <class F>
+std::unique_ptr<task> make_task(F&& fn) {
+    return std::make_unique<task_impl<std::decay_t<F>>>(std::forward<F>(fn));
+}
+
+/// Pass a task to SDL_RunOnMainThread, which takes ownership of it
+void run_on_main_thread(std::unique_ptr<task> work, bool wait);
+
+}  // namespace detail
+
+/// Run a callable on the main thread through SDL_RunOnMainThread
+/// @param fn Callable taking no arguments, moved to the main thread
+/// @param wait Block until the callable has run
+/// @note Runs immediately when called from the main thread. Otherwise SDL runs the callable the
+///       next time the main thread pumps events. Exceptions thrown by the callable are logged and
+///       dropped, since they cannot cross SDL's callback.
+/// @throws laya::error if SDL cannot queue the callable
+template <task_callable F>
+void run_on_main_thread(F&& fn, bool wait = false) {
+    detail::run_on_main_thread(detail::make_task(std::forward<F>(fn)), wait);
+}
+
+class main_thread_queue;
+
+/// Tasks gathered on one thread and handed to a main_thread_queue in a single push
+/// @note Not thread-safe; each producer fills its own batch. Tasks keep the order they were added in.
+class main_thread_batch {
+public:
+    main_thread_batch() noexcept = default;
+
+    /// Destroy tasks that were never pushed without running them
+    ~main_thread_batch() noexcept;
+
+    main_thread_batch(const main_thread_batch&) = delete;
+    main_thread_batch& operator=(const main_thread_batch&) = delete;
+    main_thread_batch(main_thread_batch&& other) noexcept;
+    main_thread_batch& operator=(main_thread_batch&& other) noexcept;
+
+    /// Add a callable to the end of the batch
+    template <task_callable F>
+    void add(F&& fn);
+
+    /// Number of tasks in the batch
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Check if the batch holds no tasks
+    [[nodiscard]] bool empty() const noexcept;
+
+private:
+    friend class main_thread_queue;
+
+    void add_task(std::unique_ptr<detail::task> task) noexcept;
+
+    detail::task* m_newest = nullptr;  ///< Linked newest first, like the queue's incoming list
+    detail::task* m_oldest = nullptr;
+    std::size_t m_size = 0;
+};
+
+/// Batched queue of tasks for the main thread, filled from any thread
+/// @note push() is lock-free: tasks are prepended to an atomic list, and a main_thread_batch is
+///       spliced in with the same single compare-exchange. drain() takes the whole list with one
+///       exchange, so producers and the main thread never wait on each other and a frame pays one
+///       atomic operation for the batch, not one lock per item. Unlike run_on_main_thread(),
+///       nothing runs until the application calls drain(), typically once per frame with a time
+///       budget so a burst of uploads cannot stall a frame.
+class main_thread_queue {
+public:
+    main_thread_queue() noexcept = default;
+
+    /// Destroy pending tasks without running them
+    ~main_thread_queue() noexcept;
+
+    main_thread_queue(const main_thread_queue&) = delete;
+    main_thread_queue& operator=(const main_thread_queue&) = delete;
+    main_thread_queue(main_thread_queue&&) = delete;
+    main_thread_queue& operator=(main_thread_queue&&) = delete;
+
+    /// Queue a callable from any thread
+    template <task_callable F>
+    void push(F&& fn);
+
+    /// Queue every task of a batch from any thread, leaving the batch empty
+    void push(main_thread_batch&& batch) noexcept;
+
+    /// Run queued tasks in the order they were pushed, on the calling (main) thread
+    /// @param budget Stop starting new tasks once this much time has passed. At least one task
+    ///        runs per call so the queue always makes progress.
+    /// @return Number of tasks run
+    /// @note Tasks left over when the budget runs out stay first in line for the next call. If a
+    ///       task throws, the exception propagates and the remaining tasks stay queued.
+    std::size_t drain(std::chrono::nanoseconds budget = std::chrono::nanoseconds::max());
+
+    /// Number of tasks queued and not yet run
+    /// @note Approximate while other threads are pushing, tasks are counted just before they are queued
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Check if no tasks are queued
+    [[nodiscard]] bool empty() const noexcept;
+
+private:
+    void push_task(std::unique_ptr<detail::task> task) noexcept;
+
+    /// Prepend the already linked list newest..oldest holding count tasks
+    void push_list(detail::task* newest, detail::task* oldest, std::size_t count) noexcept;
+
+    /// Move newly pushed tasks, newest first, behind the ready list in push order
+    void collect() noexcept;
+
+    std::atomic<detail::task*> m_incoming{nullptr};  ///< Written by any thread
+    std::atomic<std::size_t> m_size{0};
+    detail::task* m_ready = nullptr;  ///< Main thread only, oldest first
+    detail::task* m_ready_tail = nullptr;
+};
+
+// ============================================================================
+// main_thread_batch inline implementations
+// ============================================================================
+
+template <task_callable F>
+void main_thread_batch::add(F&& fn) {
+    add_task(detail::make_task(std::forward<F>(fn)));
+}
+
+inline std::size_t main_thread_batch::size() const noexcept {
+    return m_size;
+}
+
+inline bool main_thread_batch::empty() const noexcept {
+    return m_size == 0;
+}
+
+// ============================================================================
+// main_thread_queue inline implementations
+// ============================================================================
+
+template <task_callable F>
+void main_thread_queue::push(F&& fn) {
+    push_task(detail::make_task(std::forward<F>(fn)));
+}
+
+inline std::size_t main_thread_queue::size() const noexcept {
+    return m_size.load(std::memory_order_relaxed);
+}
+
+inline bool main_thread_queue::empty() const noexcept {
+    return size() == 0;
+}
+
+}  // namespace laya
@@ -8,6 +8,7 @@
 #include <laya/surfaces/surface.hpp>
 #include <laya/textures/texture_access.hpp>
 #include <laya/renderers/renderer_types.hpp>
+#include <laya/result.hpp>
 
 #include <SDL3/SDL.h>
 #include <cstdint>
@@ -61,6 +62,11 @@ public:
     [[nodiscard]] int pitch() const noexcept;
 
 private:
+    /// Adopt a lock taken by texture::try_lock.
+    texture_lock_guard(class texture* tex, void* pixels, int pitch) noexcept;
+
+    friend class texture;
+
     class texture* m_texture{nullptr};
     void* m_pixels{nullptr};
     int m_pitch{0};
@@ -220,6 +226,43 @@ public:
     /// \throws laya::error if the texture cannot be locked.
     texture_lock_guard lock(const rect& r);
 
+    // ========================================================================
+    // Non-throwing operations
+    // ========================================================================
+    /// Creates a texture, reporting failure instead of throwing.
+    /// \param renderer Renderer to create the texture for.
+    /// \param args Texture creation arguments.
+    [[nodiscard]] static result<texture> try_create(const class renderer& renderer, const texture_args& args);
+
+    /// Creates a texture from a surface, reporting failure instead of throwing.
+    /// \param renderer Renderer to create the texture for.
+    /// \param surf Surface to create texture from.
+    [[nodiscard]] static result<texture> try_from_surface(const class renderer& renderer, const surface& surf);
+
+    /// Updates texture pixels from raw data, reporting failure instead of throwing.
+    result<void> try_update(const void* pixels, int pitch);
+
+    /// Updates a rectangular region of texture pixels, reporting failure instead of throwing.
+    result<void> try_update(const rect& r, const void* pixels, int pitch);
+
+    /// Updates texture pixels from a surface, reporting failure instead of throwing.
+    result<void> try_update(const surface& surf);
+
+    /// Locks the texture for direct pixel access, reporting failure instead of throwing.
+    result<texture_lock_guard> try_lock();
+
+    /// Locks a rectangular region for direct pixel access, reporting failure instead of throwing.
+    result<texture_lock_guard> try_lock(const rect& r);
+
+    /// Sets alpha modulation, reporting failure instead of throwing.
+    result<void> try_set_alpha_mod(std::uint8_t alpha);
+
+    /// Sets color modulation, reporting failure instead of throwing.
+    result<void> try_set_color_mod(color c);
+
+    /// Sets blend mode, reporting failure instead of throwing.
+    result<void> try_set_blend_mode(blend_mode mode);
+
     // ========================================================================
     // Query methods
     // ========================================================================
@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
+#include <span>
 #include <string_view>
 
+#include "../events/event_window.hpp"
+#include "../renderers/renderer_types.hpp"
+#include "../result.hpp"
 #include "window_flags.hpp"
 #include "window_id.hpp"
 
@@ -10,12 +15,35 @@ struct SDL_Window;
 
 namespace laya {
 
+class surface;
+
+/// How a window answers geometry and state queries
+enum class window_state_cache : std::uint8_t {
+    none,     ///< Every getter queries SDL
+    events,   ///< Getters read a cache kept current by window::handle()
+    checked,  ///< Like events, but every read is compared against SDL and mismatches are logged
+};
+
+/// Window geometry and state as last reported by SDL
+struct window_state {
+    position pos{0, 0};
+    dimensions size{0, 0};        ///< Size in screen coordinates
+    dimensions pixel_size{0, 0};  ///< Size in pixels
+    dimensions minimum_size{0, 0};
+    float opacity = 1.0f;
+    bool shown = false;
+    bool minimized = false;
+    bool maximized = false;
+    bool focused = false;
+};
+
 /// Arguments for window creation
 struct window_args {
     std::string_view title;
     dimensions size{800, 600};
     std::optional<position> initial_position;  ///< Optional initial position
     window_flags flags = window_flags::none;
+    window_state_cache cache = window_state_cache::none;
 };
 
 /// RAII wrapper for SDL_Window
@@ -49,13 +77,13 @@ public:
     void set_size(dimensions size);
 
     /// Get the window size
-    dimensions get_size() const;
+    [[nodiscard]] dimensions get_size() const;
 
     /// Set the window position
     void set_position(position pos);
 
     /// Get the window position
-    position get_position() const;
+    [[nodiscard]] position get_position() const;
 
     /// Maximize the window
     void maximize();
@@ -102,6 +130,67 @@ public:
     /// Enable or disable keyboard grab
     void set_keyboard_grab(bool grab);
 
+    /// Get the window's software framebuffer for CPU rendering
+    /// @note The surface is owned by the window and must not outlive it. SDL recreates it when the
+    ///       window is resized, so fetch it again after a resize. A window cannot use both a surface
+    ///       and a renderer.
+    /// @throws laya::error if the surface cannot be created
+    [[nodiscard]] laya::surface surface();
+
+    /// Copy the whole window surface to the screen
+    void update_surface();
+
+    /// Copy only the given regions of the window surface to the screen
+    /// @note Cheaper than update_surface() when little of the window changed between frames
+    void update_surface_rects(std::span<const rect> rects);
+
+    /// Choose how geometry and state getters are answered
+    /// @note Enabling the cache queries SDL once to fill it. From then on get_size(), get_position(),
+    ///       get_minimum_size() and get_opacity() are field reads, as long as every window event is
+    ///       passed to handle(). Setters refresh the cache from SDL after a successful call, so a
+    ///       getter right after a setter returns what SDL reports at that point. Window systems that
+    ///       apply changes asynchronously report the final value later through an event.
+    /// @throws laya::error if the window state cannot be queried
+    void set_state_cache(window_state_cache mode);
+
+    /// Current caching mode
+    [[nodiscard]] window_state_cache state_cache() const noexcept;
+
+    /// Update the cached state from a window event
+    /// @return True if the event belongs to this window and the cache is enabled
+    bool handle(const window_event& ev) noexcept;
+
+    /// Geometry and state of the window, from the cache if enabled
+    /// @throws laya::error if the cache is disabled and the state cannot be queried
+    [[nodiscard]] window_state state() const;
+
+    // ========================================================================
+    // Non-throwing operations
+    // ========================================================================
+    /// Create a window, reporting failure instead of throwing
+    [[nodiscard]] static result<window> try_create(const window_args& args);
+
+    /// Show the window, reporting failure instead of throwing
+    result<void> try_show();
+
+    /// Hide the window, reporting failure instead of throwing
+    result<void> try_hide();
+
+    /// Set the window title, reporting failure instead of throwing
+    result<void> try_set_title(std::string_view title);
+
+    /// Set the window size, reporting failure instead of throwing
+    result<void> try_set_size(dimensions size);
+
+    /// Set the window position, reporting failure instead of throwing
+    result<void> try_set_position(position pos);
+
+    /// Copy the whole window surface to the screen, reporting failure instead of throwing
+    result<void> try_update_surface();
+
+    /// Copy the given regions of the window surface to the screen, reporting failure instead of throwing
+    result<void> try_update_surface_rects(std::span<const rect> rects);
+
     /// Get the window ID for event correlation
     [[nodiscard]] window_id id() const noexcept;
 
@@ -112,10 +201,28 @@ public:
     [[nodiscard]] bool is_valid() const noexcept;
 
 private:
+    /// Take ownership of a created SDL window
+    explicit window(SDL_Window* handle) noexcept;
+
     [[nodiscard]] SDL_Window* ensure_handle() const;
 
+    /// Query every cached field from SDL
+    [[nodiscard]] window_state query_state() const;
+    [[nodiscard]] result<window_state> try_query_state() const;
+
+    /// Re-query the cache after a setter, so getters do not wait for the matching event
+    void refresh_state_cache() noexcept;
+
+    // SDL queries behind the getters, `checked` mode compares them against the cache
+    [[nodiscard]] dimensions query_size() const;
+    [[nodiscard]] position query_position() const;
+    [[nodiscard]] dimensions query_minimum_size() const;
+    [[nodiscard]] float query_opacity() const;
+
     SDL_Window* m_window;
     window_id m_id;  ///< Cache this because it never changes.
+    window_state_cache m_cache_mode;
+    window_state m_state;  ///< Only meaningful when m_cache_mode is not none
 };
 
 // ============================================================================
@@ -130,4 +237,24 @@ inline SDL_Window* window::native_handle() const noexcept {
     return m_window;
 }
 
+inline window_state_cache window::state_cache() const noexcept {
+    return m_cache_mode;
+}
+
+inline dimensions window::get_size() const {
+    return m_cache_mode == window_state_cache::events ? m_state.size : query_size();
+}
+
+inline position window::get_position() const {
+    return m_cache_mode == window_state_cache::events ? m_state.pos : query_position();
+}
+
+inline dimensions window::get_minimum_size() const {
+    return m_cache_mode == window_state_cache::events ? m_state.minimum_size : query_minimum_size();
+}
+
+inline float window::get_opacity() const {
+    return m_cache_mode == window_state_cache::events ? m_state.opacity : query_opacity();
+}
+
 }  // namespace laya
@@ -0,0 +1,199 @@
+/// @file window_registry.hpp
+/// @brief Owning container of windows and their renderers with O(1) lookup by window id
+/// @date 2026-10-17
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "../events/event_types.hpp"
+#include "../renderers/renderer.hpp"
+#include "window.hpp"
+
+namespace laya {
+
+/// Stable reference to a window owned by a window_registry
+/// @note A handle stays valid until its window is destroyed, even as other windows come and go.
+///       Afterwards it is stale: lookups return null instead of reaching a window that reused the slot.
+struct window_handle {
+    std::uint32_t index = 0;
+    std::uint32_t generation = 0;  ///< 0 is never used by a live slot
+
+    [[nodiscard]] constexpr bool is_valid() const noexcept;
+    [[nodiscard]] constexpr bool operator==(const window_handle&) const noexcept = default;
+};
+
+/// Owns windows and their optional renderers in a slot map
+/// @note Lookups by handle index straight into the slot array. Lookups by window_id (the id every
+///       window event carries) go through a hash map, so routing an event to its window does not
+///       scan every window.
+/// @note Handles are stable, but pointers returned by get() are invalidated by create() and insert().
+class window_registry {
+public:
+    window_registry() = default;
+
+    // Non-copyable, movable
+    window_registry(const window_registry&) = delete;
+    window_registry& operator=(const window_registry&) = delete;
+    window_registry(window_registry&&) noexcept = default;
+    window_registry& operator=(window_registry&&) noexcept = default;
+
+    /// Create a window owned by the registry
+    /// @throws laya::error if the window cannot be created
+    window_handle create(const window_args& args);
+
+    /// Create a window and a renderer for it
+    /// @throws laya::error if the window or renderer cannot be created
+    window_handle create(const window_args& args, const renderer_args& render_args);
+
+    /// Take ownership of an existing window
+    /// @throws laya::error if the window is not valid
+    window_handle insert(window&& win);
+
+    /// Create or replace the renderer of a window
+    /// @throws laya::error if the handle is stale or the renderer cannot be created
+    renderer& create_renderer(window_handle handle, const renderer_args& args = {});
+
+    /// Destroy a window and its renderer
+    /// @return True if the handle referred to a live window
+    bool destroy(window_handle handle) noexcept;
+
+    /// Destroy every window
+    void clear() noexcept;
+
+    /// Check if a handle refers to a live window
+    [[nodiscard]] bool contains(window_handle handle) const noexcept;
+
+    /// Handle of the window with the given id
+    /// @return An invalid handle if no registered window has this id
+    [[nodiscard]] window_handle find(window_id id) const noexcept;
+
+    /// Window behind a handle, or nullptr if the handle is stale
+    [[nodiscard]] window* get(window_handle handle) noexcept;
+    [[nodiscard]] const window* get(window_handle handle) const noexcept;
+
+    /// Window with the given id, or nullptr if it is not registered
+    [[nodiscard]] window* get(window_id id) noexcept;
+    [[nodiscard]] const window* get(window_id id) const noexcept;
+
+    /// Renderer of a window, or nullptr if the handle is stale or the window has no renderer
+    [[nodiscard]] renderer* get_renderer(window_handle handle) noexcept;
+    [[nodiscard]] const renderer* get_renderer(window_handle handle) const noexcept;
+
+    /// Forward a window event to the window it belongs to (see window::handle)
+    /// @return True if the event is a window event for a registered window
+    bool handle(const event& ev) noexcept;
+
+    /// Show every window
+    void show_all();
+
+    /// Hide every window
+    void hide_all();
+
+    /// Clear every renderer with its current draw color
+    void clear_all();
+
+    /// Present every renderer
+    void present_all();
+
+    /// Call `fn(window_handle, window&, renderer*)` for every live window
+    template <class Fn>
+    void for_each(Fn&& fn);
+
+    /// Number of live windows
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// Check if the registry holds no windows
+    [[nodiscard]] bool empty() const noexcept;
+
+private:
+    // The renderer is declared after the window so it is destroyed first
+    struct slot {
+        std::optional<window> win;
+        std::optional<renderer> rend;
+        std::uint32_t generation = 1;
+    };
+
+    [[nodiscard]] slot* find_slot(window_handle handle) noexcept;
+    [[nodiscard]] const slot* find_slot(window_handle handle) const noexcept;
+
+    std::vector<slot> m_slots;
+    std::vector<std::uint32_t> m_free;                       ///< Indices of empty slots
+    std::unordered_map<std::uint32_t, std::uint32_t> m_ids;  ///< window_id value to slot index
+};
+
+// ============================================================================
+// window_handle inline implementations
+// ============================================================================
+
+constexpr bool window_handle::is_valid() const noexcept {
+    return generation != 0;
+}
+
+// ============================================================================
+// window_registry inline implementations
+// ============================================================================
+
+inline window* window_registry::get(window_handle handle) noexcept {
+    slot* s = find_slot(handle);
+    return s ? &*s->win : nullptr;
+}
+
+inline const window* window_registry::get(window_handle handle) const noexcept {
+    const slot* s = find_slot(handle);
+    return s ? &*s->win : nullptr;
+}
+
+inline renderer* window_registry::get_renderer(window_handle handle) noexcept {
+    slot* s = find_slot(handle);
+    return s && s->rend ? &*s->rend : nullptr;
+}
+
+inline const renderer* window_registry::get_renderer(window_handle handle) const noexcept {
+    const slot* s = find_slot(handle);
+    return s && s->rend ? &*s->rend : nullptr;
+}
+
+inline bool window_registry::contains(window_handle handle) const noexcept {
+    return find_slot(handle) != nullptr;
+}
+
+inline std::size_t window_registry::size() const noexcept {
+    return m_ids.size();
+}
+
+inline bool window_registry::empty() const noexcept {
+    return m_ids.empty();
+}
+
+template <class Fn>
+void window_registry::for_each(Fn&& fn) {
+    for (std::size_t i = 0; i < m_slots.size(); ++i) {
+        auto& s = m_slots[i];
+        if (s.win) {
+            fn(window_handle{static_cast<std::uint32_t>(i), s.generation}, *s.win, s.rend ? &*s.rend : nullptr);
+        }
+    }
+}
+
+inline window_registry::slot* window_registry::find_slot(window_handle handle) noexcept {
+    if (handle.index >= m_slots.size()) {
+        return nullptr;
+    }
+    slot& s = m_slots[handle.index];
+    return s.win && s.generation == handle.generation ? &s : nullptr;
+}
+
+inline const window_registry::slot* window_registry::find_slot(window_handle handle) const noexcept {
+    if (handle.index >= m_slots.size()) {
+        return nullptr;
+    }
+    const slot& s = m_slots[handle.index];
+    return s.win && s.generation == handle.generation ? &s : nullptr;
+}
+
+}  // namespace laya
@@ -35,7 +35,7 @@ fi
 
 echo ""
 info "[2/3] Building benchmarks (Release mode)..."
-if cmake --build "$BUILD_DIR" --target laya_tests_benchmark -j"$(nproc)" 2>&1 | \
+if cmake --build "$BUILD_DIR" --target laya_tests_benchmark laya_bench_compare -j"$(nproc)" 2>&1 | \
     grep -E "Built target|Building|Linking|error|warning" || true; then
     success "Build successful"
 else
@@ -63,6 +63,9 @@ echo ""
 printf '%bBuild Mode:%b      Release (optimizations enabled)\n' "$YELLOW" "$RESET"
 printf '%bBuild Dir:%b       %s\n' "$YELLOW" "$RESET" "$BUILD_DIR"
 printf '%bTest Suite:%b      benchmark\n' "$YELLOW" "$RESET"
+if [ -n "${LAYA_BENCH_RESULTS:-}" ]; then
+    printf '%bResults:%b         %s\n' "$YELLOW" "$RESET" "$LAYA_BENCH_RESULTS"
+fi
 echo ""
 
 if [ $BENCHMARK_RESULT -eq 0 ]; then
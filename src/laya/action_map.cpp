@@ -0,0 +1,55 @@
+/// @file action_map.cpp
+/// @date 2026-10-17
+
+#include <algorithm>
+
+#include <laya/input/action_map.hpp>
+
+namespace laya {
+
+// ============================================================================
+// action_inputs implementation
+// ============================================================================
+
+action_inputs action_inputs::from(const keyboard_snapshot& keyboard, key_modifier modifiers, mouse_button_mask mouse,
+                                  std::uint32_t gamepad_buttons) noexcept {
+    return action_inputs{keyboard.held_keys(), modifiers, mouse, gamepad_buttons};
+}
+
+// ============================================================================
+// action_map implementation
+// ============================================================================
+
+void action_map::bind(const action_binding& binding) {
+    // Keep the table sorted so it has the same layout as a static_action_map
+    const auto it = std::lower_bound(m_bindings.begin(), m_bindings.end(), binding, detail::binding_less);
+    if (it != m_bindings.end() && *it == binding) {
+        return;
+    }
+    m_bindings.insert(it, binding);
+}
+
+bool action_map::unbind(const action_binding& binding) noexcept {
+    const auto it = std::lower_bound(m_bindings.begin(), m_bindings.end(), binding, detail::binding_less);
+    if (it == m_bindings.end() || *it != binding) {
+        return false;
+    }
+    m_bindings.erase(it);
+    return true;
+}
+
+void action_map::rebind(const action_binding& binding) {
+    unbind_index(binding.action);
+    bind(binding);
+}
+
+void action_map::clear() noexcept {
+    m_bindings.clear();
+}
+
+std::size_t action_map::unbind_index(std::uint8_t action) noexcept {
+    return static_cast<std::size_t>(
+        std::erase_if(m_bindings, [action](const action_binding& binding) { return binding.action == action; }));
+}
+
+}  // namespace laya
@@ -0,0 +1,324 @@
+/// @file command_list.cpp
+/// @date 2026-10-17
+
+#include <laya/renderers/command_list.hpp>
+#include <laya/renderers/renderer.hpp>
+#include <laya/textures/texture.hpp>
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+// Replay hands the pools to SDL without converting them
+static_assert(sizeof(detail::recorded_rect) == sizeof(SDL_FRect));
+static_assert(sizeof(point_f) == sizeof(SDL_FPoint));
+
+namespace {
+
+detail::recorded_rect to_recorded(const rect& r) noexcept {
+    return {static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.w), static_cast<float>(r.h)};
+}
+
+point_f to_recorded(point p) noexcept {
+    return {static_cast<float>(p.x), static_cast<float>(p.y)};
+}
+
+const SDL_FRect* as_sdl(const detail::recorded_rect* r) noexcept {
+    return reinterpret_cast<const SDL_FRect*>(r);
+}
+
+const SDL_FPoint* as_sdl(const point_f* p) noexcept {
+    return reinterpret_cast<const SDL_FPoint*>(p);
+}
+
+std::uint32_t pack(color c) noexcept {
+    return (std::uint32_t{c.r} << 24) | (std::uint32_t{c.g} << 16) | (std::uint32_t{c.b} << 8) | std::uint32_t{c.a};
+}
+
+color unpack(std::uint32_t packed) noexcept {
+    return {static_cast<std::uint8_t>(packed >> 24), static_cast<std::uint8_t>(packed >> 16),
+            static_cast<std::uint8_t>(packed >> 8), static_cast<std::uint8_t>(packed)};
+}
+
+}  // namespace
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void command_list::append_batched(op type, std::uint32_t first, std::uint32_t count) {
+    if (!m_commands.empty()) {
+        auto& last = m_commands.back();
+        if (last.type == type && last.first + last.count == first) {
+            last.count += count;
+            return;
+        }
+    }
+    m_commands.push_back({type, first, count});
+}
+
+void command_list::clear() {
+    m_commands.push_back({op::clear, 0, 0});
+}
+
+void command_list::set_draw_color(color c) {
+    m_commands.push_back({op::set_draw_color, pack(c), 0});
+}
+
+void command_list::set_blend_mode(blend_mode mode) {
+    m_commands.push_back({op::set_blend_mode, static_cast<std::uint32_t>(mode), 0});
+}
+
+void command_list::set_viewport(const rect& viewport) {
+    m_commands.push_back({op::set_viewport, static_cast<std::uint32_t>(m_rects.size()), 1});
+    m_rects.push_back(to_recorded(viewport));
+}
+
+void command_list::reset_viewport() {
+    m_commands.push_back({op::reset_viewport, 0, 0});
+}
+
+void command_list::draw_point(point p) {
+    draw_points(&p, 1);
+}
+
+void command_list::draw_points(const point* points, int count) {
+    if (count <= 0 || !points) {
+        return;
+    }
+    const auto first = static_cast<std::uint32_t>(m_points.size());
+    for (int i = 0; i < count; ++i) {
+        m_points.push_back(to_recorded(points[i]));
+    }
+    append_batched(op::draw_points, first, static_cast<std::uint32_t>(count));
+}
+
+void command_list::draw_line(point from, point to) {
+    const point ends[] = {from, to};
+    draw_lines(ends, 2);
+}
+
+void command_list::draw_lines(const point* points, int count) {
+    if (count <= 1 || !points) {
+        return;
+    }
+    // Never merged, the next series must not connect to this one
+    const auto first = static_cast<std::uint32_t>(m_points.size());
+    for (int i = 0; i < count; ++i) {
+        m_points.push_back(to_recorded(points[i]));
+    }
+    m_commands.push_back({op::draw_lines, first, static_cast<std::uint32_t>(count)});
+}
+
+void command_list::draw_rect(const rect& r) {
+    draw_rects(&r, 1);
+}
+
+void command_list::draw_rects(const rect* rects, int count) {
+    if (count <= 0 || !rects) {
+        return;
+    }
+    const auto first = static_cast<std::uint32_t>(m_rects.size());
+    for (int i = 0; i < count; ++i) {
+        m_rects.push_back(to_recorded(rects[i]));
+    }
+    append_batched(op::draw_rects, first, static_cast<std::uint32_t>(count));
+}
+
+void command_list::fill_rect(const rect& r) {
+    fill_rects(&r, 1);
+}
+
+void command_list::fill_rects(const rect* rects, int count) {
+    if (count <= 0 || !rects) {
+        return;
+    }
+    const auto first = static_cast<std::uint32_t>(m_rects.size());
+    for (int i = 0; i < count; ++i) {
+        m_rects.push_back(to_recorded(rects[i]));
+    }
+    append_batched(op::fill_rects, first, static_cast<std::uint32_t>(count));
+}
+
+void command_list::record_copy(const texture& tex, const rect* src_rect, const rect& dst_rect, double angle,
+                               const point* center, flip_mode flip) {
+    detail::recorded_copy copy{};
+    copy.texture = tex.native_handle();
+    copy.has_src = src_rect != nullptr;
+    if (src_rect) {
+        copy.src = to_recorded(*src_rect);
+    }
+    copy.dst = to_recorded(dst_rect);
+    copy.has_center = center != nullptr;
+    if (center) {
+        copy.center = to_recorded(*center);
+    }
+    copy.angle = angle;
+    copy.flip = flip;
+
+    m_commands.push_back({op::render_texture, static_cast<std::uint32_t>(m_copies.size()), 1});
+    m_copies.push_back(copy);
+}
+
+void command_list::render(const texture& tex, point dst_pos) {
+    const auto tex_size = tex.size();
+    record_copy(tex, nullptr, rect{dst_pos.x, dst_pos.y, tex_size.width, tex_size.height}, 0.0, nullptr,
+                flip_mode::none);
+}
+
+void command_list::render(const texture& tex, const rect& dst_rect) {
+    record_copy(tex, nullptr, dst_rect, 0.0, nullptr, flip_mode::none);
+}
+
+void command_list::render(const texture& tex, const rect& src_rect, const rect& dst_rect) {
+    record_copy(tex, &src_rect, dst_rect, 0.0, nullptr, flip_mode::none);
+}
+
+void command_list::render(const texture& tex, const rect& dst_rect, double angle) {
+    record_copy(tex, nullptr, dst_rect, angle, nullptr, flip_mode::none);
+}
+
+void command_list::render(const texture& tex, const rect& src_rect, const rect& dst_rect, double angle, point center,
+                          flip_mode flip) {
+    record_copy(tex, &src_rect, dst_rect, angle, &center, flip);
+}
+
+void command_list::render(const texture& tex, const rect& dst_rect, flip_mode flip) {
+    record_copy(tex, nullptr, dst_rect, 0.0, nullptr, flip);
+}
+
+// ============================================================================
+// Combining lists
+// ============================================================================
+
+void command_list::append(const command_list& other) {
+    const auto point_base = static_cast<std::uint32_t>(m_points.size());
+    const auto rect_base = static_cast<std::uint32_t>(m_rects.size());
+    const auto copy_base = static_cast<std::uint32_t>(m_copies.size());
+
+    m_points.insert(m_points.end(), other.m_points.begin(), other.m_points.end());
+    m_rects.insert(m_rects.end(), other.m_rects.begin(), other.m_rects.end());
+    m_copies.insert(m_copies.end(), other.m_copies.begin(), other.m_copies.end());
+
+    for (const auto& cmd : other.m_commands) {
+        switch (cmd.type) {
+            case op::draw_points:
+            case op::draw_rects:
+            case op::fill_rects: {
+                const std::uint32_t base = cmd.type == op::draw_points ? point_base : rect_base;
+                append_batched(cmd.type, base + cmd.first, cmd.count);
+                break;
+            }
+            case op::draw_lines:
+                m_commands.push_back({cmd.type, point_base + cmd.first, cmd.count});
+                break;
+            case op::set_viewport:
+                m_commands.push_back({cmd.type, rect_base + cmd.first, cmd.count});
+                break;
+            case op::render_texture:
+                m_commands.push_back({cmd.type, copy_base + cmd.first, cmd.count});
+                break;
+            case op::clear:
+            case op::set_draw_color:
+            case op::set_blend_mode:
+            case op::reset_viewport:
+                m_commands.push_back(cmd);
+                break;
+        }
+    }
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+void command_list::replay(renderer& r) const {
+    try_replay(r).value();
+}
+
+result<void> command_list::try_replay(renderer& r) const {
+    SDL_Renderer* const sdl = r.native_handle();
+
+    for (const auto& cmd : m_commands) {
+        switch (cmd.type) {
+            case op::clear:
+                if (auto res = r.try_clear(); !res) {
+                    return res;
+                }
+                break;
+            case op::set_draw_color:
+                if (auto res = r.try_set_draw_color(unpack(cmd.first)); !res) {
+                    return res;
+                }
+                break;
+            case op::set_blend_mode:
+                if (auto res = r.try_set_blend_mode(static_cast<blend_mode>(cmd.first)); !res) {
+                    return res;
+                }
+                break;
+            case op::set_viewport: {
+                const auto& v = m_rects[cmd.first];
+                const SDL_Rect viewport{static_cast<int>(v.x), static_cast<int>(v.y), static_cast<int>(v.w),
+                                        static_cast<int>(v.h)};
+                if (!SDL_SetRenderViewport(sdl, &viewport)) {
+                    return error_info::from_sdl("Failed to set viewport");
+                }
+                break;
+            }
+            case op::reset_viewport:
+                if (!SDL_SetRenderViewport(sdl, nullptr)) {
+                    return error_info::from_sdl("Failed to reset viewport");
+                }
+                break;
+            case op::draw_points:
+                if (!SDL_RenderPoints(sdl, as_sdl(&m_points[cmd.first]), static_cast<int>(cmd.count))) {
+                    return error_info::from_sdl("Failed to draw points");
+                }
+                break;
+            case op::draw_lines:
+                if (!SDL_RenderLines(sdl, as_sdl(&m_points[cmd.first]), static_cast<int>(cmd.count))) {
+                    return error_info::from_sdl("Failed to draw lines");
+                }
+                break;
+            case op::draw_rects:
+                if (!SDL_RenderRects(sdl, as_sdl(&m_rects[cmd.first]), static_cast<int>(cmd.count))) {
+                    return error_info::from_sdl("Failed to draw rects");
+                }
+                break;
+            case op::fill_rects:
+                if (!SDL_RenderFillRects(sdl, as_sdl(&m_rects[cmd.first]), static_cast<int>(cmd.count))) {
+                    return error_info::from_sdl("Failed to fill rects");
+                }
+                break;
+            case op::render_texture: {
+                const auto& copy = m_copies[cmd.first];
+                const SDL_FRect* src = copy.has_src ? as_sdl(&copy.src) : nullptr;
+                const SDL_FPoint* center = copy.has_center ? as_sdl(&copy.center) : nullptr;
+                const bool plain = copy.angle == 0.0 && copy.flip == flip_mode::none;
+                const bool ok = plain ? SDL_RenderTexture(sdl, copy.texture, src, as_sdl(&copy.dst))
+                                      : SDL_RenderTextureRotated(sdl, copy.texture, src, as_sdl(&copy.dst), copy.angle,
+                                                                 center, static_cast<SDL_FlipMode>(copy.flip));
+                if (!ok) {
+                    return error_info::from_sdl("Failed to render texture");
+                }
+                break;
+            }
+        }
+    }
+    return {};
+}
+
+void command_list::reset() noexcept {
+    m_commands.clear();
+    m_points.clear();
+    m_rects.clear();
+    m_copies.clear();
+}
+
+void command_list::reserve(std::size_t commands, std::size_t items) {
+    m_commands.reserve(commands);
+    m_points.reserve(items);
+    m_rects.reserve(items);
+    m_copies.reserve(items);
+}
+
+}  // namespace laya
@@ -0,0 +1,62 @@
+/// @file command_list_group.cpp
+/// @date 2026-10-17
+
+#include <algorithm>
+
+#include <laya/renderers/command_list_group.hpp>
+
+namespace laya {
+
+command_list_group::command_list_group(std::size_t count) {
+    resize(count);
+}
+
+void command_list_group::resize(std::size_t count) {
+    const std::size_t old_count = m_keys.size();
+    m_lists.resize(count);
+    m_keys.resize(count);
+    for (std::size_t slot = old_count; slot < count; ++slot) {
+        m_keys[slot] = slot;
+    }
+}
+
+void command_list_group::sort_slots() {
+    m_order.resize(m_lists.size());
+    for (std::size_t slot = 0; slot < m_order.size(); ++slot) {
+        m_order[slot] = slot;
+    }
+    // Tie-break on the index rather than using stable_sort, which may allocate a buffer per call
+    std::sort(m_order.begin(), m_order.end(), [this](std::size_t a, std::size_t b) {
+        return m_keys[a] != m_keys[b] ? m_keys[a] < m_keys[b] : a < b;
+    });
+}
+
+void command_list_group::merge_into(command_list& out) {
+    sort_slots();
+
+    // Reserve the commands once, the pools already grow geometrically as slots are inserted
+    std::size_t commands = out.size();
+    for (const auto& list : m_lists) {
+        commands += list.size();
+    }
+    out.reserve(commands, 0);
+
+    for (const std::size_t slot : m_order) {
+        out.append(m_lists[slot]);
+    }
+}
+
+void command_list_group::replay(renderer& r) {
+    sort_slots();
+    for (const std::size_t slot : m_order) {
+        m_lists[slot].replay(r);
+    }
+}
+
+void command_list_group::reset() noexcept {
+    for (auto& list : m_lists) {
+        list.reset();
+    }
+}
+
+}  // namespace laya
@@ -0,0 +1,148 @@
+/// @file display.cpp
+/// @date 2026-10-17
+
+#include <cstddef>
+#include <cstdint>
+
+#include <laya/displays/display.hpp>
+#include <laya/errors.hpp>
+#include <laya/subsystems.hpp>
+#include <laya/windows/window.hpp>
+
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+namespace {
+
+display_mode from_sdl_mode(const SDL_DisplayMode& mode) noexcept {
+    display_mode result;
+    result.size = dimensions{mode.w, mode.h};
+    result.format = static_cast<pixel_format>(mode.format);
+    result.pixel_density = mode.pixel_density;
+    result.refresh_rate = mode.refresh_rate;
+    result.refresh_rate_numerator = mode.refresh_rate_numerator;
+    result.refresh_rate_denominator = mode.refresh_rate_denominator;
+    return result;
+}
+
+}  // namespace
+
+// ============================================================================
+// display_mode implementation
+// ============================================================================
+
+std::chrono::nanoseconds display_mode::frame_duration() const noexcept {
+    // The rational rate is exact, e.g. 60000/1001 for 59.94 Hz
+    if (refresh_rate_numerator > 0 && refresh_rate_denominator > 0) {
+        return std::chrono::nanoseconds{1'000'000'000LL * refresh_rate_denominator / refresh_rate_numerator};
+    }
+    if (refresh_rate > 0.0f) {
+        return std::chrono::nanoseconds{static_cast<std::int64_t>(1'000'000'000.0 / refresh_rate)};
+    }
+    return std::chrono::nanoseconds{0};
+}
+
+// ============================================================================
+// display implementation
+// ============================================================================
+
+display display::primary() {
+    use_subsystem(subsystem::video);
+    const SDL_DisplayID id = SDL_GetPrimaryDisplay();
+    if (id == 0) {
+        throw error::from_sdl();
+    }
+    return display{display_id{id}};
+}
+
+std::vector<display> display::all() {
+    use_subsystem(subsystem::video);
+    int count = 0;
+    SDL_DisplayID* ids = SDL_GetDisplays(&count);
+    if (!ids) {
+        throw error::from_sdl();
+    }
+
+    std::vector<display> displays;
+    displays.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        displays.emplace_back(display_id{ids[i]});
+    }
+    SDL_free(ids);
+    return displays;
+}
+
+display display::of(const window& win) {
+    const SDL_DisplayID id = SDL_GetDisplayForWindow(win.native_handle());
+    if (id == 0) {
+        throw error::from_sdl();
+    }
+    return display{display_id{id}};
+}
+
+std::string display::name() const {
+    const char* name = SDL_GetDisplayName(m_id.value());
+    if (!name) {
+        throw error::from_sdl();
+    }
+    return name;
+}
+
+rect display::bounds() const {
+    SDL_Rect r;
+    if (!SDL_GetDisplayBounds(m_id.value(), &r)) {
+        throw error::from_sdl();
+    }
+    return rect{r.x, r.y, r.w, r.h};
+}
+
+rect display::usable_bounds() const {
+    SDL_Rect r;
+    if (!SDL_GetDisplayUsableBounds(m_id.value(), &r)) {
+        throw error::from_sdl();
+    }
+    return rect{r.x, r.y, r.w, r.h};
+}
+
+float display::content_scale() const {
+    const float scale = SDL_GetDisplayContentScale(m_id.value());
+    if (scale == 0.0f) {
+        throw error::from_sdl();
+    }
+    return scale;
+}
+
+display_mode display::current_mode() const {
+    const SDL_DisplayMode* mode = SDL_GetCurrentDisplayMode(m_id.value());
+    if (!mode) {
+        throw error::from_sdl();
+    }
+    return from_sdl_mode(*mode);
+}
+
+display_mode display::desktop_mode() const {
+    const SDL_DisplayMode* mode = SDL_GetDesktopDisplayMode(m_id.value());
+    if (!mode) {
+        throw error::from_sdl();
+    }
+    return from_sdl_mode(*mode);
+}
+
+std::vector<display_mode> display::fullscreen_modes() const {
+    int count = 0;
+    SDL_DisplayMode** modes = SDL_GetFullscreenDisplayModes(m_id.value(), &count);
+    if (!modes) {
+        throw error::from_sdl();
+    }
+
+    std::vector<display_mode> result;
+    result.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        result.push_back(from_sdl_mode(*modes[i]));
+    }
+    SDL_free(modes);
+    return result;
+}
+
+}  // namespace laya
@@ -1,10 +1,89 @@
+#include <memory>
+
 #include <laya/errors.hpp>
+#include <laya/result.hpp>
 #include <SDL3/SDL.h>
 
 namespace laya {
 
 error error::from_sdl(const std::source_location& location) {
-    return error(location, "SDL Error: {}", SDL_GetError());
+    return error(error_code::sdl, "SDL Error", SDL_GetError(), location);
+}
+
+error::error(const error& other) noexcept
+    : std::runtime_error(other),
+      m_location(other.m_location),
+      m_prefix(other.m_prefix),
+      m_code(other.m_code),
+      m_has_location(other.m_has_location) {
+}
+
+error& error::operator=(const error& other) noexcept {
+    if (this != &other) {
+        std::runtime_error::operator=(other);
+        m_location = other.m_location;
+        m_prefix = other.m_prefix;
+        m_code = other.m_code;
+        m_has_location = other.m_has_location;
+        delete m_what.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    return *this;
+}
+
+error::~error() {
+    delete m_what.load(std::memory_order_acquire);
+}
+
+const char* error::what() const noexcept {
+    const char* message = std::runtime_error::what();
+    if (!m_has_location && !m_prefix) {
+        return message;
+    }
+
+    if (const std::string* text = m_what.load(std::memory_order_acquire)) {
+        return text->c_str();
+    }
+
+    try {
+        std::unique_ptr<const std::string> text;
+        if (m_prefix) {
+            text = std::make_unique<const std::string>(std::format("[{}:{}:{}] {}: {}", m_location.file_name(),
+                                                                   m_location.line(), m_location.function_name(),
+                                                                   m_prefix, message));
+        } else {
+            text = std::make_unique<const std::string>(std::format(
+                "[{}:{}:{}] {}", m_location.file_name(), m_location.line(), m_location.function_name(), message));
+        }
+
+        // Two threads may format at once, the first to publish wins and the other text is dropped
+        const std::string* published = nullptr;
+        if (m_what.compare_exchange_strong(published, text.get(), std::memory_order_acq_rel,
+                                           std::memory_order_acquire)) {
+            return text.release()->c_str();
+        }
+        return published->c_str();
+    } catch (...) {
+        // Out of memory, the unformatted message is better than nothing
+        return message;
+    }
+}
+
+error_info error_info::from_sdl(const char* context, const std::source_location& location) {
+    return error_info{error_code::sdl, context, SDL_GetError(), location};
+}
+
+std::string error_info::message() const {
+    if (m_detail.empty()) {
+        return m_context;
+    }
+    return std::format("{}: {}", m_context, m_detail);
+}
+
+error error_info::to_error() const {
+    if (m_detail.empty()) {
+        return error(m_code, nullptr, m_context, m_location);
+    }
+    return error(m_code, m_context, m_detail.c_str(), m_location);
 }
 
 }  // namespace laya
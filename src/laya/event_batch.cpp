@@ -0,0 +1,204 @@
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include <laya/events/event_batch.hpp>
+#include <laya/input/keyboard.hpp>
+#include <laya/subsystems.hpp>
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+namespace {
+
+/// Number of SDL events fetched per SDL_PeepEvents call
+constexpr int peep_chunk_size = 128;
+
+}  // anonymous namespace
+
+// ============================================================================
+// event_batch implementation
+// ============================================================================
+
+std::size_t event_batch::poll() {
+    use_subsystem(subsystem::events);
+    SDL_PumpEvents();
+
+    std::array<SDL_Event, peep_chunk_size> buffer;
+    std::size_t total = 0;
+    while (true) {
+        const int count =
+            SDL_PeepEvents(buffer.data(), peep_chunk_size, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+        if (count <= 0) {
+            break;
+        }
+
+        append(buffer.data(), static_cast<std::size_t>(count));
+        total += static_cast<std::size_t>(count);
+
+        if (count < peep_chunk_size) {
+            break;
+        }
+    }
+    return total;
+}
+
+void event_batch::append(const SDL_Event* events, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        append_sdl(events[i]);
+    }
+}
+
+void event_batch::append_sdl(const SDL_Event& sdl_ev) {
+    switch (sdl_ev.type) {
+        case SDL_EVENT_KEY_DOWN:
+        case SDL_EVENT_KEY_UP:
+            m_keys.timestamp.push_back(sdl_ev.key.timestamp);
+            m_keys.window.push_back(sdl_ev.key.windowID);
+            m_keys.scancode.push_back(static_cast<std::uint32_t>(sdl_ev.key.scancode));
+            m_keys.keycode.push_back(static_cast<std::uint32_t>(sdl_ev.key.key));
+            m_keys.mod.push_back(sdl_ev.key.mod);
+            m_keys.pressed.push_back(sdl_ev.type == SDL_EVENT_KEY_DOWN ? 1 : 0);
+            m_keys.repeat.push_back(sdl_ev.key.repeat ? 1 : 0);
+            break;
+
+        case SDL_EVENT_MOUSE_MOTION:
+            m_motions.timestamp.push_back(sdl_ev.motion.timestamp);
+            m_motions.window.push_back(sdl_ev.motion.windowID);
+            m_motions.x.push_back(sdl_ev.motion.x);
+            m_motions.y.push_back(sdl_ev.motion.y);
+            m_motions.xrel.push_back(sdl_ev.motion.xrel);
+            m_motions.yrel.push_back(sdl_ev.motion.yrel);
+            m_motions.state.push_back(sdl_ev.motion.state);
+            break;
+
+        case SDL_EVENT_MOUSE_BUTTON_DOWN:
+        case SDL_EVENT_MOUSE_BUTTON_UP:
+            m_buttons.timestamp.push_back(sdl_ev.button.timestamp);
+            m_buttons.window.push_back(sdl_ev.button.windowID);
+            m_buttons.x.push_back(sdl_ev.button.x);
+            m_buttons.y.push_back(sdl_ev.button.y);
+            m_buttons.button.push_back(sdl_ev.button.button);
+            m_buttons.pressed.push_back(sdl_ev.type == SDL_EVENT_MOUSE_BUTTON_DOWN ? 1 : 0);
+            m_buttons.clicks.push_back(sdl_ev.button.clicks);
+            break;
+
+        case SDL_EVENT_MOUSE_WHEEL:
+            m_wheels.timestamp.push_back(sdl_ev.wheel.timestamp);
+            m_wheels.window.push_back(sdl_ev.wheel.windowID);
+            m_wheels.x.push_back(sdl_ev.wheel.x);
+            m_wheels.y.push_back(sdl_ev.wheel.y);
+            break;
+
+        case SDL_EVENT_QUIT:
+            ++m_quit_count;
+            break;
+
+        case SDL_EVENT_KEYMAP_CHANGED:
+            // Not stored, but keycode lookups must not outlive the old layout
+            invalidate_keycode_cache();
+            ++m_skipped;
+            break;
+
+        default:
+            if (sdl_ev.type >= SDL_EVENT_WINDOW_FIRST && sdl_ev.type <= SDL_EVENT_WINDOW_LAST) {
+                try {
+                    append(from_sdl_event(sdl_ev));
+                } catch (const std::runtime_error&) {
+                    ++m_skipped;
+                }
+            } else {
+                ++m_skipped;
+            }
+            break;
+    }
+}
+
+void event_batch::append(const event& ev) {
+    if (const auto* e = std::get_if<key_event>(&ev)) {
+        m_keys.timestamp.push_back(e->timestamp);
+        m_keys.window.push_back(e->id.value());
+        m_keys.scancode.push_back(e->scancode);
+        m_keys.keycode.push_back(e->keycode);
+        m_keys.mod.push_back(e->mod);
+        m_keys.pressed.push_back(e->key_state == key_event::state::pressed ? 1 : 0);
+        m_keys.repeat.push_back(e->repeat ? 1 : 0);
+    } else if (const auto* e = std::get_if<mouse_motion_event>(&ev)) {
+        m_motions.timestamp.push_back(e->timestamp);
+        m_motions.window.push_back(e->id.value());
+        m_motions.x.push_back(e->precise_x);
+        m_motions.y.push_back(e->precise_y);
+        m_motions.xrel.push_back(e->precise_xrel);
+        m_motions.yrel.push_back(e->precise_yrel);
+        m_motions.state.push_back(e->state);
+    } else if (const auto* e = std::get_if<mouse_button_event>(&ev)) {
+        m_buttons.timestamp.push_back(e->timestamp);
+        m_buttons.window.push_back(e->id.value());
+        m_buttons.x.push_back(e->precise_x);
+        m_buttons.y.push_back(e->precise_y);
+        m_buttons.button.push_back(static_cast<std::uint8_t>(e->mouse_button));
+        m_buttons.pressed.push_back(e->button_state == mouse_button_event::state::pressed ? 1 : 0);
+        m_buttons.clicks.push_back(e->clicks);
+    } else if (const auto* e = std::get_if<mouse_wheel_event>(&ev)) {
+        m_wheels.timestamp.push_back(e->timestamp);
+        m_wheels.window.push_back(e->id.value());
+        m_wheels.x.push_back(e->precise_x);
+        m_wheels.y.push_back(e->precise_y);
+    } else if (const auto* e = std::get_if<window_event>(&ev)) {
+        std::int32_t data1 = 0;
+        std::int32_t data2 = 0;
+        if (const auto* pos = std::get_if<window_event_data_position>(&e->data)) {
+            data1 = pos->x;
+            data2 = pos->y;
+        } else if (const auto* size = std::get_if<window_event_data_size>(&e->data)) {
+            data1 = size->width;
+            data2 = size->height;
+        } else if (const auto* display = std::get_if<window_event_data_display>(&e->data)) {
+            data1 = display->display_index;
+        }
+
+        m_windows.timestamp.push_back(e->timestamp);
+        m_windows.window.push_back(e->id.value());
+        m_windows.type.push_back(e->event_type);
+        m_windows.data1.push_back(data1);
+        m_windows.data2.push_back(data2);
+    } else if (std::holds_alternative<quit_event>(ev)) {
+        ++m_quit_count;
+    } else {
+        ++m_skipped;
+    }
+}
+
+void event_batch::clear() noexcept {
+    for_each_storage([](auto& storage) { storage.for_each_column([](auto& column) { column.clear(); }); });
+    m_quit_count = 0;
+    m_skipped = 0;
+}
+
+void event_batch::reserve(std::size_t count) {
+    for_each_storage(
+        [count](auto& storage) { storage.for_each_column([count](auto& column) { column.reserve(count); }); });
+}
+
+float event_batch::mouse_travel() const noexcept {
+    // Four independent partial sums over two contiguous float columns. A single accumulator chains
+    // every addition to the previous one, and strict floating point rules keep the compiler from
+    // reassociating it, so the sums are split by hand.
+    const float* xrel = m_motions.xrel.data();
+    const float* yrel = m_motions.yrel.data();
+    const std::size_t count = m_motions.xrel.size();
+
+    float partial[4]{};
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        for (std::size_t lane = 0; lane < 4; ++lane) {
+            partial[lane] += std::sqrt(xrel[i + lane] * xrel[i + lane] + yrel[i + lane] * yrel[i + lane]);
+        }
+    }
+    for (; i < count; ++i) {
+        partial[0] += std::sqrt(xrel[i] * xrel[i] + yrel[i] * yrel[i]);
+    }
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+}
+
+}  // namespace laya
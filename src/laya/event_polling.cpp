@@ -1,4 +1,5 @@
 #include <laya/events/event_polling.hpp>
+#include <laya/subsystems.hpp>
 #include <SDL3/SDL.h>
 
 namespace laya {
@@ -8,6 +9,7 @@ namespace laya {
 // ============================================================================
 
 std::optional<event> wait_event() {
+    use_subsystem(subsystem::events);
     SDL_Event sdl_event;
     while (true) {
         if (SDL_WaitEvent(&sdl_event) == 0) {
@@ -24,6 +26,7 @@ std::optional<event> wait_event() {
 }
 
 std::optional<event> wait_event_timeout(std::chrono::milliseconds timeout) {
+    use_subsystem(subsystem::events);
     SDL_Event sdl_event;
     while (true) {
         if (SDL_WaitEventTimeout(&sdl_event, static_cast<int32_t>(timeout.count())) == 0) {
@@ -59,6 +62,7 @@ void flush_events(uint32_t min_type, uint32_t max_type) {
 // ============================================================================
 
 event_range::event_range() {
+    use_subsystem(subsystem::events);
     SDL_Event sdl_event;
     while (SDL_PollEvent(&sdl_event)) {
         try {
@@ -80,6 +84,7 @@ event_range events_range() {
 
 event_view::iterator::iterator(bool fetch_first) : m_current_event{}, m_has_event{false} {
     if (fetch_first) {
+        use_subsystem(subsystem::events);
         fetch_next();
     }
 }
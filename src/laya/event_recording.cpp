@@ -0,0 +1,310 @@
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <laya/events/event_recording.hpp>
+#include <laya/errors.hpp>
+#include <laya/logging/log.hpp>
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+namespace {
+
+// ============================================================================
+// File format
+// ============================================================================
+//
+// header : magic[8] | version (u32) | event alternative count (u32) | layout hash (u32)
+// record : alternative index (u8) | raw bytes of that alternative
+//
+// Values are stored in native byte order, recordings are meant to be replayed
+// on the machine (or at least the architecture) that produced them.
+
+constexpr std::array<char, 8> recording_magic{'L', 'A', 'Y', 'A', 'E', 'V', 'T', '\0'};
+/// Bumped whenever the layout of an event struct changes, in the same commit as the change
+/// @note 3 added the layout hash to the header
+constexpr std::uint32_t recording_version = 3;
+constexpr std::uint32_t alternative_count = static_cast<std::uint32_t>(std::variant_size_v<event>);
+
+static_assert(alternative_count <= 0xFF, "event alternative index must fit in one byte");
+
+template <std::size_t... Is>
+constexpr bool all_trivially_copyable(std::index_sequence<Is...>) {
+    return (std::is_trivially_copyable_v<std::variant_alternative_t<Is, event>> && ...);
+}
+
+static_assert(all_trivially_copyable(std::make_index_sequence<std::variant_size_v<event>>{}),
+              "recorded events are written as raw bytes and must be trivially copyable");
+
+/// Size in bytes of each event alternative, indexed by variant index
+template <std::size_t... Is>
+constexpr std::array<std::size_t, sizeof...(Is)> make_alternative_sizes(std::index_sequence<Is...>) {
+    return {sizeof(std::variant_alternative_t<Is, event>)...};
+}
+
+constexpr auto alternative_sizes = make_alternative_sizes(std::make_index_sequence<std::variant_size_v<event>>{});
+
+/// FNV-1a over the alternative sizes, so a struct that grows or shrinks is rejected even if
+/// recording_version was not bumped. Changes that keep every size still need the bump.
+constexpr std::uint32_t layout_hash = [] {
+    std::uint32_t hash = 2166136261u;
+    for (const auto size : alternative_sizes) {
+        hash = (hash ^ static_cast<std::uint32_t>(size)) * 16777619u;
+    }
+    return hash;
+}();
+
+constexpr std::size_t max_alternative_size = [] {
+    std::size_t result = 0;
+    for (const auto size : alternative_sizes) {
+        result = size > result ? size : result;
+    }
+    return result;
+}();
+
+/// Construct the alternative at index I from raw bytes
+template <std::size_t I>
+event read_alternative(const char* bytes) {
+    std::variant_alternative_t<I, event> value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return event{std::in_place_index<I>, value};
+}
+
+using alternative_reader = event (*)(const char*);
+
+template <std::size_t... Is>
+constexpr std::array<alternative_reader, sizeof...(Is)> make_alternative_readers(std::index_sequence<Is...>) {
+    return {&read_alternative<Is>...};
+}
+
+constexpr auto alternative_readers =
+    make_alternative_readers(std::make_index_sequence<std::variant_size_v<event>>{});
+
+/// Written to the reserved field of events pushed by event_player, the recorder skips them
+constexpr Uint32 replay_tag = 0x4C415941;  // "LAYA"
+
+/// Get the timestamp of any event alternative
+std::uint64_t event_timestamp(const event& ev) noexcept {
+    return std::visit([](const auto& e) { return e.timestamp; }, ev);
+}
+
+}  // anonymous namespace
+
+/// SDL event watch that forwards every supported event to the recorder
+struct event_recorder_watch {
+    static bool SDLCALL callback(void* userdata, SDL_Event* sdl_event) {
+        if (sdl_event->common.reserved == replay_tag) {
+            return true;
+        }
+
+        auto* recorder = static_cast<event_recorder*>(userdata);
+        try {
+            recorder->record(from_sdl_event(*sdl_event));
+        } catch (const std::runtime_error&) {
+            // Skip unsupported event types
+        } catch (...) {
+            // Exceptions must not cross into SDL, keep the first one for watch_error()
+            bool first = false;
+            {
+                std::lock_guard lock{recorder->m_mutex};
+                if (!recorder->m_watch_error) {
+                    recorder->m_watch_error = std::current_exception();
+                    first = true;
+                }
+            }
+            if (first) {
+                log_error("Recording an event to '{}' failed, later failures are not logged", recorder->m_path);
+            }
+        }
+        return true;
+    }
+};
+
+// ============================================================================
+// event_recorder implementation
+// ============================================================================
+
+event_recorder::event_recorder(std::string_view path, std::size_t max_pending)
+    : m_path{path}, m_max_pending{max_pending}, m_written{0}, m_dropped{0}, m_recording{false} {
+    std::ofstream file{m_path, std::ios::binary | std::ios::trunc};
+    if (!file) {
+        throw error("Failed to open event recording '{}' for writing", m_path);
+    }
+
+    file.write(recording_magic.data(), static_cast<std::streamsize>(recording_magic.size()));
+    file.write(reinterpret_cast<const char*>(&recording_version), sizeof(recording_version));
+    file.write(reinterpret_cast<const char*>(&alternative_count), sizeof(alternative_count));
+    file.write(reinterpret_cast<const char*>(&layout_hash), sizeof(layout_hash));
+    if (!file) {
+        throw error("Failed to write event recording header to '{}'", m_path);
+    }
+}
+
+event_recorder::~event_recorder() noexcept {
+    try {
+        stop();
+    } catch (...) {
+        // Destructors must not throw; pending events are lost if the final write fails
+    }
+}
+
+void event_recorder::start() {
+    if (m_recording) {
+        return;
+    }
+
+    if (!SDL_AddEventWatch(event_recorder_watch::callback, this)) {
+        throw error::from_sdl();
+    }
+    m_recording = true;
+}
+
+void event_recorder::stop() {
+    if (m_recording) {
+        SDL_RemoveEventWatch(event_recorder_watch::callback, this);
+        m_recording = false;
+    }
+    flush();
+}
+
+void event_recorder::record(const event& ev) {
+    std::lock_guard lock{m_mutex};
+    if (m_pending.size() >= m_max_pending) {
+        ++m_dropped;
+        return;
+    }
+    m_pending.push_back(ev);
+}
+
+void event_recorder::flush() {
+    std::lock_guard lock{m_mutex};
+    if (m_pending.empty()) {
+        return;
+    }
+
+    std::ofstream file{m_path, std::ios::binary | std::ios::app};
+    if (!file) {
+        throw error("Failed to open event recording '{}' for writing", m_path);
+    }
+
+    for (const auto& ev : m_pending) {
+        const auto index = static_cast<std::uint8_t>(ev.index());
+        file.write(reinterpret_cast<const char*>(&index), sizeof(index));
+        std::visit([&file](const auto& e) { file.write(reinterpret_cast<const char*>(&e), sizeof(e)); }, ev);
+    }
+
+    if (!file) {
+        throw error("Failed to write events to recording '{}'", m_path);
+    }
+
+    m_written += m_pending.size();
+    m_pending.clear();
+}
+
+std::size_t event_recorder::size() const {
+    std::lock_guard lock{m_mutex};
+    return m_written + m_pending.size();
+}
+
+std::size_t event_recorder::dropped() const {
+    std::lock_guard lock{m_mutex};
+    return m_dropped;
+}
+
+std::exception_ptr event_recorder::watch_error() const {
+    std::lock_guard lock{m_mutex};
+    return m_watch_error;
+}
+
+// ============================================================================
+// event_player implementation
+// ============================================================================
+
+event_player::event_player(std::string_view path)
+    : m_position{0}, m_start_ns{0}, m_first_ns{0}, m_timing{playback_timing::original}, m_started{false} {
+    const std::string file_path{path};
+    std::ifstream file{file_path, std::ios::binary};
+    if (!file) {
+        throw error("Failed to open event recording '{}'", file_path);
+    }
+
+    std::array<char, 8> magic{};
+    std::uint32_t version = 0;
+    std::uint32_t count = 0;
+    std::uint32_t layout = 0;
+    file.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    file.read(reinterpret_cast<char*>(&layout), sizeof(layout));
+
+    if (!file || magic != recording_magic) {
+        throw error("'{}' is not a laya event recording", file_path);
+    }
+    if (version != recording_version || count != alternative_count || layout != layout_hash) {
+        throw error("Event recording '{}' was written by an incompatible laya version", file_path);
+    }
+
+    std::array<char, max_alternative_size> buffer{};
+
+    std::uint8_t index = 0;
+    while (file.read(reinterpret_cast<char*>(&index), sizeof(index))) {
+        if (index >= alternative_count) {
+            throw error("Event recording '{}' is corrupt (unknown event index {})", file_path, index);
+        }
+
+        const std::size_t bytes = alternative_sizes[index];
+        if (!file.read(buffer.data(), static_cast<std::streamsize>(bytes))) {
+            throw error("Event recording '{}' is truncated", file_path);
+        }
+
+        m_events.push_back(alternative_readers[index](buffer.data()));
+    }
+}
+
+void event_player::start(playback_timing timing) {
+    m_timing = timing;
+    m_start_ns = SDL_GetTicksNS();
+    m_first_ns = finished() ? 0 : event_timestamp(m_events[m_position]);
+    m_started = true;
+}
+
+std::size_t event_player::pump() {
+    if (!m_started) {
+        return 0;
+    }
+
+    const std::uint64_t now = SDL_GetTicksNS();
+    const std::uint64_t elapsed = now - m_start_ns;
+
+    std::size_t pushed = 0;
+    SDL_Event sdl_event;
+    while (!finished()) {
+        const event& ev = m_events[m_position];
+        const std::uint64_t offset = event_timestamp(ev) - m_first_ns;
+
+        if (m_timing == playback_timing::original && offset > elapsed) {
+            break;
+        }
+
+        // Converted from the stored event so text pointers stay valid, then re-stamped
+        // onto the playback clock (the timestamp is shared by every SDL event struct)
+        to_sdl_event(ev, sdl_event);
+        sdl_event.common.timestamp = (m_timing == playback_timing::original) ? m_start_ns + offset : now;
+        sdl_event.common.reserved = replay_tag;
+        if (!SDL_PushEvent(&sdl_event)) {
+            break;
+        }
+
+        ++m_position;
+        ++pushed;
+    }
+
+    return pushed;
+}
+
+}  // namespace laya
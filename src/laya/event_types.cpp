@@ -1,12 +1,20 @@
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include <cstring>
 #include <string>
 
 #include <laya/events/event_types.hpp>
+#include <laya/input/keyboard.hpp>
 #include <SDL3/SDL.h>
 
 namespace laya {
 
+static_assert(SDL_EVENT_DISPLAY_ADDED - SDL_EVENT_DISPLAY_ORIENTATION ==
+              static_cast<int>(display_event::type::added));
+static_assert(SDL_EVENT_DISPLAY_CONTENT_SCALE_CHANGED - SDL_EVENT_DISPLAY_ORIENTATION ==
+              static_cast<int>(display_event::type::content_scale_changed));
+
 namespace {
 
 /// Convert SDL window event type and data to laya types
@@ -73,6 +81,57 @@ std::pair<window_event_type, window_event_data> convert_window_event_data(std::u
     }
 }
 
+/// Convert laya window event type back to the SDL event type
+/// @param type The laya window event type
+/// @return The matching SDL event type
+std::uint32_t to_sdl_window_event_type(window_event_type type) {
+    switch (type) {
+        case window_event_type::shown:
+            return SDL_EVENT_WINDOW_SHOWN;
+        case window_event_type::hidden:
+            return SDL_EVENT_WINDOW_HIDDEN;
+        case window_event_type::exposed:
+            return SDL_EVENT_WINDOW_EXPOSED;
+        case window_event_type::moved:
+            return SDL_EVENT_WINDOW_MOVED;
+        case window_event_type::resized:
+            return SDL_EVENT_WINDOW_RESIZED;
+        case window_event_type::size_changed:
+            return SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED;
+        case window_event_type::minimized:
+            return SDL_EVENT_WINDOW_MINIMIZED;
+        case window_event_type::maximized:
+            return SDL_EVENT_WINDOW_MAXIMIZED;
+        case window_event_type::restored:
+            return SDL_EVENT_WINDOW_RESTORED;
+        case window_event_type::enter:
+            return SDL_EVENT_WINDOW_MOUSE_ENTER;
+        case window_event_type::leave:
+            return SDL_EVENT_WINDOW_MOUSE_LEAVE;
+        case window_event_type::focus_gained:
+            return SDL_EVENT_WINDOW_FOCUS_GAINED;
+        case window_event_type::focus_lost:
+            return SDL_EVENT_WINDOW_FOCUS_LOST;
+        case window_event_type::close:
+            return SDL_EVENT_WINDOW_CLOSE_REQUESTED;
+        case window_event_type::hit_test:
+            return SDL_EVENT_WINDOW_HIT_TEST;
+        case window_event_type::icc_profile_changed:
+            return SDL_EVENT_WINDOW_ICCPROF_CHANGED;
+        case window_event_type::display_changed:
+            return SDL_EVENT_WINDOW_DISPLAY_CHANGED;
+        default:
+            throw std::runtime_error("Unknown laya window event type: " +
+                                     std::to_string(static_cast<int>(type)));
+    }
+}
+
+/// Overload set for std::visit
+template <class... Ts>
+struct overloaded : Ts... {
+    using Ts::operator()...;
+};
+
 }  // anonymous namespace
 
 event from_sdl_event(const SDL_Event& sdl_ev) {
@@ -155,6 +214,10 @@ event from_sdl_event(const SDL_Event& sdl_ev) {
             event.y = sdl_ev.motion.y;
             event.xrel = sdl_ev.motion.xrel;
             event.yrel = sdl_ev.motion.yrel;
+            event.precise_x = sdl_ev.motion.x;
+            event.precise_y = sdl_ev.motion.y;
+            event.precise_xrel = sdl_ev.motion.xrel;
+            event.precise_yrel = sdl_ev.motion.yrel;
             return event;
         }
 
@@ -192,6 +255,8 @@ event from_sdl_event(const SDL_Event& sdl_ev) {
             event.clicks = sdl_ev.button.clicks;
             event.x = sdl_ev.button.x;
             event.y = sdl_ev.button.y;
+            event.precise_x = sdl_ev.button.x;
+            event.precise_y = sdl_ev.button.y;
             return event;
         }
 
@@ -238,9 +303,364 @@ event from_sdl_event(const SDL_Event& sdl_ev) {
             return event;
         }
 
+        case SDL_EVENT_GAMEPAD_AXIS_MOTION: {
+            gamepad_axis_event event;
+            event.timestamp = sdl_ev.gaxis.timestamp;
+            event.which = sdl_ev.gaxis.which;
+            event.axis = static_cast<gamepad_axis>(sdl_ev.gaxis.axis);
+            event.value = sdl_ev.gaxis.value;
+            return event;
+        }
+
+        case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+        case SDL_EVENT_GAMEPAD_BUTTON_UP: {
+            gamepad_button_event event;
+            event.timestamp = sdl_ev.gbutton.timestamp;
+            event.which = sdl_ev.gbutton.which;
+            event.button = static_cast<gamepad_button>(sdl_ev.gbutton.button);
+            event.button_state = (sdl_ev.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN) ? gamepad_button_event::state::pressed
+                                                                                : gamepad_button_event::state::released;
+            return event;
+        }
+
+        case SDL_EVENT_GAMEPAD_ADDED:
+        case SDL_EVENT_GAMEPAD_REMOVED:
+        case SDL_EVENT_GAMEPAD_REMAPPED: {
+            gamepad_device_event event;
+            event.timestamp = sdl_ev.gdevice.timestamp;
+            event.which = sdl_ev.gdevice.which;
+            if (sdl_ev.type == SDL_EVENT_GAMEPAD_ADDED) {
+                event.device_event = gamepad_device_event::type::added;
+            } else if (sdl_ev.type == SDL_EVENT_GAMEPAD_REMOVED) {
+                event.device_event = gamepad_device_event::type::removed;
+            } else {
+                event.device_event = gamepad_device_event::type::remapped;
+            }
+            return event;
+        }
+
+        case SDL_EVENT_GAMEPAD_SENSOR_UPDATE: {
+            gamepad_sensor_event event;
+            event.timestamp = sdl_ev.gsensor.timestamp;
+            event.which = sdl_ev.gsensor.which;
+            event.sensor = static_cast<sensor_type>(sdl_ev.gsensor.sensor);
+            std::copy(std::begin(sdl_ev.gsensor.data), std::end(sdl_ev.gsensor.data), event.data.begin());
+            event.sensor_timestamp = sdl_ev.gsensor.sensor_timestamp;
+            return event;
+        }
+
+        case SDL_EVENT_SENSOR_UPDATE: {
+            sensor_event event;
+            event.timestamp = sdl_ev.sensor.timestamp;
+            event.which = sdl_ev.sensor.which;
+            std::copy(std::begin(sdl_ev.sensor.data), std::end(sdl_ev.sensor.data), event.data.begin());
+            event.sensor_timestamp = sdl_ev.sensor.sensor_timestamp;
+            return event;
+        }
+
+        case SDL_EVENT_PEN_PROXIMITY_IN:
+        case SDL_EVENT_PEN_PROXIMITY_OUT: {
+            pen_proximity_event event;
+            event.timestamp = sdl_ev.pproximity.timestamp;
+            event.id = window_id{sdl_ev.pproximity.windowID};
+            event.which = sdl_ev.pproximity.which;
+            event.proximity = (sdl_ev.type == SDL_EVENT_PEN_PROXIMITY_IN) ? pen_proximity_event::state::in
+                                                                          : pen_proximity_event::state::out;
+            return event;
+        }
+
+        case SDL_EVENT_PEN_MOTION: {
+            pen_motion_event event;
+            event.timestamp = sdl_ev.pmotion.timestamp;
+            event.id = window_id{sdl_ev.pmotion.windowID};
+            event.which = sdl_ev.pmotion.which;
+            event.pen_state = sdl_ev.pmotion.pen_state;
+            event.x = sdl_ev.pmotion.x;
+            event.y = sdl_ev.pmotion.y;
+            return event;
+        }
+
+        case SDL_EVENT_PEN_DOWN:
+        case SDL_EVENT_PEN_UP: {
+            pen_touch_event event;
+            event.timestamp = sdl_ev.ptouch.timestamp;
+            event.id = window_id{sdl_ev.ptouch.windowID};
+            event.which = sdl_ev.ptouch.which;
+            event.pen_state = sdl_ev.ptouch.pen_state;
+            event.x = sdl_ev.ptouch.x;
+            event.y = sdl_ev.ptouch.y;
+            event.eraser = sdl_ev.ptouch.eraser;
+            event.touch_state = sdl_ev.ptouch.down ? pen_touch_event::state::down : pen_touch_event::state::up;
+            return event;
+        }
+
+        case SDL_EVENT_PEN_BUTTON_DOWN:
+        case SDL_EVENT_PEN_BUTTON_UP: {
+            pen_button_event event;
+            event.timestamp = sdl_ev.pbutton.timestamp;
+            event.id = window_id{sdl_ev.pbutton.windowID};
+            event.which = sdl_ev.pbutton.which;
+            event.pen_state = sdl_ev.pbutton.pen_state;
+            event.x = sdl_ev.pbutton.x;
+            event.y = sdl_ev.pbutton.y;
+            event.button = sdl_ev.pbutton.button;
+            event.button_state =
+                sdl_ev.pbutton.down ? pen_button_event::state::pressed : pen_button_event::state::released;
+            return event;
+        }
+
+        case SDL_EVENT_PEN_AXIS: {
+            pen_axis_event event;
+            event.timestamp = sdl_ev.paxis.timestamp;
+            event.id = window_id{sdl_ev.paxis.windowID};
+            event.which = sdl_ev.paxis.which;
+            event.pen_state = sdl_ev.paxis.pen_state;
+            event.x = sdl_ev.paxis.x;
+            event.y = sdl_ev.paxis.y;
+            event.axis = static_cast<pen_axis>(sdl_ev.paxis.axis);
+            event.value = sdl_ev.paxis.value;
+            return event;
+        }
+
+        case SDL_EVENT_KEYMAP_CHANGED: {
+            // Every laya polling path converts through here, so this keeps keycode queries in sync
+            invalidate_keycode_cache();
+
+            keymap_changed_event event;
+            event.timestamp = sdl_ev.common.timestamp;
+            return event;
+        }
+
+        case SDL_EVENT_DISPLAY_ORIENTATION:
+        case SDL_EVENT_DISPLAY_ADDED:
+        case SDL_EVENT_DISPLAY_REMOVED:
+        case SDL_EVENT_DISPLAY_MOVED:
+        case SDL_EVENT_DISPLAY_DESKTOP_MODE_CHANGED:
+        case SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED:
+        case SDL_EVENT_DISPLAY_CONTENT_SCALE_CHANGED: {
+            display_event event;
+            event.timestamp = sdl_ev.display.timestamp;
+            event.id = display_id{sdl_ev.display.displayID};
+            // SDL keeps the display events contiguous and in the same order as display_event::type
+            event.display_change = static_cast<display_event::type>(sdl_ev.type - SDL_EVENT_DISPLAY_ORIENTATION);
+            event.data = sdl_ev.display.data1;
+            return event;
+        }
+
         default:
             throw std::runtime_error("Unsupported SDL event type: " + std::to_string(sdl_ev.type));
     }
 }
 
+void to_sdl_event(const event& ev, SDL_Event& sdl_ev) {
+    sdl_ev = SDL_Event{};
+
+    std::visit(
+        overloaded{
+            [&](const quit_event& e) {
+                sdl_ev.type = SDL_EVENT_QUIT;
+                sdl_ev.quit.timestamp = e.timestamp;
+            },
+            [&](const window_event& e) {
+                sdl_ev.type = to_sdl_window_event_type(e.event_type);
+                sdl_ev.window.timestamp = e.timestamp;
+                sdl_ev.window.windowID = e.id.value();
+                if (const auto* pos = std::get_if<window_event_data_position>(&e.data)) {
+                    sdl_ev.window.data1 = pos->x;
+                    sdl_ev.window.data2 = pos->y;
+                } else if (const auto* size = std::get_if<window_event_data_size>(&e.data)) {
+                    sdl_ev.window.data1 = size->width;
+                    sdl_ev.window.data2 = size->height;
+                } else if (const auto* display = std::get_if<window_event_data_display>(&e.data)) {
+                    sdl_ev.window.data1 = display->display_index;
+                }
+            },
+            [&](const key_event& e) {
+                sdl_ev.type = (e.key_state == key_event::state::pressed) ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+                sdl_ev.key.timestamp = e.timestamp;
+                sdl_ev.key.windowID = e.id.value();
+                sdl_ev.key.scancode = static_cast<SDL_Scancode>(e.scancode);
+                sdl_ev.key.key = static_cast<SDL_Keycode>(e.keycode);
+                sdl_ev.key.mod = e.mod;
+                sdl_ev.key.down = e.key_state == key_event::state::pressed;
+                sdl_ev.key.repeat = e.repeat;
+            },
+            [&](const text_input_event& e) {
+                sdl_ev.type = SDL_EVENT_TEXT_INPUT;
+                sdl_ev.text.timestamp = e.timestamp;
+                sdl_ev.text.windowID = e.id.value();
+                sdl_ev.text.text = e.text;
+            },
+            [&](const text_editing_event& e) {
+                sdl_ev.type = SDL_EVENT_TEXT_EDITING;
+                sdl_ev.edit.timestamp = e.timestamp;
+                sdl_ev.edit.windowID = e.id.value();
+                sdl_ev.edit.text = e.text;
+                sdl_ev.edit.start = e.start;
+                sdl_ev.edit.length = e.length;
+            },
+            [&](const mouse_motion_event& e) {
+                sdl_ev.type = SDL_EVENT_MOUSE_MOTION;
+                sdl_ev.motion.timestamp = e.timestamp;
+                sdl_ev.motion.windowID = e.id.value();
+                sdl_ev.motion.which = e.which;
+                sdl_ev.motion.state = e.state;
+                sdl_ev.motion.x = e.precise_x;
+                sdl_ev.motion.y = e.precise_y;
+                sdl_ev.motion.xrel = e.precise_xrel;
+                sdl_ev.motion.yrel = e.precise_yrel;
+            },
+            [&](const mouse_button_event& e) {
+                const bool down = e.button_state == mouse_button_event::state::pressed;
+                sdl_ev.type = down ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+                sdl_ev.button.timestamp = e.timestamp;
+                sdl_ev.button.windowID = e.id.value();
+                sdl_ev.button.which = e.which;
+                sdl_ev.button.button = static_cast<Uint8>(e.mouse_button);
+                sdl_ev.button.down = down;
+                sdl_ev.button.clicks = e.clicks;
+                sdl_ev.button.x = e.precise_x;
+                sdl_ev.button.y = e.precise_y;
+            },
+            [&](const mouse_wheel_event& e) {
+                sdl_ev.type = SDL_EVENT_MOUSE_WHEEL;
+                sdl_ev.wheel.timestamp = e.timestamp;
+                sdl_ev.wheel.windowID = e.id.value();
+                sdl_ev.wheel.which = e.which;
+                sdl_ev.wheel.x = e.precise_x;
+                sdl_ev.wheel.y = e.precise_y;
+                sdl_ev.wheel.direction = static_cast<SDL_MouseWheelDirection>(e.direction);
+            },
+            [&](const joystick_axis_event& e) {
+                sdl_ev.type = SDL_EVENT_JOYSTICK_AXIS_MOTION;
+                sdl_ev.jaxis.timestamp = e.timestamp;
+                sdl_ev.jaxis.which = e.which;
+                sdl_ev.jaxis.axis = e.axis;
+                sdl_ev.jaxis.value = e.value;
+            },
+            [&](const joystick_button_event& e) {
+                const bool down = e.button_state == joystick_button_event::state::pressed;
+                sdl_ev.type = down ? SDL_EVENT_JOYSTICK_BUTTON_DOWN : SDL_EVENT_JOYSTICK_BUTTON_UP;
+                sdl_ev.jbutton.timestamp = e.timestamp;
+                sdl_ev.jbutton.which = e.which;
+                sdl_ev.jbutton.button = e.button;
+                sdl_ev.jbutton.down = down;
+            },
+            [&](const joystick_hat_event& e) {
+                sdl_ev.type = SDL_EVENT_JOYSTICK_HAT_MOTION;
+                sdl_ev.jhat.timestamp = e.timestamp;
+                sdl_ev.jhat.which = e.which;
+                sdl_ev.jhat.hat = e.hat;
+                sdl_ev.jhat.value = e.value;
+            },
+            [&](const gamepad_axis_event& e) {
+                sdl_ev.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+                sdl_ev.gaxis.timestamp = e.timestamp;
+                sdl_ev.gaxis.which = e.which;
+                sdl_ev.gaxis.axis = static_cast<Uint8>(e.axis);
+                sdl_ev.gaxis.value = e.value;
+            },
+            [&](const gamepad_button_event& e) {
+                const bool down = e.button_state == gamepad_button_event::state::pressed;
+                sdl_ev.type = down ? SDL_EVENT_GAMEPAD_BUTTON_DOWN : SDL_EVENT_GAMEPAD_BUTTON_UP;
+                sdl_ev.gbutton.timestamp = e.timestamp;
+                sdl_ev.gbutton.which = e.which;
+                sdl_ev.gbutton.button = static_cast<Uint8>(e.button);
+                sdl_ev.gbutton.down = down;
+            },
+            [&](const gamepad_device_event& e) {
+                switch (e.device_event) {
+                    case gamepad_device_event::type::added:
+                        sdl_ev.type = SDL_EVENT_GAMEPAD_ADDED;
+                        break;
+                    case gamepad_device_event::type::removed:
+                        sdl_ev.type = SDL_EVENT_GAMEPAD_REMOVED;
+                        break;
+                    case gamepad_device_event::type::remapped:
+                        sdl_ev.type = SDL_EVENT_GAMEPAD_REMAPPED;
+                        break;
+                }
+                sdl_ev.gdevice.timestamp = e.timestamp;
+                sdl_ev.gdevice.which = e.which;
+            },
+            [&](const gamepad_sensor_event& e) {
+                sdl_ev.type = SDL_EVENT_GAMEPAD_SENSOR_UPDATE;
+                sdl_ev.gsensor.timestamp = e.timestamp;
+                sdl_ev.gsensor.which = e.which;
+                sdl_ev.gsensor.sensor = static_cast<Sint32>(e.sensor);
+                std::copy(e.data.begin(), e.data.end(), std::begin(sdl_ev.gsensor.data));
+                sdl_ev.gsensor.sensor_timestamp = e.sensor_timestamp;
+            },
+            [&](const sensor_event& e) {
+                sdl_ev.type = SDL_EVENT_SENSOR_UPDATE;
+                sdl_ev.sensor.timestamp = e.timestamp;
+                sdl_ev.sensor.which = e.which;
+                std::copy(e.data.begin(), e.data.end(), std::begin(sdl_ev.sensor.data));
+                sdl_ev.sensor.sensor_timestamp = e.sensor_timestamp;
+            },
+            [&](const pen_proximity_event& e) {
+                sdl_ev.type = (e.proximity == pen_proximity_event::state::in) ? SDL_EVENT_PEN_PROXIMITY_IN
+                                                                              : SDL_EVENT_PEN_PROXIMITY_OUT;
+                sdl_ev.pproximity.timestamp = e.timestamp;
+                sdl_ev.pproximity.windowID = e.id.value();
+                sdl_ev.pproximity.which = e.which;
+            },
+            [&](const pen_motion_event& e) {
+                sdl_ev.type = SDL_EVENT_PEN_MOTION;
+                sdl_ev.pmotion.timestamp = e.timestamp;
+                sdl_ev.pmotion.windowID = e.id.value();
+                sdl_ev.pmotion.which = e.which;
+                sdl_ev.pmotion.pen_state = e.pen_state;
+                sdl_ev.pmotion.x = e.x;
+                sdl_ev.pmotion.y = e.y;
+            },
+            [&](const pen_touch_event& e) {
+                const bool down = e.touch_state == pen_touch_event::state::down;
+                sdl_ev.type = down ? SDL_EVENT_PEN_DOWN : SDL_EVENT_PEN_UP;
+                sdl_ev.ptouch.timestamp = e.timestamp;
+                sdl_ev.ptouch.windowID = e.id.value();
+                sdl_ev.ptouch.which = e.which;
+                sdl_ev.ptouch.pen_state = e.pen_state;
+                sdl_ev.ptouch.x = e.x;
+                sdl_ev.ptouch.y = e.y;
+                sdl_ev.ptouch.eraser = e.eraser;
+                sdl_ev.ptouch.down = down;
+            },
+            [&](const pen_button_event& e) {
+                const bool down = e.button_state == pen_button_event::state::pressed;
+                sdl_ev.type = down ? SDL_EVENT_PEN_BUTTON_DOWN : SDL_EVENT_PEN_BUTTON_UP;
+                sdl_ev.pbutton.timestamp = e.timestamp;
+                sdl_ev.pbutton.windowID = e.id.value();
+                sdl_ev.pbutton.which = e.which;
+                sdl_ev.pbutton.pen_state = e.pen_state;
+                sdl_ev.pbutton.x = e.x;
+                sdl_ev.pbutton.y = e.y;
+                sdl_ev.pbutton.button = e.button;
+                sdl_ev.pbutton.down = down;
+            },
+            [&](const pen_axis_event& e) {
+                sdl_ev.type = SDL_EVENT_PEN_AXIS;
+                sdl_ev.paxis.timestamp = e.timestamp;
+                sdl_ev.paxis.windowID = e.id.value();
+                sdl_ev.paxis.which = e.which;
+                sdl_ev.paxis.pen_state = e.pen_state;
+                sdl_ev.paxis.x = e.x;
+                sdl_ev.paxis.y = e.y;
+                sdl_ev.paxis.axis = static_cast<SDL_PenAxis>(e.axis);
+                sdl_ev.paxis.value = e.value;
+            },
+            [&](const keymap_changed_event& e) {
+                sdl_ev.type = SDL_EVENT_KEYMAP_CHANGED;
+                sdl_ev.common.timestamp = e.timestamp;
+            },
+            [&](const display_event& e) {
+                sdl_ev.type = SDL_EVENT_DISPLAY_ORIENTATION + static_cast<std::uint32_t>(e.display_change);
+                sdl_ev.display.timestamp = e.timestamp;
+                sdl_ev.display.displayID = e.id.value();
+                sdl_ev.display.data1 = e.data;
+            },
+        },
+        ev);
+}
+
 }  // namespace laya
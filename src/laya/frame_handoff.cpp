@@ -0,0 +1,82 @@
+/// @file frame_handoff.cpp
+/// @date 2026-10-17
+
+#include <laya/renderers/frame_handoff.hpp>
+#include <laya/renderers/renderer.hpp>
+
+namespace laya {
+
+bool frame_handoff::submit() {
+    const auto wait_start = std::chrono::steady_clock::now();
+    std::unique_lock lock{m_mutex};
+    m_list_released.wait(lock, [this] { return m_closed || (!m_pending && !m_replaying); });
+    m_stats.submit_wait += std::chrono::steady_clock::now() - wait_start;
+    if (m_closed) {
+        return false;
+    }
+
+    m_recording = 1 - m_recording;
+    m_pending = true;
+    ++m_stats.frames_submitted;
+    lock.unlock();
+    m_frame_ready.notify_one();
+
+    // render() is done with the list we get back, so it can be emptied without the lock
+    recording().reset();
+    return true;
+}
+
+bool frame_handoff::render(renderer& r, std::chrono::nanoseconds timeout) {
+    const auto wait_start = std::chrono::steady_clock::now();
+    std::unique_lock lock{m_mutex};
+    const auto ready = [this] { return m_closed || m_pending; };
+    if (timeout == std::chrono::nanoseconds::max()) {
+        m_frame_ready.wait(lock, ready);
+    } else {
+        m_frame_ready.wait_for(lock, timeout, ready);
+    }
+    m_stats.render_wait += std::chrono::steady_clock::now() - wait_start;
+    if (!m_pending) {
+        return false;
+    }
+
+    m_pending = false;
+    m_replaying = true;
+    const command_list& frame = m_lists[static_cast<std::size_t>(1 - m_recording)];
+    lock.unlock();
+
+    try {
+        frame.replay(r);
+        r.present();
+    } catch (...) {
+        release_replayed();
+        throw;
+    }
+    release_replayed();
+    return true;
+}
+
+void frame_handoff::release_replayed() noexcept {
+    {
+        std::lock_guard lock{m_mutex};
+        m_replaying = false;
+        ++m_stats.frames_rendered;
+    }
+    m_list_released.notify_one();
+}
+
+void frame_handoff::close() {
+    {
+        std::lock_guard lock{m_mutex};
+        m_closed = true;
+    }
+    m_frame_ready.notify_all();
+    m_list_released.notify_all();
+}
+
+frame_handoff_stats frame_handoff::stats() const {
+    std::lock_guard lock{m_mutex};
+    return m_stats;
+}
+
+}  // namespace laya
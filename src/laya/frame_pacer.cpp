@@ -0,0 +1,155 @@
+/// @file frame_pacer.cpp
+/// @date 2026-10-17
+
+#include <algorithm>
+#include <cstdint>
+
+#include <laya/displays/display.hpp>
+#include <laya/displays/frame_pacer.hpp>
+#include <laya/errors.hpp>
+#include <laya/windows/window.hpp>
+
+namespace laya {
+
+frame_pacer::frame_pacer(std::chrono::nanoseconds fallback) noexcept : m_fallback{fallback} {
+}
+
+void frame_pacer::track(const window& win) {
+    track(win.id(), display::of(win).id());
+}
+
+void frame_pacer::track(window_id id, display_id display) {
+    const auto duration = duration_of(display);
+    if (auto* paced = find(id)) {
+        paced->display = display;
+        paced->duration = duration;
+        return;
+    }
+    m_windows.push_back(paced_window{id, display, duration});
+}
+
+bool frame_pacer::untrack(window_id id) noexcept {
+    return std::erase_if(m_windows, [id](const paced_window& paced) { return paced.id == id; }) != 0;
+}
+
+void frame_pacer::set_refresh_rate(display_id display, float hz) {
+    const std::chrono::nanoseconds duration =
+        hz > 0.0f ? std::chrono::nanoseconds{static_cast<std::int64_t>(1'000'000'000.0 / hz)} : m_fallback;
+
+    store_rate(display, duration);
+    retune(display);
+}
+
+bool frame_pacer::handle(const event& ev) {
+    if (const auto* win_ev = std::get_if<window_event>(&ev)) {
+        const auto target = get_display(*win_ev);
+        auto* paced = target ? find(win_ev->id) : nullptr;
+        if (!paced) {
+            return false;
+        }
+
+        // SDL reports the display id, not an index, in display_changed events
+        const display_id display{static_cast<std::uint32_t>(target->display_index)};
+        const auto duration = duration_of(display);
+        const bool changed = duration != paced->duration;
+        paced->display = display;
+        paced->duration = duration;
+        return changed;
+    }
+
+    if (const auto* display_ev = std::get_if<display_event>(&ev)) {
+        switch (display_ev->display_change) {
+            case display_event::type::current_mode_changed:
+            case display_event::type::desktop_mode_changed:
+                store_rate(display_ev->id, query_duration(display_ev->id));
+                return retune(display_ev->id);
+            case display_event::type::removed:
+                std::erase_if(m_rates,
+                              [display_ev](const display_rate& rate) { return rate.display == display_ev->id; });
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    return false;
+}
+
+std::chrono::nanoseconds frame_pacer::frame_duration(window_id id) const noexcept {
+    const auto* paced = find(id);
+    return paced ? paced->duration : m_fallback;
+}
+
+double frame_pacer::refresh_rate(window_id id) const noexcept {
+    const auto duration = frame_duration(id);
+    return duration.count() > 0 ? 1'000'000'000.0 / static_cast<double>(duration.count()) : 0.0;
+}
+
+display_id frame_pacer::display_of(window_id id) const noexcept {
+    const auto* paced = find(id);
+    return paced ? paced->display : display_id{};
+}
+
+std::chrono::nanoseconds frame_pacer::duration_of(display_id display) {
+    if (const auto* rate = find_rate(display)) {
+        return rate->duration;
+    }
+
+    const auto duration = query_duration(display);
+    m_rates.push_back(display_rate{display, duration});
+    return duration;
+}
+
+void frame_pacer::store_rate(display_id display, std::chrono::nanoseconds duration) {
+    if (auto* rate = find_rate(display)) {
+        rate->duration = duration;
+    } else {
+        m_rates.push_back(display_rate{display, duration});
+    }
+}
+
+std::chrono::nanoseconds frame_pacer::query_duration(display_id display) const noexcept {
+    try {
+        const auto duration = laya::display{display}.current_mode().frame_duration();
+        return duration.count() > 0 ? duration : m_fallback;
+    } catch (const error&) {
+        // The display may already be gone, keep pacing at the fallback rate
+        return m_fallback;
+    }
+}
+
+bool frame_pacer::retune(display_id display) noexcept {
+    const auto* rate = find_rate(display);
+    if (!rate) {
+        return false;
+    }
+
+    bool changed = false;
+    for (auto& paced : m_windows) {
+        if (paced.display == display && paced.duration != rate->duration) {
+            paced.duration = rate->duration;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+frame_pacer::display_rate* frame_pacer::find_rate(display_id display) noexcept {
+    const auto it = std::find_if(m_rates.begin(), m_rates.end(),
+                                 [display](const display_rate& rate) { return rate.display == display; });
+    return it != m_rates.end() ? &*it : nullptr;
+}
+
+frame_pacer::paced_window* frame_pacer::find(window_id id) noexcept {
+    const auto it =
+        std::find_if(m_windows.begin(), m_windows.end(), [id](const paced_window& paced) { return paced.id == id; });
+    return it != m_windows.end() ? &*it : nullptr;
+}
+
+const frame_pacer::paced_window* frame_pacer::find(window_id id) const noexcept {
+    const auto it =
+        std::find_if(m_windows.begin(), m_windows.end(), [id](const paced_window& paced) { return paced.id == id; });
+    return it != m_windows.end() ? &*it : nullptr;
+}
+
+}  // namespace laya
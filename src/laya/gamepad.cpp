@@ -0,0 +1,121 @@
+/// @file gamepad.cpp
+/// @date 2026-10-17
+
+#include <utility>
+
+#include <laya/input/gamepad.hpp>
+#include <laya/input/joystick.hpp>
+#include <laya/errors.hpp>
+#include <laya/subsystems.hpp>
+
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+static_assert(static_cast<int>(gamepad_axis::count) == SDL_GAMEPAD_AXIS_COUNT);
+static_assert(static_cast<int>(gamepad_button::count) == SDL_GAMEPAD_BUTTON_COUNT);
+
+namespace {
+
+SDL_Gamepad* open_gamepad(std::uint32_t instance_id) {
+    use_subsystem(subsystem::gamepad);
+    return SDL_OpenGamepad(instance_id);
+}
+
+}  // namespace
+
+std::vector<std::uint32_t> gamepad_ids() {
+    use_subsystem(subsystem::gamepad);
+    int count = 0;
+    SDL_JoystickID* ids = SDL_GetGamepads(&count);
+    if (!ids) {
+        throw error::from_sdl();
+    }
+
+    std::vector<std::uint32_t> result(ids, ids + count);
+    SDL_free(ids);
+    return result;
+}
+
+bool is_gamepad(std::uint32_t instance_id) {
+    use_subsystem(subsystem::gamepad);
+    return SDL_IsGamepad(instance_id);
+}
+
+// ============================================================================
+// gamepad implementation
+// ============================================================================
+
+gamepad::gamepad(std::uint32_t instance_id) : m_gamepad{open_gamepad(instance_id)}, m_id{instance_id} {
+    if (!m_gamepad) {
+        throw error::from_sdl();
+    }
+}
+
+gamepad::~gamepad() noexcept {
+    if (m_gamepad) {
+        SDL_CloseGamepad(m_gamepad);
+    }
+}
+
+gamepad::gamepad(gamepad&& other) noexcept
+    : m_gamepad{std::exchange(other.m_gamepad, nullptr)}, m_id{std::exchange(other.m_id, 0)} {
+}
+
+gamepad& gamepad::operator=(gamepad&& other) noexcept {
+    if (this != &other) {
+        if (m_gamepad) {
+            SDL_CloseGamepad(m_gamepad);
+        }
+        m_gamepad = std::exchange(other.m_gamepad, nullptr);
+        m_id = std::exchange(other.m_id, 0);
+    }
+    return *this;
+}
+
+std::string_view gamepad::name() const {
+    const char* name = SDL_GetGamepadName(m_gamepad);
+    return name ? name : "";
+}
+
+bool gamepad::is_connected() const {
+    return SDL_GamepadConnected(m_gamepad);
+}
+
+std::int16_t gamepad::axis(gamepad_axis a) const {
+    return SDL_GetGamepadAxis(m_gamepad, static_cast<SDL_GamepadAxis>(a));
+}
+
+bool gamepad::button(gamepad_button b) const {
+    return SDL_GetGamepadButton(m_gamepad, static_cast<SDL_GamepadButton>(b));
+}
+
+// ============================================================================
+// gamepad_snapshot implementation
+// ============================================================================
+
+void gamepad_snapshot::capture(std::span<const gamepad> gamepads) {
+    m_states.resize(gamepads.size());
+
+    // See joystick_snapshot::capture, one lock for the whole pass
+    const joystick_lock lock;
+    for (std::size_t i = 0; i < gamepads.size(); ++i) {
+        SDL_Gamepad* handle = gamepads[i].native_handle();
+        gamepad_state& state = m_states[i];
+
+        state.id = gamepads[i].id();
+        for (int a = 0; a < SDL_GAMEPAD_AXIS_COUNT; ++a) {
+            state.axes[static_cast<std::size_t>(a)] = SDL_GetGamepadAxis(handle, static_cast<SDL_GamepadAxis>(a));
+        }
+
+        std::uint32_t buttons = 0;
+        for (int b = 0; b < SDL_GAMEPAD_BUTTON_COUNT; ++b) {
+            if (SDL_GetGamepadButton(handle, static_cast<SDL_GamepadButton>(b))) {
+                buttons |= 1u << b;
+            }
+        }
+        state.buttons = buttons;
+    }
+}
+
+}  // namespace laya
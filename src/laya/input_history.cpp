@@ -0,0 +1,214 @@
+/// @file input_history.cpp
+/// @date 2026-10-17
+
+#include <algorithm>
+
+#include <laya/input/input_history.hpp>
+
+namespace laya {
+
+// ============================================================================
+// input_history implementation
+// ============================================================================
+
+input_history::input_history(std::size_t capacity) : m_records(capacity == 0 ? 1 : capacity), m_end{0}, m_first{0} {
+}
+
+void input_history::push(const input_record& record) noexcept {
+    m_records[static_cast<std::size_t>(m_end % m_records.size())] = record;
+    ++m_end;
+    if (m_end - m_first > m_records.size()) {
+        ++m_first;
+    }
+}
+
+bool input_history::record(const event& ev) noexcept {
+    if (const auto* e = std::get_if<key_event>(&ev)) {
+        if (e->repeat) {
+            return false;
+        }
+        push(input_record{e->timestamp, 0, static_cast<std::uint16_t>(e->scancode), input_device::key,
+                          e->key_state == key_event::state::pressed});
+        return true;
+    }
+    if (const auto* e = std::get_if<mouse_button_event>(&ev)) {
+        push(input_record{e->timestamp, e->which, static_cast<std::uint16_t>(e->mouse_button), input_device::mouse,
+                          e->button_state == mouse_button_event::state::pressed});
+        return true;
+    }
+    if (const auto* e = std::get_if<gamepad_button_event>(&ev)) {
+        push(input_record{e->timestamp, e->which, static_cast<std::uint16_t>(e->button), input_device::gamepad,
+                          e->button_state == gamepad_button_event::state::pressed});
+        return true;
+    }
+    return false;
+}
+
+void input_history::clear() noexcept {
+    m_first = m_end;
+}
+
+sample_view<input_record> input_history::since(std::uint64_t since) const noexcept {
+    return view(lower_bound(since), m_end);
+}
+
+sample_view<input_record> input_history::between(std::uint64_t begin, std::uint64_t end) const noexcept {
+    if (end <= begin) {
+        return {};
+    }
+    return view(lower_bound(begin), lower_bound(end));
+}
+
+sample_view<input_record> input_history::from_sequence(std::uint64_t sequence) const noexcept {
+    return view(std::clamp(sequence, m_first, m_end), m_end);
+}
+
+std::uint64_t input_history::lower_bound(std::uint64_t timestamp) const noexcept {
+    // Binary search over sequence numbers, the ring keeps them in timestamp order
+    std::uint64_t low = m_first;
+    std::uint64_t high = m_end;
+    while (low < high) {
+        const std::uint64_t mid = low + (high - low) / 2;
+        if (at(mid).timestamp < timestamp) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+sample_view<input_record> input_history::view(std::uint64_t first, std::uint64_t last) const noexcept {
+    const std::span<const input_record> all{m_records};
+    const std::size_t cap = m_records.size();
+    const auto start = static_cast<std::size_t>(first % cap);
+    const auto count = static_cast<std::size_t>(last - first);
+    if (start + count <= cap) {
+        return {all.subspan(start, count), {}};
+    }
+    return {all.subspan(start), all.first(start + count - cap)};
+}
+
+// ============================================================================
+// multi_click_detector implementation
+// ============================================================================
+
+multi_click_detector::multi_click_detector(input_code input, std::uint32_t clicks,
+                                           std::uint64_t max_interval_ns) noexcept
+    : m_input{input}, m_clicks{clicks == 0 ? 1 : clicks}, m_max_interval{max_interval_ns} {
+}
+
+std::size_t multi_click_detector::update(const input_history& history) noexcept {
+    const auto records = history.from_sequence(m_cursor);
+    m_cursor = history.end_sequence();
+
+    std::size_t completed = 0;
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const auto& record = records[i];
+        if (!record.pressed || record.input() != m_input) {
+            continue;
+        }
+
+        const bool in_time = m_streak > 0 && record.timestamp - m_last_press <= m_max_interval;
+        m_streak = in_time ? m_streak + 1 : 1;
+        m_last_press = record.timestamp;
+
+        if (m_streak == m_clicks) {
+            ++completed;
+            m_last_timestamp = record.timestamp;
+            m_streak = 0;
+        }
+    }
+    return completed;
+}
+
+// ============================================================================
+// hold_detector implementation
+// ============================================================================
+
+hold_detector::hold_detector(input_code input, std::uint64_t duration_ns) noexcept
+    : m_input{input}, m_duration{duration_ns} {
+}
+
+bool hold_detector::update(const input_history& history, std::uint64_t now_ns) noexcept {
+    const auto records = history.from_sequence(m_cursor);
+    m_cursor = history.end_sequence();
+
+    // Only the latest press or release of the watched input matters
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const auto& record = records[i];
+        if (record.input() != m_input) {
+            continue;
+        }
+        if (record.pressed && !m_down) {
+            m_press_timestamp = record.timestamp;
+            m_fired = false;
+        }
+        m_down = record.pressed;
+    }
+
+    if (m_down && !m_fired && now_ns >= m_press_timestamp && now_ns - m_press_timestamp >= m_duration) {
+        m_fired = true;
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// sequence_detector implementation
+// ============================================================================
+
+sequence_detector::sequence_detector(std::span<const input_code> steps, std::uint64_t max_step_interval_ns)
+    : m_steps(steps.begin(), steps.end()), m_fallback(m_steps.size(), 0), m_max_interval{max_step_interval_ns} {
+    // KMP failure table: m_fallback[i] is the length of the longest proper prefix of steps[0..i] that
+    // is also a suffix of it
+    std::size_t length = 0;
+    for (std::size_t i = 1; i < m_steps.size(); ++i) {
+        while (length > 0 && m_steps[i] != m_steps[length]) {
+            length = m_fallback[length - 1];
+        }
+        if (m_steps[i] == m_steps[length]) {
+            ++length;
+        }
+        m_fallback[i] = length;
+    }
+}
+
+std::size_t sequence_detector::update(const input_history& history) noexcept {
+    const auto records = history.from_sequence(m_cursor);
+    m_cursor = history.end_sequence();
+
+    if (m_steps.empty()) {
+        return 0;
+    }
+
+    std::size_t completed = 0;
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        const auto& record = records[i];
+        if (!record.pressed) {
+            continue;
+        }
+
+        // A late press can only start a new attempt
+        if (m_progress > 0 && record.timestamp - m_last_step > m_max_interval) {
+            m_progress = 0;
+        }
+
+        // A wrong press keeps the longest run of recent presses that still starts the sequence
+        while (m_progress > 0 && record.input() != m_steps[m_progress]) {
+            m_progress = m_fallback[m_progress - 1];
+        }
+        if (record.input() == m_steps[m_progress]) {
+            ++m_progress;
+        }
+        m_last_step = record.timestamp;
+
+        if (m_progress == m_steps.size()) {
+            ++completed;
+            m_progress = 0;
+        }
+    }
+    return completed;
+}
+
+}  // namespace laya
@@ -0,0 +1,353 @@
+/// @file job_system.cpp
+/// @date 2026-10-17
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+
+#include <laya/tasks/job_system.hpp>
+
+namespace laya {
+
+namespace detail {
+
+/// Shared state of a submitted job
+struct job {
+    std::unique_ptr<task> work;
+    job_affinity affinity = job_affinity::any;
+
+    /// Dependencies still running, plus one held by submit until all of them are registered
+    std::atomic<std::uint32_t> unfinished{1};
+    std::atomic<bool> finished{false};
+    std::exception_ptr failure;  ///< Written before finished is set
+
+    std::mutex dependents_mutex;
+    std::vector<std::shared_ptr<job>> dependents;  ///< Guarded by dependents_mutex
+    bool dependents_released = false;              ///< Guarded by dependents_mutex
+};
+
+/// A worker's deque and counters, one cache line apart from its neighbours
+struct alignas(64) job_worker {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<job>> jobs;  ///< Owner uses the back, thieves the front
+
+    std::atomic<std::uint64_t> jobs_executed{0};
+    std::atomic<std::uint64_t> steals{0};
+    std::atomic<std::int64_t> idle_ns{0};
+
+    [[nodiscard]] job_system_stats snapshot() const noexcept {
+        return {jobs_executed.load(std::memory_order_relaxed), steals.load(std::memory_order_relaxed),
+                std::chrono::nanoseconds{idle_ns.load(std::memory_order_relaxed)}};
+    }
+
+    void reset() noexcept {
+        jobs_executed.store(0, std::memory_order_relaxed);
+        steals.store(0, std::memory_order_relaxed);
+        idle_ns.store(0, std::memory_order_relaxed);
+    }
+};
+
+}  // namespace detail
+
+namespace {
+
+/// The job system and worker index of the calling thread, if it is a worker
+struct worker_identity {
+    const job_system* system = nullptr;
+    std::size_t index = 0;
+};
+
+thread_local worker_identity t_worker;
+
+}  // namespace
+
+// ============================================================================
+// job_handle implementation
+// ============================================================================
+
+job_handle::job_handle(std::shared_ptr<detail::job> job) noexcept : m_job{std::move(job)} {
+}
+
+bool job_handle::valid() const noexcept {
+    return m_job != nullptr;
+}
+
+bool job_handle::done() const noexcept {
+    return !m_job || m_job->finished.load(std::memory_order_acquire);
+}
+
+// ============================================================================
+// job_system implementation
+// ============================================================================
+
+job_system::job_system(const job_system_args& args)
+    : m_external{std::make_unique<detail::job_worker>()}, m_main_thread{std::this_thread::get_id()} {
+    std::size_t count = args.thread_count;
+    if (count == 0) {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        count = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    m_workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        m_workers.push_back(std::make_unique<detail::job_worker>());
+    }
+
+    m_threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        m_threads.emplace_back([this, i](std::stop_token stop) { worker_loop(stop, i); });
+    }
+}
+
+job_system::~job_system() noexcept {
+    for (auto& thread : m_threads) {
+        thread.request_stop();
+    }
+    m_threads.clear();
+}
+
+job_handle job_system::submit_task(std::unique_ptr<detail::task> work, std::span<const job_handle> dependencies,
+                                   job_affinity affinity) {
+    auto job = std::make_shared<detail::job>();
+    job->work = std::move(work);
+    job->affinity = affinity;
+
+    for (const auto& dependency : dependencies) {
+        if (!dependency.m_job) {
+            continue;
+        }
+        std::lock_guard lock{dependency.m_job->dependents_mutex};
+        if (!dependency.m_job->dependents_released) {
+            job->unfinished.fetch_add(1, std::memory_order_relaxed);
+            dependency.m_job->dependents.push_back(job);
+        }
+    }
+
+    // Drop the hold taken at construction, the job is ready if every dependency already finished
+    if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        schedule(job);
+    }
+    return job_handle{std::move(job)};
+}
+
+void job_system::schedule(std::shared_ptr<detail::job> job) {
+    if (job->affinity == job_affinity::main_thread) {
+        m_main_jobs.push([this, job = std::move(job)] { execute(*job, *m_external); });
+        return;
+    }
+
+    // Workers keep their own jobs local, everyone else spreads them out
+    const std::size_t target = t_worker.system == this
+                                   ? t_worker.index
+                                   : m_next_worker.fetch_add(1, std::memory_order_relaxed) % m_workers.size();
+    {
+        std::lock_guard lock{m_workers[target]->mutex};
+        m_workers[target]->jobs.push_back(std::move(job));
+    }
+
+    // Paired with the sleeping count in worker_loop so a worker going to sleep cannot miss this job
+    m_queued.fetch_add(1);
+    if (m_sleeping.load() > 0) {
+        { std::lock_guard lock{m_sleep_mutex}; }
+        m_wake.notify_one();
+    }
+}
+
+void job_system::execute(detail::job& job, detail::job_worker& counters) {
+    try {
+        job.work->run();
+    } catch (...) {
+        job.failure = std::current_exception();
+    }
+    job.work.reset();
+    counters.jobs_executed.fetch_add(1, std::memory_order_relaxed);
+    finish(job);
+}
+
+void job_system::finish(detail::job& job) {
+    std::vector<std::shared_ptr<detail::job>> dependents;
+    {
+        std::lock_guard lock{job.dependents_mutex};
+        job.dependents_released = true;
+        dependents.swap(job.dependents);
+    }
+    job.finished.store(true, std::memory_order_release);
+
+    for (auto& dependent : dependents) {
+        if (dependent->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            schedule(std::move(dependent));
+        }
+    }
+}
+
+std::shared_ptr<detail::job> job_system::find_job(std::size_t own_index, detail::job_worker& counters) {
+    const std::size_t count = m_workers.size();
+
+    if (own_index < count) {
+        auto& own = *m_workers[own_index];
+        std::lock_guard lock{own.mutex};
+        if (!own.jobs.empty()) {
+            auto job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            m_queued.fetch_sub(1);
+            return job;
+        }
+    }
+
+    // Start after our own deque so thieves do not all hit worker 0 first
+    for (std::size_t offset = 1; offset <= count; ++offset) {
+        const std::size_t victim = (own_index + offset) % count;
+        if (victim == own_index) {
+            continue;
+        }
+        auto& other = *m_workers[victim];
+        std::lock_guard lock{other.mutex};
+        if (!other.jobs.empty()) {
+            auto job = std::move(other.jobs.front());
+            other.jobs.pop_front();
+            m_queued.fetch_sub(1);
+            counters.steals.fetch_add(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+bool job_system::help_once() {
+    const bool is_worker = t_worker.system == this;
+    const std::size_t own_index = is_worker ? t_worker.index : m_workers.size();
+    auto& counters = is_worker ? *m_workers[own_index] : *m_external;
+
+    if (auto job = find_job(own_index, counters)) {
+        execute(*job, counters);
+        return true;
+    }
+    if (std::this_thread::get_id() == m_main_thread) {
+        return m_main_jobs.drain(std::chrono::nanoseconds{0}) > 0;
+    }
+    return false;
+}
+
+void job_system::wait(const job_handle& handle) {
+    while (!handle.done()) {
+        if (!help_once()) {
+            std::this_thread::yield();
+        }
+    }
+    if (handle.m_job && handle.m_job->failure) {
+        std::rethrow_exception(handle.m_job->failure);
+    }
+}
+
+void job_system::run_parallel_for(int first, int last, int grain, range_fn fn, void* context) {
+    if (last <= first) {
+        return;
+    }
+
+    const int rows = last - first;
+    if (grain <= 0) {
+        const int target_chunks = static_cast<int>(4 * (m_workers.size() + 1));
+        grain = std::max(1, (rows + target_chunks - 1) / target_chunks);
+    }
+    const int chunks = (rows + grain - 1) / grain;
+    if (chunks == 1) {
+        fn(context, first, last);
+        return;
+    }
+
+    // Helpers and the caller claim chunks from one counter, so no chunk is queued on its own
+    std::atomic<int> next_chunk{0};
+    std::mutex failure_mutex;
+    std::exception_ptr failure;
+    auto run_chunks = [&] {
+        for (;;) {
+            const int chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunks) {
+                return;
+            }
+            const int row_begin = first + chunk * grain;
+            const int row_end = std::min(last, row_begin + grain);
+            try {
+                fn(context, row_begin, row_end);
+            } catch (...) {
+                std::lock_guard lock{failure_mutex};
+                if (!failure) {
+                    failure = std::current_exception();
+                }
+            }
+        }
+    };
+
+    const std::size_t helper_count = std::min(static_cast<std::size_t>(chunks - 1), m_workers.size());
+    std::vector<job_handle> helpers;
+    helpers.reserve(helper_count);
+    for (std::size_t i = 0; i < helper_count; ++i) {
+        helpers.push_back(submit(run_chunks));
+    }
+
+    run_chunks();
+
+    // The helpers reference this frame, wait for every one of them, not just for the last chunk
+    for (const auto& helper : helpers) {
+        wait(helper);
+    }
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+std::size_t job_system::run_main_thread_jobs(std::chrono::nanoseconds budget) {
+    return m_main_jobs.drain(budget);
+}
+
+job_system_stats job_system::stats() const noexcept {
+    job_system_stats total = m_external->snapshot();
+    for (const auto& worker : m_workers) {
+        const auto counters = worker->snapshot();
+        total.jobs_executed += counters.jobs_executed;
+        total.steals += counters.steals;
+        total.idle_time += counters.idle_time;
+    }
+    return total;
+}
+
+job_system_stats job_system::worker_stats(std::size_t index) const {
+    return m_workers.at(index)->snapshot();
+}
+
+void job_system::reset_stats() noexcept {
+    m_external->reset();
+    for (auto& worker : m_workers) {
+        worker->reset();
+    }
+}
+
+void job_system::worker_loop(std::stop_token stop, std::size_t index) {
+    t_worker = {this, index};
+    auto& self = *m_workers[index];
+
+    for (;;) {
+        if (auto job = find_job(index, self)) {
+            execute(*job, self);
+            continue;
+        }
+
+        // Queued jobs are finished before stopping, so only stop once the deques are empty
+        if (stop.stop_requested()) {
+            return;
+        }
+
+        const auto idle_start = std::chrono::steady_clock::now();
+        {
+            std::unique_lock lock{m_sleep_mutex};
+            m_sleeping.fetch_add(1);
+            m_wake.wait(lock, stop, [this] { return m_queued.load() > 0; });
+            m_sleeping.fetch_sub(1);
+        }
+        const auto idle = std::chrono::steady_clock::now() - idle_start;
+        self.idle_ns.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(idle).count(),
+                               std::memory_order_relaxed);
+    }
+}
+
+}  // namespace laya
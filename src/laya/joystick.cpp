@@ -0,0 +1,158 @@
+/// @file joystick.cpp
+/// @date 2026-10-17
+
+#include <utility>
+
+#include <laya/input/joystick.hpp>
+#include <laya/errors.hpp>
+#include <laya/subsystems.hpp>
+
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+namespace {
+
+SDL_Joystick* open_joystick(std::uint32_t instance_id) {
+    use_subsystem(subsystem::joystick);
+    return SDL_OpenJoystick(instance_id);
+}
+
+}  // namespace
+
+std::vector<std::uint32_t> joystick_ids() {
+    use_subsystem(subsystem::joystick);
+    int count = 0;
+    SDL_JoystickID* ids = SDL_GetJoysticks(&count);
+    if (!ids) {
+        throw error::from_sdl();
+    }
+
+    std::vector<std::uint32_t> result(ids, ids + count);
+    SDL_free(ids);
+    return result;
+}
+
+// ============================================================================
+// joystick implementation
+// ============================================================================
+
+joystick::joystick(std::uint32_t instance_id)
+    : m_joystick{open_joystick(instance_id)}, m_id{instance_id}, m_axis_count{0}, m_button_count{0}, m_hat_count{0} {
+    if (!m_joystick) {
+        throw error::from_sdl();
+    }
+
+    m_axis_count = SDL_GetNumJoystickAxes(m_joystick);
+    m_button_count = SDL_GetNumJoystickButtons(m_joystick);
+    m_hat_count = SDL_GetNumJoystickHats(m_joystick);
+
+    // The queries return -1 on failure, which must not reach the snapshot as a count
+    if (m_axis_count < 0 || m_button_count < 0 || m_hat_count < 0) {
+        auto failure = error::from_sdl();
+        SDL_CloseJoystick(m_joystick);
+        throw failure;
+    }
+}
+
+joystick::~joystick() noexcept {
+    if (m_joystick) {
+        SDL_CloseJoystick(m_joystick);
+    }
+}
+
+joystick::joystick(joystick&& other) noexcept
+    : m_joystick{std::exchange(other.m_joystick, nullptr)},
+      m_id{std::exchange(other.m_id, 0)},
+      m_axis_count{std::exchange(other.m_axis_count, 0)},
+      m_button_count{std::exchange(other.m_button_count, 0)},
+      m_hat_count{std::exchange(other.m_hat_count, 0)} {
+}
+
+joystick& joystick::operator=(joystick&& other) noexcept {
+    if (this != &other) {
+        if (m_joystick) {
+            SDL_CloseJoystick(m_joystick);
+        }
+        m_joystick = std::exchange(other.m_joystick, nullptr);
+        m_id = std::exchange(other.m_id, 0);
+        m_axis_count = std::exchange(other.m_axis_count, 0);
+        m_button_count = std::exchange(other.m_button_count, 0);
+        m_hat_count = std::exchange(other.m_hat_count, 0);
+    }
+    return *this;
+}
+
+std::string_view joystick::name() const {
+    const char* name = SDL_GetJoystickName(m_joystick);
+    return name ? name : "";
+}
+
+bool joystick::is_connected() const {
+    return SDL_JoystickConnected(m_joystick);
+}
+
+std::int16_t joystick::axis(int index) const {
+    return SDL_GetJoystickAxis(m_joystick, index);
+}
+
+bool joystick::button(int index) const {
+    return SDL_GetJoystickButton(m_joystick, index);
+}
+
+std::uint8_t joystick::hat(int index) const {
+    return SDL_GetJoystickHat(m_joystick, index);
+}
+
+// ============================================================================
+// joystick_lock implementation
+// ============================================================================
+
+joystick_lock::joystick_lock() noexcept {
+    SDL_LockJoysticks();
+}
+
+joystick_lock::~joystick_lock() noexcept {
+    SDL_UnlockJoysticks();
+}
+
+// ============================================================================
+// joystick_snapshot implementation
+// ============================================================================
+
+void joystick_snapshot::capture(std::span<const joystick> joysticks) {
+    m_devices.clear();
+    m_axes.clear();
+    m_buttons.clear();
+    m_hats.clear();
+
+    // Every SDL joystick query takes the joystick lock; holding it once for the
+    // whole pass keeps the per-value calls to an uncontended recursive re-lock
+    const joystick_lock lock;
+    for (const auto& stick : joysticks) {
+        SDL_Joystick* handle = stick.native_handle();
+
+        device_slice device{};
+        device.id = stick.id();
+        device.axis_offset = static_cast<std::uint32_t>(m_axes.size());
+        device.button_offset = static_cast<std::uint32_t>(m_buttons.size());
+        device.hat_offset = static_cast<std::uint32_t>(m_hats.size());
+        device.axis_count = static_cast<std::uint16_t>(stick.axis_count());
+        device.button_count = static_cast<std::uint16_t>(stick.button_count());
+        device.hat_count = static_cast<std::uint16_t>(stick.hat_count());
+
+        for (int i = 0; i < stick.axis_count(); ++i) {
+            m_axes.push_back(SDL_GetJoystickAxis(handle, i));
+        }
+        for (int i = 0; i < stick.button_count(); ++i) {
+            m_buttons.push_back(SDL_GetJoystickButton(handle, i) ? 1 : 0);
+        }
+        for (int i = 0; i < stick.hat_count(); ++i) {
+            m_hats.push_back(SDL_GetJoystickHat(handle, i));
+        }
+
+        m_devices.push_back(device);
+    }
+}
+
+}  // namespace laya
@@ -1,6 +1,10 @@
 /// @file keyboard.cpp
 /// @date 2025-12-14
 
+#include <array>
+#include <atomic>
+#include <unordered_map>
+
 #include <laya/input/keyboard.hpp>
 #include <laya/errors.hpp>
 
@@ -8,6 +12,84 @@
 
 namespace laya {
 
+namespace {
+
+/// Bumped by invalidate_keycode_cache(), which runs on whatever thread converts events
+std::atomic<std::uint64_t> keymap_generation{0};
+
+/// Memoized results of SDL_GetScancodeFromKey
+/// @note SDL resolves keycodes by searching its keymap. Nearly every keycode is either below
+///       `direct_slots` (ASCII, Latin-1) or a scancode-masked key, so both get a flat table and
+///       only the remaining Unicode keycodes fall back to a hash map.
+/// @note Each thread owns its cache and only that thread touches the tables. Invalidation only
+///       bumps keymap_generation, and a cache resets itself on its next lookup after the bump.
+class keycode_cache {
+public:
+    keycode_cache() noexcept : m_generation{keymap_generation.load(std::memory_order_acquire)} {
+        reset_tables();
+    }
+
+    SDL_Scancode lookup(SDL_Keycode key) {
+        const std::uint64_t generation = keymap_generation.load(std::memory_order_acquire);
+        if (generation != m_generation) {
+            reset();
+            m_generation = generation;
+        }
+
+        if (std::uint16_t* slot = direct_slot(key)) {
+            if (*slot == not_cached) {
+                *slot = static_cast<std::uint16_t>(SDL_GetScancodeFromKey(key, nullptr));
+            }
+            return static_cast<SDL_Scancode>(*slot);
+        }
+
+        auto [it, inserted] = m_other.try_emplace(key, SDL_SCANCODE_UNKNOWN);
+        if (inserted) {
+            it->second = SDL_GetScancodeFromKey(key, nullptr);
+        }
+        return it->second;
+    }
+
+    void reset() noexcept {
+        reset_tables();
+        m_other.clear();
+    }
+
+private:
+    static constexpr std::size_t direct_slots = 512;
+    static constexpr std::uint16_t not_cached = 0xFFFF;
+
+    static_assert(SDL_SCANCODE_COUNT < not_cached, "scancodes must fit below the not_cached marker");
+
+    std::uint16_t* direct_slot(SDL_Keycode key) noexcept {
+        if (key < direct_slots) {
+            return &m_plain[key];
+        }
+        const SDL_Keycode low = key & ~SDLK_SCANCODE_MASK;
+        if ((key & SDLK_SCANCODE_MASK) != 0 && low < direct_slots) {
+            return &m_masked[low];
+        }
+        return nullptr;
+    }
+
+    void reset_tables() noexcept {
+        m_plain.fill(not_cached);
+        m_masked.fill(not_cached);
+    }
+
+    std::array<std::uint16_t, direct_slots> m_plain;   ///< Indexed by keycode
+    std::array<std::uint16_t, direct_slots> m_masked;  ///< Indexed by keycode without SDLK_SCANCODE_MASK
+    std::unordered_map<SDL_Keycode, SDL_Scancode> m_other;
+    std::uint64_t m_generation;
+};
+
+keycode_cache& cached_keycodes() {
+    thread_local keycode_cache cache;
+    return cache;
+}
+
+}  // anonymous namespace
+
 const std::uint8_t* get_keyboard_state(int* num_keys) {
     const auto* state = SDL_GetKeyboardState(num_keys);
     return reinterpret_cast<const std::uint8_t*>(state);
@@ -25,8 +107,7 @@ bool is_key_pressed(scancode key) {
 }
 
 bool is_key_pressed(keycode key) {
-    const auto scan = SDL_GetScancodeFromKey(static_cast<SDL_Keycode>(key), nullptr);
-    return is_key_pressed(static_cast<scancode>(scan));
+    return is_key_pressed(keycode_to_scancode(key));
 }
 
 key_modifier get_key_modifiers() {
@@ -45,7 +126,11 @@ keycode scancode_to_keycode(scancode scan) {
 }
 
 scancode keycode_to_scancode(keycode key) {
-    return static_cast<scancode>(SDL_GetScancodeFromKey(static_cast<SDL_Keycode>(key), nullptr));
+    return static_cast<scancode>(cached_keycodes().lookup(static_cast<SDL_Keycode>(key)));
+}
+
+void invalidate_keycode_cache() noexcept {
+    keymap_generation.fetch_add(1, std::memory_order_release);
 }
 
 std::string_view get_scancode_name(scancode scan) {
@@ -0,0 +1,96 @@
+/// @file keyboard_snapshot.cpp
+/// @date 2026-10-17
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#include <laya/input/keyboard_snapshot.hpp>
+
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+namespace {
+
+/// Pack 8 bytes holding 0/1 into the low 8 bits, byte i becoming bit i
+/// @note Each byte is masked to its low bit; the multiply gathers them into the top byte
+constexpr std::uint64_t pack_bytes(std::uint64_t bytes) noexcept {
+    return ((bytes & 0x0101010101010101ull) * 0x0102040810204080ull) >> 56;
+}
+
+static_assert(pack_bytes(0x0000000000000001ull) == 0x01);
+static_assert(pack_bytes(0x0100000000000000ull) == 0x80);
+static_assert(pack_bytes(0x0101010101010101ull) == 0xFF);
+
+/// Pack a byte-per-key state array into a bitset
+void pack_state(const std::uint8_t* state, std::size_t count, scancode_set::words& out) noexcept {
+    out.fill(0);
+    count = std::min(count, scancode_set::bit_count);
+
+    std::size_t key = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        // 8 keys per load
+        for (; key + 8 <= count; key += 8) {
+            std::uint64_t bytes;
+            std::memcpy(&bytes, state + key, sizeof(bytes));
+            out[key / 64] |= pack_bytes(bytes) << (key % 64);
+        }
+    }
+    for (; key < count; ++key) {
+        if (state[key] != 0) {
+            out[key / 64] |= std::uint64_t{1} << (key % 64);
+        }
+    }
+}
+
+}  // anonymous namespace
+
+void keyboard_snapshot::update() {
+    int num_keys = 0;
+    const bool* state = SDL_GetKeyboardState(&num_keys);
+    update(reinterpret_cast<const std::uint8_t*>(state), num_keys);
+}
+
+void keyboard_snapshot::update(const std::uint8_t* state, int num_keys) noexcept {
+    m_previous = m_current;
+    if (state == nullptr || num_keys <= 0) {
+        m_current.fill(0);
+    } else {
+        pack_state(state, static_cast<std::size_t>(num_keys), m_current);
+    }
+    diff();
+}
+
+void keyboard_snapshot::diff() noexcept {
+    // Whole-word XOR over 8 words, trivially vectorized by the compiler
+    for (std::size_t i = 0; i < scancode_set::word_count; ++i) {
+        m_changed[i] = m_current[i] ^ m_previous[i];
+    }
+}
+
+bool keyboard_snapshot::any_held() const noexcept {
+    std::uint64_t any = 0;
+    for (const auto word : m_current) {
+        any |= word;
+    }
+    return any != 0;
+}
+
+scancode_set keyboard_snapshot::pressed_keys() const noexcept {
+    scancode_set::words bits;
+    for (std::size_t i = 0; i < scancode_set::word_count; ++i) {
+        bits[i] = m_changed[i] & m_current[i];
+    }
+    return scancode_set{bits};
+}
+
+scancode_set keyboard_snapshot::released_keys() const noexcept {
+    scancode_set::words bits;
+    for (std::size_t i = 0; i < scancode_set::word_count; ++i) {
+        bits[i] = m_changed[i] & ~m_current[i];
+    }
+    return scancode_set{bits};
+}
+
+}  // namespace laya
@@ -0,0 +1,166 @@
+/// @file main_thread.cpp
+/// @date 2026-10-17
+
+#include <exception>
+#include <utility>
+
+#include <laya/errors.hpp>
+#include <laya/logging/log.hpp>
+#include <laya/tasks/main_thread.hpp>
+
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+namespace {
+
+/// SDL_MainThreadCallback that runs and frees a task queued by run_on_main_thread
+void SDLCALL run_task(void* userdata) {
+    std::unique_ptr<detail::task> task{static_cast<detail::task*>(userdata)};
+    try {
+        task->run();
+    } catch (const std::exception& e) {
+        log_error("Task run on the main thread threw: {}", e.what());
+    } catch (...) {
+        log_error("Task run on the main thread threw an unknown exception");
+    }
+}
+
+}  // namespace
+
+bool is_main_thread() noexcept {
+    return SDL_IsMainThread();
+}
+
+void detail::run_on_main_thread(std::unique_ptr<task> work, bool wait) {
+    // SDL owns the task once it is queued and frees it through run_task
+    task* raw = work.release();
+    if (!SDL_RunOnMainThread(run_task, raw, wait)) {
+        delete raw;
+        throw error::from_sdl();
+    }
+}
+
+// ============================================================================
+// main_thread_batch implementation
+// ============================================================================
+
+main_thread_batch::~main_thread_batch() noexcept {
+    while (m_newest) {
+        std::unique_ptr<detail::task> task{m_newest};
+        m_newest = task->next;
+    }
+}
+
+main_thread_batch::main_thread_batch(main_thread_batch&& other) noexcept
+    : m_newest{std::exchange(other.m_newest, nullptr)},
+      m_oldest{std::exchange(other.m_oldest, nullptr)},
+      m_size{std::exchange(other.m_size, 0)} {
+}
+
+main_thread_batch& main_thread_batch::operator=(main_thread_batch&& other) noexcept {
+    if (this != &other) {
+        main_thread_batch discarded{std::move(*this)};
+        m_newest = std::exchange(other.m_newest, nullptr);
+        m_oldest = std::exchange(other.m_oldest, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+
+void main_thread_batch::add_task(std::unique_ptr<detail::task> task) noexcept {
+    detail::task* node = task.release();
+    node->next = m_newest;
+    m_newest = node;
+    if (!m_oldest) {
+        m_oldest = node;
+    }
+    ++m_size;
+}
+
+// ============================================================================
+// main_thread_queue implementation
+// ============================================================================
+
+main_thread_queue::~main_thread_queue() noexcept {
+    collect();
+    while (m_ready) {
+        std::unique_ptr<detail::task> task{m_ready};
+        m_ready = task->next;
+    }
+}
+
+void main_thread_queue::push_task(std::unique_ptr<detail::task> task) noexcept {
+    detail::task* node = task.release();
+    push_list(node, node, 1);
+}
+
+void main_thread_queue::push(main_thread_batch&& batch) noexcept {
+    if (batch.empty()) {
+        return;
+    }
+    push_list(std::exchange(batch.m_newest, nullptr), std::exchange(batch.m_oldest, nullptr),
+              std::exchange(batch.m_size, 0));
+}
+
+void main_thread_queue::push_list(detail::task* newest, detail::task* oldest,
+                                  std::size_t count) noexcept {
+    // Count before publishing, otherwise a drain could run the tasks first and wrap size() below zero
+    m_size.fetch_add(count, std::memory_order_relaxed);
+    oldest->next = m_incoming.load(std::memory_order_relaxed);
+    while (!m_incoming.compare_exchange_weak(oldest->next, newest, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+    }
+}
+
+void main_thread_queue::collect() noexcept {
+    detail::task* newest = m_incoming.exchange(nullptr, std::memory_order_acquire);
+    if (!newest) {
+        return;
+    }
+
+    // The incoming list is newest first, reverse it so tasks run in push order
+    detail::task* oldest = nullptr;
+    detail::task* tail = newest;
+    while (newest) {
+        detail::task* next = newest->next;
+        newest->next = oldest;
+        oldest = newest;
+        newest = next;
+    }
+
+    if (m_ready_tail) {
+        m_ready_tail->next = oldest;
+    } else {
+        m_ready = oldest;
+    }
+    m_ready_tail = tail;
+}
+
+std::size_t main_thread_queue::drain(std::chrono::nanoseconds budget) {
+    collect();
+
+    // Reading the clock costs about as much as handing over a small task, skip it when unbounded
+    const bool bounded = budget != std::chrono::nanoseconds::max();
+    const auto start = bounded ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+    std::size_t ran = 0;
+    while (m_ready) {
+        if (bounded && ran > 0 && std::chrono::steady_clock::now() - start >= budget) {
+            break;
+        }
+
+        // Unlink first so a throwing task is not run again
+        std::unique_ptr<detail::task> task{m_ready};
+        m_ready = task->next;
+        if (!m_ready) {
+            m_ready_tail = nullptr;
+        }
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+
+        task->run();
+        ++ran;
+    }
+    return ran;
+}
+
+}  // namespace laya
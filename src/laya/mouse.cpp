@@ -26,28 +26,44 @@ namespace {
     return SDL_GetKeyboardFocus();
 }
 
+[[nodiscard]] point truncate(point_f p) noexcept {
+    return {static_cast<int>(p.x), static_cast<int>(p.y)};
+}
+
 }  // namespace
 
 point get_mouse_position() {
+    return truncate(get_mouse_position_f());
+}
+
+point get_global_mouse_position() {
+    return truncate(get_global_mouse_position_f());
+}
+
+point get_mouse_position(const window& win) {
+    return truncate(get_mouse_position_f(win));
+}
+
+point_f get_mouse_position_f() {
     float x, y;
     SDL_GetMouseState(&x, &y);
-    return {static_cast<int>(x), static_cast<int>(y)};
+    return {x, y};
 }
 
-point get_global_mouse_position() {
+point_f get_global_mouse_position_f() {
     float x, y;
     SDL_GetGlobalMouseState(&x, &y);
-    return {static_cast<int>(x), static_cast<int>(y)};
+    return {x, y};
 }
 
-point get_mouse_position(const window& win) {
+point_f get_mouse_position_f(const window& win) {
     SDL_Window* target = ensure_window_handle(win);
 
     // If this is the focused window, SDL already provides window-relative coordinates.
     if (SDL_GetMouseFocus() == target) {
         float x, y;
         SDL_GetMouseState(&x, &y);
-        return {static_cast<int>(x), static_cast<int>(y)};
+        return {x, y};
     }
 
     // Otherwise, compute window-relative coordinates from desktop position.
@@ -59,7 +75,7 @@ point get_mouse_position(const window& win) {
         throw error::from_sdl();
     }
 
-    return {static_cast<int>(gx) - wx, static_cast<int>(gy) - wy};
+    return {gx - static_cast<float>(wx), gy - static_cast<float>(wy)};
 }
 
 mouse_button_mask get_mouse_state() {
@@ -69,9 +85,14 @@ mouse_button_mask get_mouse_state() {
 
 mouse_button_mask get_mouse_state(int& x, int& y) {
     float fx, fy;
-    const auto state = SDL_GetMouseState(&fx, &fy);
+    const auto state = get_mouse_state(fx, fy);
     x = static_cast<int>(fx);
     y = static_cast<int>(fy);
+    return state;
+}
+
+mouse_button_mask get_mouse_state(float& x, float& y) {
+    const auto state = SDL_GetMouseState(&x, &y);
     return static_cast<mouse_button_mask>(state);
 }
 
@@ -85,14 +106,23 @@ bool is_mouse_button_pressed(mouse_button button) {
 
 mouse_button_mask get_relative_mouse_state(int& x, int& y) {
     float fx, fy;
-    const auto state = SDL_GetRelativeMouseState(&fx, &fy);
+    const auto state = get_relative_mouse_state(fx, fy);
     x = static_cast<int>(fx);
     y = static_cast<int>(fy);
+    return state;
+}
+
+mouse_button_mask get_relative_mouse_state(float& x, float& y) {
+    const auto state = SDL_GetRelativeMouseState(&x, &y);
     return static_cast<mouse_button_mask>(state);
 }
 
 void warp_mouse_in_window(window& win, point pos) {
-    SDL_WarpMouseInWindow(win.native_handle(), static_cast<float>(pos.x), static_cast<float>(pos.y));
+    warp_mouse_in_window(win, point_f{static_cast<float>(pos.x), static_cast<float>(pos.y)});
+}
+
+void warp_mouse_in_window(window& win, point_f pos) {
+    SDL_WarpMouseInWindow(win.native_handle(), pos.x, pos.y);
 }
 
 void warp_mouse_global(point pos) {
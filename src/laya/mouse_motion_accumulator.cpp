@@ -0,0 +1,33 @@
+/// @file mouse_motion_accumulator.cpp
+/// @date 2026-10-17
+
+#include <cmath>
+
+#include <laya/input/mouse_motion_accumulator.hpp>
+
+namespace laya {
+
+bool mouse_motion_accumulator::add(const event& ev) noexcept {
+    if (const auto* motion = std::get_if<mouse_motion_event>(&ev)) {
+        add(*motion);
+        return true;
+    }
+    return false;
+}
+
+point_f mouse_motion_accumulator::take() noexcept {
+    const point_f total = delta();
+    reset();
+    return total;
+}
+
+point mouse_motion_accumulator::take_pixels() noexcept {
+    const double whole_x = std::trunc(m_x);
+    const double whole_y = std::trunc(m_y);
+    m_x -= whole_x;
+    m_y -= whole_y;
+    m_samples = 0;
+    return {static_cast<int>(whole_x), static_cast<int>(whole_y)};
+}
+
+}  // namespace laya
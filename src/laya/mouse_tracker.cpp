@@ -0,0 +1,92 @@
+/// @file mouse_tracker.cpp
+/// @date 2026-10-17
+
+#include <algorithm>
+
+#include <laya/input/mouse_tracker.hpp>
+#include <laya/windows/window.hpp>
+
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+void mouse_tracker::track(const window& win) {
+    track(win.id(), win.get_position(), win.get_size());
+}
+
+void mouse_tracker::track(window_id id, laya::position pos, dimensions size) {
+    if (auto* tracked = find(id)) {
+        tracked->pos = pos;
+        tracked->size = size;
+        return;
+    }
+    m_windows.push_back(tracked_window{id, pos, size, point_f{}, false});
+}
+
+bool mouse_tracker::untrack(window_id id) noexcept {
+    return std::erase_if(m_windows, [id](const tracked_window& tracked) { return tracked.id == id; }) != 0;
+}
+
+void mouse_tracker::handle(const event& ev) noexcept {
+    const auto* win_ev = std::get_if<window_event>(&ev);
+    if (!win_ev) {
+        return;
+    }
+
+    auto* tracked = find(win_ev->id);
+    if (!tracked) {
+        return;
+    }
+
+    // size_changed reports pixels, only `resized` is in the screen coordinates the mouse uses
+    if (const auto* pos = std::get_if<window_event_data_position>(&win_ev->data);
+        pos && win_ev->event_type == window_event_type::moved) {
+        tracked->pos = laya::position{pos->x, pos->y};
+    } else if (const auto* size = std::get_if<window_event_data_size>(&win_ev->data);
+               size && win_ev->event_type == window_event_type::resized) {
+        tracked->size = dimensions{size->width, size->height};
+    }
+}
+
+void mouse_tracker::update() {
+    float x, y;
+    SDL_GetGlobalMouseState(&x, &y);
+    update(point_f{x, y});
+}
+
+void mouse_tracker::update(point_f global) noexcept {
+    m_global = global;
+    for (auto& tracked : m_windows) {
+        tracked.relative = point_f{global.x - static_cast<float>(tracked.pos.x),
+                                   global.y - static_cast<float>(tracked.pos.y)};
+        tracked.inside = tracked.relative.x >= 0.0f && tracked.relative.y >= 0.0f &&
+                         tracked.relative.x < static_cast<float>(tracked.size.width) &&
+                         tracked.relative.y < static_cast<float>(tracked.size.height);
+    }
+}
+
+std::optional<point_f> mouse_tracker::position(window_id id) const noexcept {
+    if (const auto* tracked = find(id)) {
+        return tracked->relative;
+    }
+    return std::nullopt;
+}
+
+bool mouse_tracker::is_inside(window_id id) const noexcept {
+    const auto* tracked = find(id);
+    return tracked && tracked->inside;
+}
+
+mouse_tracker::tracked_window* mouse_tracker::find(window_id id) noexcept {
+    const auto it = std::find_if(m_windows.begin(), m_windows.end(),
+                                 [id](const tracked_window& tracked) { return tracked.id == id; });
+    return it != m_windows.end() ? &*it : nullptr;
+}
+
+const mouse_tracker::tracked_window* mouse_tracker::find(window_id id) const noexcept {
+    const auto it = std::find_if(m_windows.begin(), m_windows.end(),
+                                 [id](const tracked_window& tracked) { return tracked.id == id; });
+    return it != m_windows.end() ? &*it : nullptr;
+}
+
+}  // namespace laya
@@ -2,8 +2,11 @@
 /// @brief Implementation of type-safe SDL3 renderer wrapper
 /// @date 2025-10-07
 
-#include <utility>
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <string>
+#include <utility>
 
 #include <laya/laya.hpp>
 #include <laya/textures/texture.hpp>
@@ -68,58 +71,136 @@ SDL_Point to_sdl_point(const point& p) {
     return {p.x, p.y};
 }
 
-}  // anonymous namespace
+/// Convert laya rect to SDL_FRect
+SDL_FRect to_sdl_frect(const rect& r) {
+    return {static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.w), static_cast<float>(r.h)};
+}
 
-// ============================================================================
-// Renderer implementation
-// ============================================================================
+/// Value passed to SDL for the vsync mode and interval in args
+int vsync_value(const renderer_args& args) {
+    if (args.vsync == vsync_mode::enabled) {
+        return std::max(args.vsync_interval, 1);
+    }
+    return static_cast<int>(args.vsync);
+}
 
-renderer::renderer(window& win, const renderer_args& args) : m_renderer{nullptr}, m_id{} {
-    const char* driver_name = nullptr;
-    if ((args.flags & renderer_flags::software) == renderer_flags::software) {
+/// Sets an SDL hint and restores the previous value when destroyed
+class scoped_hint {
+public:
+    scoped_hint(const char* name, const char* value) : m_name{name} {
+        if (const char* previous = SDL_GetHint(name)) {
+            m_previous = previous;
+            m_had_previous = true;
+        }
+        SDL_SetHint(name, value);
+    }
+
+    ~scoped_hint() noexcept {
+        if (m_had_previous) {
+            SDL_SetHint(m_name, m_previous.c_str());
+        } else {
+            SDL_ResetHint(m_name);
+        }
+    }
+
+    scoped_hint(const scoped_hint&) = delete;
+    scoped_hint& operator=(const scoped_hint&) = delete;
+
+private:
+    const char* m_name;
+    std::string m_previous;
+    bool m_had_previous = false;
+};
+
+/// Create the SDL renderer described by args and apply its vsync mode
+result<SDL_Renderer*> create_sdl_renderer(window& win, const renderer_args& args) {
+    // A named driver takes precedence over renderer_flags::software
+    std::string driver_name{args.driver};
+    if (driver_name.empty() && (args.flags & renderer_flags::software) == renderer_flags::software) {
         driver_name = "software";
     }
 
     SDL_PropertiesID props = SDL_CreateProperties();
     if (props == 0) {
-        throw error::from_sdl();
+        return error_info::from_sdl("Failed to create renderer properties");
     }
 
-    if (!SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_WINDOW_POINTER, win.native_handle())) {
-        SDL_DestroyProperties(props);
-        throw error::from_sdl();
-    }
-    if (driver_name && !SDL_SetStringProperty(props, SDL_PROP_RENDERER_CREATE_NAME_STRING, driver_name)) {
+    const bool request_vsync_flag = (args.flags & renderer_flags::present_vsync) == renderer_flags::present_vsync;
+    const int vsync = vsync_value(args);
+    const auto requested_vsync_value = static_cast<Sint64>(request_vsync_flag ? std::max(vsync, 1) : vsync);
+
+    if (!SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_WINDOW_POINTER, win.native_handle()) ||
+        (!driver_name.empty() &&
+         !SDL_SetStringProperty(props, SDL_PROP_RENDERER_CREATE_NAME_STRING, driver_name.c_str())) ||
+        !SDL_SetNumberProperty(props, SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER, requested_vsync_value)) {
+        auto err = error_info::from_sdl("Failed to set renderer properties");
         SDL_DestroyProperties(props);
-        throw error::from_sdl();
+        return err;
     }
 
-    const bool request_vsync_flag = (args.flags & renderer_flags::present_vsync) == renderer_flags::present_vsync;
-    const auto requested_vsync_value =
-        static_cast<Sint64>(request_vsync_flag ? static_cast<int>(vsync_mode::enabled) : static_cast<int>(args.vsync));
-    if (!SDL_SetNumberProperty(props, SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER, requested_vsync_value)) {
-        SDL_DestroyProperties(props);
-        throw error::from_sdl();
+    // The line method is a hint SDL reads once while creating the renderer
+    std::optional<scoped_hint> line_hint;
+    if (args.lines != line_method::automatic) {
+        const char* const methods[] = {"0", "1", "2", "3"};
+        line_hint.emplace(SDL_HINT_RENDER_LINE_METHOD, methods[static_cast<int>(args.lines)]);
     }
 
-    m_renderer = SDL_CreateRendererWithProperties(props);
+    SDL_Renderer* handle = SDL_CreateRendererWithProperties(props);
     SDL_DestroyProperties(props);
-    if (!m_renderer) {
-        throw error("Failed to create renderer: {}", SDL_GetError());
+    if (!handle) {
+        return error_info::from_sdl("Failed to create renderer");
     }
 
     // Set VSync mode (non-fatal if unsupported)
-    if (SDL_SetRenderVSync(m_renderer, static_cast<int>(args.vsync)) == false) {
+    if (SDL_SetRenderVSync(handle, vsync) == false) {
         std::fprintf(stderr, "Warning: Failed to set VSync: %s\n", SDL_GetError());
     }
 
-    // Cache the renderer ID using pointer value as unique identifier
-    m_id = renderer_id{static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(m_renderer) & 0xFFFFFFFF)};
+    return handle;
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// Driver enumeration
+// ============================================================================
+
+std::vector<std::string> available_render_drivers() {
+    const int count = SDL_GetNumRenderDrivers();
+    std::vector<std::string> drivers;
+    drivers.reserve(static_cast<std::size_t>(std::max(count, 0)));
+    for (int i = 0; i < count; ++i) {
+        if (const char* name = SDL_GetRenderDriver(i)) {
+            drivers.emplace_back(name);
+        }
+    }
+    return drivers;
+}
+
+// ============================================================================
+// Renderer implementation
+// ============================================================================
+
+renderer::renderer(window& win, const renderer_args& args) : renderer(create_sdl_renderer(win, args).value()) {
 }
 
 renderer::renderer(window& win, renderer_flags flags) : renderer(win, renderer_args{flags}) {
 }
 
+renderer::renderer(SDL_Renderer* handle) noexcept
+    : m_renderer{handle},
+      // Cache the renderer ID using pointer value as unique identifier
+      m_id{static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(handle) & 0xFFFFFFFF)} {
+}
+
+result<renderer> renderer::try_create(window& win, const renderer_args& args) {
+    auto handle = create_sdl_renderer(win, args);
+    if (!handle) {
+        return handle.error();
+    }
+    return renderer{*handle};
+}
+
 renderer::~renderer() noexcept {
     if (m_renderer) {
         SDL_DestroyRenderer(m_renderer);
@@ -146,15 +227,15 @@ renderer& renderer::operator=(renderer&& other) noexcept {
 // ============================================================================
 
 void renderer::clear() {
-    if (SDL_RenderClear(m_renderer) == false) {
-        throw error("Failed to clear renderer: {}", SDL_GetError());
-    }
+    try_clear().value();
 }
 
 void renderer::present() {
-    if (SDL_RenderPresent(m_renderer) == false) {
-        throw error("Failed to present renderer: {}", SDL_GetError());
-    }
+    try_present().value();
+}
+
+void renderer::flush() {
+    try_flush().value();
 }
 
 // ============================================================================
@@ -162,28 +243,19 @@ void renderer::present() {
 // ============================================================================
 
 void renderer::set_draw_color(color c) {
-    if (SDL_SetRenderDrawColor(m_renderer, c.r, c.g, c.b, c.a) == false) {
-        throw error("Failed to set draw color: {}", SDL_GetError());
-    }
+    try_set_draw_color(c).value();
 }
 
 void renderer::set_draw_color(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a) {
-    if (SDL_SetRenderDrawColor(m_renderer, r, g, b, a) == false) {
-        throw error("Failed to set draw color: {}", SDL_GetError());
-    }
+    try_set_draw_color(color{r, g, b, a}).value();
 }
 
 void renderer::set_blend_mode(blend_mode mode) {
-    if (SDL_SetRenderDrawBlendMode(m_renderer, to_sdl_blend_mode(mode)) == false) {
-        throw error("Failed to set blend mode: {}", SDL_GetError());
-    }
+    try_set_blend_mode(mode).value();
 }
 
 void renderer::set_viewport(const rect& viewport) {
-    SDL_Rect sdl_rect = to_sdl_rect(viewport);
-    if (SDL_SetRenderViewport(m_renderer, &sdl_rect) == false) {
-        throw error("Failed to set viewport: {}", SDL_GetError());
-    }
+    try_set_viewport(viewport).value();
 }
 
 void renderer::reset_viewport() {
@@ -216,6 +288,14 @@ rect renderer::get_viewport() const {
     return from_sdl_rect(viewport);
 }
 
+std::string_view renderer::driver_name() const {
+    const char* name = SDL_GetRendererName(m_renderer);
+    if (!name) {
+        throw error("Failed to get renderer name: {}", SDL_GetError());
+    }
+    return name;
+}
+
 dimensions renderer::get_output_size() const {
     int w, h;
     if (SDL_GetRenderOutputSize(m_renderer, &w, &h) == false) {
@@ -245,9 +325,7 @@ viewport_guard renderer::with_viewport(const rect& viewport) {
 // ============================================================================
 
 void renderer::draw_point(point p) {
-    if (SDL_RenderPoint(m_renderer, static_cast<float>(p.x), static_cast<float>(p.y)) == false) {
-        throw error("Failed to draw point: {}", SDL_GetError());
-    }
+    try_draw_point(p).value();
 }
 
 void renderer::draw_points(const point* points, int count) {
@@ -267,10 +345,7 @@ void renderer::draw_points(const point* points, int count) {
 }
 
 void renderer::draw_line(point from, point to) {
-    if (SDL_RenderLine(m_renderer, static_cast<float>(from.x), static_cast<float>(from.y), static_cast<float>(to.x),
-                       static_cast<float>(to.y)) == false) {
-        throw error("Failed to draw line: {}", SDL_GetError());
-    }
+    try_draw_line(from, to).value();
 }
 
 void renderer::draw_lines(const point* points, int count) {
@@ -290,11 +365,7 @@ void renderer::draw_lines(const point* points, int count) {
 }
 
 void renderer::draw_rect(const rect& r) {
-    SDL_FRect sdl_rect{static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.w),
-                       static_cast<float>(r.h)};
-    if (SDL_RenderRect(m_renderer, &sdl_rect) == false) {
-        throw error("Failed to draw rect: {}", SDL_GetError());
-    }
+    try_draw_rect(r).value();
 }
 
 void renderer::draw_rects(const rect* rects, int count) {
@@ -315,28 +386,11 @@ void renderer::draw_rects(const rect* rects, int count) {
 }
 
 void renderer::fill_rect(const rect& r) {
-    SDL_FRect sdl_rect{static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.w),
-                       static_cast<float>(r.h)};
-    if (SDL_RenderFillRect(m_renderer, &sdl_rect) == false) {
-        throw error("Failed to fill rect: {}", SDL_GetError());
-    }
+    try_fill_rect(r).value();
 }
 
 void renderer::fill_rects(const rect* rects, int count) {
-    if (count <= 0 || !rects) {
-        return;
-    }
-
-    // Convert to SDL rects
-    auto sdl_rects = std::make_unique<SDL_FRect[]>(count);
-    for (int i = 0; i < count; ++i) {
-        sdl_rects[i] = {static_cast<float>(rects[i].x), static_cast<float>(rects[i].y), static_cast<float>(rects[i].w),
-                        static_cast<float>(rects[i].h)};
-    }
-
-    if (SDL_RenderFillRects(m_renderer, sdl_rects.get(), count) == false) {
-        throw error("Failed to fill rects: {}", SDL_GetError());
-    }
+    try_fill_rects(rects, count).value();
 }
 
 // ============================================================================
@@ -344,33 +398,15 @@ void renderer::fill_rects(const rect* rects, int count) {
 // ============================================================================
 
 void renderer::render(const texture& tex, point dst_pos) {
-    auto tex_size = tex.size();
-    SDL_FRect dst_rect{static_cast<float>(dst_pos.x), static_cast<float>(dst_pos.y), static_cast<float>(tex_size.width),
-                       static_cast<float>(tex_size.height)};
-
-    if (!SDL_RenderTexture(m_renderer, tex.native_handle(), nullptr, &dst_rect)) {
-        throw error("Failed to render texture: {}", SDL_GetError());
-    }
+    try_render(tex, dst_pos).value();
 }
 
 void renderer::render(const texture& tex, const rect& dst_rect) {
-    SDL_FRect sdl_dst{static_cast<float>(dst_rect.x), static_cast<float>(dst_rect.y), static_cast<float>(dst_rect.w),
-                      static_cast<float>(dst_rect.h)};
-
-    if (!SDL_RenderTexture(m_renderer, tex.native_handle(), nullptr, &sdl_dst)) {
-        throw error("Failed to render texture: {}", SDL_GetError());
-    }
+    try_render(tex, dst_rect).value();
 }
 
 void renderer::render(const texture& tex, const rect& src_rect, const rect& dst_rect) {
-    SDL_FRect sdl_src{static_cast<float>(src_rect.x), static_cast<float>(src_rect.y), static_cast<float>(src_rect.w),
-                      static_cast<float>(src_rect.h)};
-    SDL_FRect sdl_dst{static_cast<float>(dst_rect.x), static_cast<float>(dst_rect.y), static_cast<float>(dst_rect.w),
-                      static_cast<float>(dst_rect.h)};
-
-    if (!SDL_RenderTexture(m_renderer, tex.native_handle(), &sdl_src, &sdl_dst)) {
-        throw error("Failed to render texture: {}", SDL_GetError());
-    }
+    try_render(tex, src_rect, dst_rect).value();
 }
 
 void renderer::render(const texture& tex, const rect& dst_rect, double angle) {
@@ -429,6 +465,127 @@ void renderer::render(const texture& tex, const rect& src_rect, const rect& dst_
     }
 }
 
+// ============================================================================
+// Non-throwing operations
+// ============================================================================
+
+result<void> renderer::try_clear() {
+    if (!SDL_RenderClear(m_renderer)) {
+        return error_info::from_sdl("Failed to clear renderer");
+    }
+    return {};
+}
+
+result<void> renderer::try_present() {
+    if (!SDL_RenderPresent(m_renderer)) {
+        return error_info::from_sdl("Failed to present renderer");
+    }
+    return {};
+}
+
+result<void> renderer::try_flush() {
+    if (!SDL_FlushRenderer(m_renderer)) {
+        return error_info::from_sdl("Failed to flush renderer");
+    }
+    return {};
+}
+
+result<void> renderer::try_set_draw_color(color c) {
+    if (!SDL_SetRenderDrawColor(m_renderer, c.r, c.g, c.b, c.a)) {
+        return error_info::from_sdl("Failed to set draw color");
+    }
+    return {};
+}
+
+result<void> renderer::try_set_blend_mode(blend_mode mode) {
+    if (!SDL_SetRenderDrawBlendMode(m_renderer, to_sdl_blend_mode(mode))) {
+        return error_info::from_sdl("Failed to set blend mode");
+    }
+    return {};
+}
+
+result<void> renderer::try_set_viewport(const rect& viewport) {
+    const SDL_Rect sdl_rect = to_sdl_rect(viewport);
+    if (!SDL_SetRenderViewport(m_renderer, &sdl_rect)) {
+        return error_info::from_sdl("Failed to set viewport");
+    }
+    return {};
+}
+
+result<void> renderer::try_draw_point(point p) {
+    if (!SDL_RenderPoint(m_renderer, static_cast<float>(p.x), static_cast<float>(p.y))) {
+        return error_info::from_sdl("Failed to draw point");
+    }
+    return {};
+}
+
+result<void> renderer::try_draw_line(point from, point to) {
+    if (!SDL_RenderLine(m_renderer, static_cast<float>(from.x), static_cast<float>(from.y), static_cast<float>(to.x),
+                        static_cast<float>(to.y))) {
+        return error_info::from_sdl("Failed to draw line");
+    }
+    return {};
+}
+
+result<void> renderer::try_draw_rect(const rect& r) {
+    const SDL_FRect sdl_rect = to_sdl_frect(r);
+    if (!SDL_RenderRect(m_renderer, &sdl_rect)) {
+        return error_info::from_sdl("Failed to draw rect");
+    }
+    return {};
+}
+
+result<void> renderer::try_fill_rect(const rect& r) {
+    const SDL_FRect sdl_rect = to_sdl_frect(r);
+    if (!SDL_RenderFillRect(m_renderer, &sdl_rect)) {
+        return error_info::from_sdl("Failed to fill rect");
+    }
+    return {};
+}
+
+result<void> renderer::try_fill_rects(const rect* rects, int count) {
+    if (count <= 0 || !rects) {
+        return {};
+    }
+
+    // laya::rect holds ints and SDL wants floats, so convert through a stack buffer a chunk at a
+    // time instead of allocating. Chunks are submitted in order, so the result matches one call.
+    constexpr int chunk_size = 128;
+    SDL_FRect sdl_rects[chunk_size];
+    for (int first = 0; first < count; first += chunk_size) {
+        const int n = std::min(chunk_size, count - first);
+        for (int i = 0; i < n; ++i) {
+            sdl_rects[i] = to_sdl_frect(rects[first + i]);
+        }
+        if (!SDL_RenderFillRects(m_renderer, sdl_rects, n)) {
+            return error_info::from_sdl("Failed to fill rects");
+        }
+    }
+    return {};
+}
+
+result<void> renderer::try_render(const texture& tex, point dst_pos) {
+    const auto tex_size = tex.size();
+    return try_render(tex, rect{dst_pos.x, dst_pos.y, tex_size.width, tex_size.height});
+}
+
+result<void> renderer::try_render(const texture& tex, const rect& dst_rect) {
+    const SDL_FRect sdl_dst = to_sdl_frect(dst_rect);
+    if (!SDL_RenderTexture(m_renderer, tex.native_handle(), nullptr, &sdl_dst)) {
+        return error_info::from_sdl("Failed to render texture");
+    }
+    return {};
+}
+
+result<void> renderer::try_render(const texture& tex, const rect& src_rect, const rect& dst_rect) {
+    const SDL_FRect sdl_src = to_sdl_frect(src_rect);
+    const SDL_FRect sdl_dst = to_sdl_frect(dst_rect);
+    if (!SDL_RenderTexture(m_renderer, tex.native_handle(), &sdl_src, &sdl_dst)) {
+        return error_info::from_sdl("Failed to render texture");
+    }
+    return {};
+}
+
 // ============================================================================
 // RAII state guard implementations
 // ============================================================================
@@ -438,11 +595,8 @@ draw_color_guard::draw_color_guard(renderer& r, color new_color) : m_renderer{r}
 }
 
 draw_color_guard::~draw_color_guard() noexcept {
-    try {
-        m_renderer.set_draw_color(m_old_color);
-    } catch (...) {
-        // Ignore exceptions in destructor
-    }
+    // Failures are ignored in destructor
+    (void)m_renderer.try_set_draw_color(m_old_color);
 }
 
 blend_mode_guard::blend_mode_guard(renderer& r, blend_mode new_mode) : m_renderer{r}, m_old_mode{r.get_blend_mode()} {
@@ -450,11 +604,8 @@ blend_mode_guard::blend_mode_guard(renderer& r, blend_mode new_mode) : m_rendere
 }
 
 blend_mode_guard::~blend_mode_guard() noexcept {
-    try {
-        m_renderer.set_blend_mode(m_old_mode);
-    } catch (...) {
-        // Ignore exceptions in destructor
-    }
+    // Failures are ignored in destructor
+    (void)m_renderer.try_set_blend_mode(m_old_mode);
 }
 
 viewport_guard::viewport_guard(renderer& r, const rect& new_viewport)
@@ -463,11 +614,8 @@ viewport_guard::viewport_guard(renderer& r, const rect& new_viewport)
 }
 
 viewport_guard::~viewport_guard() noexcept {
-    try {
-        m_renderer.set_viewport(m_old_viewport);
-    } catch (...) {
-        // Ignore exceptions in destructor
-    }
+    // Failures are ignored in destructor
+    (void)m_renderer.try_set_viewport(m_old_viewport);
 }
 
 }  // namespace laya
@@ -0,0 +1,96 @@
+#include <array>
+
+#include <laya/events/sample_accumulator.hpp>
+#include <laya/subsystems.hpp>
+#include <SDL3/SDL.h>
+
+namespace laya {
+
+namespace {
+
+/// Number of SDL events fetched per SDL_PeepEvents call
+constexpr int peep_chunk_size = 128;
+
+/// SDL event types drained by the accumulator, each peeped as its own range
+constexpr std::array<Uint32, 4> sample_event_types{
+    SDL_EVENT_SENSOR_UPDATE,
+    SDL_EVENT_GAMEPAD_SENSOR_UPDATE,
+    SDL_EVENT_PEN_MOTION,
+    SDL_EVENT_PEN_AXIS,
+};
+
+}  // anonymous namespace
+
+// ============================================================================
+// sample_accumulator implementation
+// ============================================================================
+
+sample_accumulator::sample_accumulator(std::size_t capacity_per_device) : m_capacity{capacity_per_device} {
+}
+
+std::size_t sample_accumulator::collect() {
+    clear();
+    use_subsystem(subsystem::events);
+    SDL_PumpEvents();
+
+    std::array<SDL_Event, peep_chunk_size> buffer;
+    std::size_t total = 0;
+    for (const auto type : sample_event_types) {
+        while (true) {
+            const int count = SDL_PeepEvents(buffer.data(), peep_chunk_size, SDL_GETEVENT, type, type);
+            for (int i = 0; i < count; ++i) {
+                add(from_sdl_event(buffer[static_cast<std::size_t>(i)]));
+            }
+            if (count > 0) {
+                total += static_cast<std::size_t>(count);
+            }
+            if (count < peep_chunk_size) {
+                break;
+            }
+        }
+    }
+    return total;
+}
+
+bool sample_accumulator::add(const event& ev) {
+    if (const auto* e = std::get_if<sensor_event>(&ev)) {
+        m_sensors.find_or_add(e->which, m_capacity).push(*e);
+    } else if (const auto* e = std::get_if<gamepad_sensor_event>(&ev)) {
+        m_gamepad_sensors.find_or_add(e->which, m_capacity).push(*e);
+    } else if (const auto* e = std::get_if<pen_motion_event>(&ev)) {
+        m_pen_motion.find_or_add(e->which, m_capacity).push(*e);
+    } else if (const auto* e = std::get_if<pen_axis_event>(&ev)) {
+        m_pen_axis.find_or_add(e->which, m_capacity).push(*e);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void sample_accumulator::clear() noexcept {
+    const auto clear_rings = [](auto& rings) {
+        for (auto& ring : rings.rings) {
+            ring.clear();
+        }
+    };
+    clear_rings(m_sensors);
+    clear_rings(m_gamepad_sensors);
+    clear_rings(m_pen_motion);
+    clear_rings(m_pen_axis);
+}
+
+std::size_t sample_accumulator::dropped() const noexcept {
+    std::size_t total = 0;
+    const auto add_dropped = [&total](const auto& rings) {
+        for (const auto& ring : rings.rings) {
+            total += ring.dropped();
+        }
+    };
+    add_dropped(m_sensors);
+    add_dropped(m_gamepad_sensors);
+    add_dropped(m_pen_motion);
+    add_dropped(m_pen_axis);
+    return total;
+}
+
+}  // namespace laya
@@ -1,3 +1,9 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+
 #include <laya/subsystems.hpp>
 #include <laya/errors.hpp>
 #include <SDL3/SDL.h>
@@ -16,30 +22,216 @@ void set_headless_hints(subsystem system) {
     }
 }
 
+/// Initialization order, events first so its cost is not folded into the subsystems implying it
+constexpr subsystem ordered_subsystems[] = {subsystem::events,   subsystem::video,   subsystem::audio,
+                                            subsystem::joystick, subsystem::haptic,  subsystem::gamepad,
+                                            subsystem::sensor,   subsystem::camera};
+constexpr std::size_t subsystem_count = std::size(ordered_subsystems);
+
+struct subsystem_state {
+    std::mutex mutex;
+    std::array<int, subsystem_count> references{};         ///< create_subsystem() calls, plus one if used
+    std::array<int, subsystem_count> deferring_contexts{};  ///< Live contexts deferring the subsystem
+    unsigned used_on_first_use = 0;  ///< Subsystems holding the reference taken by try_use_subsystem()
+    std::array<subsystem_timing, subsystem_count> timings{};  ///< First initialization of each, in call order
+    std::size_t timing_count = 0;
+
+    /// Deferred subsystems with no reference, the only ones try_use_subsystem() takes the lock for
+    std::atomic<unsigned> pending{0};
+};
+
+subsystem_state& state() {
+    static subsystem_state s;
+    return s;
+}
+
+bool contains(subsystem set, std::size_t index) noexcept {
+    return (set & ordered_subsystems[index]) == ordered_subsystems[index];
+}
+
+void refresh_pending(subsystem_state& s, std::size_t index) noexcept {
+    const unsigned bit = underlying_type(ordered_subsystems[index]);
+    if (s.deferring_contexts[index] > 0 && s.references[index] == 0) {
+        s.pending.fetch_or(bit, std::memory_order_release);
+    } else {
+        s.pending.fetch_and(~bit, std::memory_order_release);
+    }
+}
+
+/// Keep the first initialization of each subsystem and count the later ones
+void record_timing(subsystem_state& s, subsystem system, std::chrono::nanoseconds duration,
+                   bool on_first_use) noexcept {
+    const auto recorded = s.timings.begin() + static_cast<std::ptrdiff_t>(s.timing_count);
+    const auto it = std::find_if(s.timings.begin(), recorded,
+                                 [system](const subsystem_timing& t) { return t.system == system; });
+    if (it != recorded) {
+        ++it->init_count;
+    } else {
+        s.timings[s.timing_count++] = {system, duration, on_first_use, 1};
+    }
+}
+
+/// Take a reference, initializing the subsystem if it is the first one
+result<void> acquire(subsystem_state& s, std::size_t index, bool on_first_use) {
+    if (s.references[index] == 0) {
+        const auto system = ordered_subsystems[index];
+        const auto start = std::chrono::steady_clock::now();
+        if (!SDL_InitSubSystem(underlying_type(system))) {
+            return error_info::from_sdl("Failed to initialize subsystem");
+        }
+        record_timing(s, system, std::chrono::steady_clock::now() - start, on_first_use);
+    }
+    ++s.references[index];
+    refresh_pending(s, index);
+    return {};
+}
+
+/// Drop a reference, shutting the subsystem down with the last one
+void release(subsystem_state& s, std::size_t index) noexcept {
+    if (s.references[index] > 0 && --s.references[index] == 0) {
+        SDL_QuitSubSystem(underlying_type(ordered_subsystems[index]));
+    }
+    refresh_pending(s, index);
+}
+
 }  // namespace
 
 void create_subsystem(subsystem system) {
-    if (SDL_Init(underlying_type(system)) == false) {
-        throw error::from_sdl();
+    auto& s = state();
+    std::lock_guard lock{s.mutex};
+    for (std::size_t i = 0; i < subsystem_count; ++i) {
+        if (!contains(system, i)) {
+            continue;
+        }
+        if (auto res = acquire(s, i, false); !res) {
+            // Leave nothing half initialized
+            while (i-- > 0) {
+                if (contains(system, i)) {
+                    release(s, i);
+                }
+            }
+            throw res.error().to_error();
+        }
     }
 }
 
 void destroy_subsystem(subsystem system) noexcept {
-    SDL_QuitSubSystem(underlying_type(system));
+    auto& s = state();
+    std::lock_guard lock{s.mutex};
+    for (std::size_t i = subsystem_count; i-- > 0;) {
+        if (contains(system, i)) {
+            release(s, i);
+        }
+    }
 }
 
 void destroy() noexcept {
     SDL_Quit();
+
+    auto& s = state();
+    std::lock_guard lock{s.mutex};
+    s.references.fill(0);
+    s.used_on_first_use = 0;
+    for (std::size_t i = 0; i < subsystem_count; ++i) {
+        refresh_pending(s, i);
+    }
+}
+
+// ============================================================================
+// Initialization on first use
+// ============================================================================
+
+void use_subsystem(subsystem system) {
+    try_use_subsystem(system).value();
+}
+
+result<void> try_use_subsystem(subsystem system) {
+    auto& s = state();
+    if ((s.pending.load(std::memory_order_acquire) & underlying_type(system)) == 0) {
+        return {};
+    }
+
+    std::lock_guard lock{s.mutex};
+    for (std::size_t i = 0; i < subsystem_count; ++i) {
+        if (!contains(system, i) || s.deferring_contexts[i] == 0 || s.references[i] != 0) {
+            continue;
+        }
+        if (auto res = acquire(s, i, true); !res) {
+            return res;
+        }
+        s.used_on_first_use |= underlying_type(ordered_subsystems[i]);
+    }
+    return {};
 }
 
+std::vector<subsystem_timing> subsystem_timings() {
+    auto& s = state();
+    std::lock_guard lock{s.mutex};
+    return {s.timings.begin(), s.timings.begin() + static_cast<std::ptrdiff_t>(s.timing_count)};
+}
+
+std::string_view subsystem_name(subsystem system) noexcept {
+    switch (system) {
+        case subsystem::audio:
+            return "audio";
+        case subsystem::video:
+            return "video";
+        case subsystem::joystick:
+            return "joystick";
+        case subsystem::haptic:
+            return "haptic";
+        case subsystem::gamepad:
+            return "gamepad";
+        case subsystem::events:
+            return "events";
+        case subsystem::sensor:
+            return "sensor";
+        case subsystem::camera:
+            return "camera";
+        default:
+            return "unknown";
+    }
+}
+
+// ============================================================================
+// context implementation
+// ============================================================================
+
 context::context(subsystem system) : m_system(system) {
     create_subsystem(system);
 }
 
+context::context(const context_args& args) : m_system(args.init), m_on_first_use(args.on_first_use) {
+    create_subsystem(m_system);
+
+    auto& s = state();
+    std::lock_guard lock{s.mutex};
+    for (std::size_t i = 0; i < subsystem_count; ++i) {
+        if (contains(m_on_first_use, i)) {
+            ++s.deferring_contexts[i];
+            refresh_pending(s, i);
+        }
+    }
+}
+
 context::~context() noexcept {
-    if (SDL_WasInit(underlying_type(m_system)) != 0) {
-        destroy_subsystem(m_system);
+    if (m_on_first_use != subsystem::none) {
+        auto& s = state();
+        std::lock_guard lock{s.mutex};
+        for (std::size_t i = subsystem_count; i-- > 0;) {
+            if (!contains(m_on_first_use, i)) {
+                continue;
+            }
+            const unsigned bit = underlying_type(ordered_subsystems[i]);
+            // The last context deferring a subsystem drops the reference its first use took
+            if (--s.deferring_contexts[i] == 0 && (s.used_on_first_use & bit) != 0) {
+                s.used_on_first_use &= ~bit;
+                release(s, i);
+            }
+            refresh_pending(s, i);
+        }
     }
+    destroy_subsystem(m_system);
 }
 
 }  // namespace laya
@@ -59,23 +59,28 @@ int surface_lock_guard::pitch() const noexcept {
 // surface implementation
 // ============================================================================
 
-surface::surface(const surface_args& args) {
+surface::surface(const surface_args& args) : surface(try_create(args).value()) {
+}
+
+result<surface> surface::try_create(const surface_args& args) {
     if ((args.flags & surface_flags::preallocated) == surface_flags::preallocated) {
-        throw std::runtime_error(
-            "surface_flags::preallocated is not supported yet; supply external pixel memory before enabling this flag");
+        return error_info{error_code::unsupported,
+                          "surface_flags::preallocated is not supported yet; supply external pixel memory before "
+                          "enabling this flag"};
     }
 
-    m_surface = SDL_CreateSurface(args.size.width, args.size.height, static_cast<SDL_PixelFormat>(args.format));
-
-    if (!m_surface) {
-        throw error::from_sdl();
+    SDL_Surface* surf = SDL_CreateSurface(args.size.width, args.size.height, static_cast<SDL_PixelFormat>(args.format));
+    if (!surf) {
+        return error_info::from_sdl("Failed to create surface");
     }
 
+    surface created(surf);
     if ((args.flags & surface_flags::rle_optimized) == surface_flags::rle_optimized) {
-        if (!SDL_SetSurfaceRLE(m_surface, true)) {
-            throw error::from_sdl();
+        if (!SDL_SetSurfaceRLE(surf, true)) {
+            return error_info::from_sdl("Failed to enable surface RLE");
         }
     }
+    return created;
 }
 
 surface::surface(dimensions size, pixel_format format) {
@@ -102,55 +107,41 @@ surface surface::load_png(std::string_view path) {
     throw error("PNG loading requires SDL_image library - not yet implemented: {}", "feature not available");
 }
 
+surface surface::borrow(SDL_Surface* surf) noexcept {
+    return surface(surf, false);
+}
+
 surface::~surface() noexcept {
-    if (m_surface) {
+    if (m_surface && m_owned) {
         SDL_DestroySurface(m_surface);
     }
 }
 
-surface::surface(surface&& other) noexcept : m_surface{std::exchange(other.m_surface, nullptr)} {
+surface::surface(surface&& other) noexcept
+    : m_surface{std::exchange(other.m_surface, nullptr)}, m_owned{std::exchange(other.m_owned, true)} {
 }
 
 surface& surface::operator=(surface&& other) noexcept {
     if (this != &other) {
-        if (m_surface) {
+        if (m_surface && m_owned) {
             SDL_DestroySurface(m_surface);
         }
         m_surface = std::exchange(other.m_surface, nullptr);
+        m_owned = std::exchange(other.m_owned, true);
     }
     return *this;
 }
 
 void surface::fill(color c) {
-    const std::uint32_t mapped_color = SDL_MapSurfaceRGBA(m_surface, c.r, c.g, c.b, c.a);
-
-    if (!SDL_FillSurfaceRect(m_surface, nullptr, mapped_color)) {
-        throw error::from_sdl();
-    }
+    try_fill(c).value();
 }
 
 void surface::fill_rect(const rect& r, color c) {
-    const SDL_Rect sdl_rect{r.x, r.y, r.w, r.h};
-    const std::uint32_t mapped_color = SDL_MapSurfaceRGBA(m_surface, c.r, c.g, c.b, c.a);
-
-    if (!SDL_FillSurfaceRect(m_surface, &sdl_rect, mapped_color)) {
-        throw error::from_sdl();
-    }
+    try_fill_rect(r, c).value();
 }
 
 void surface::fill_rects(std::span<const rect> rects, color c) {
-    const std::uint32_t mapped_color = SDL_MapSurfaceRGBA(m_surface, c.r, c.g, c.b, c.a);
-
-    // Convert laya rects to SDL rects
-    std::vector<SDL_Rect> sdl_rects;
-    sdl_rects.reserve(rects.size());
-
-    std::transform(rects.begin(), rects.end(), std::back_inserter(sdl_rects),
-                   [](const rect& r) { return SDL_Rect{r.x, r.y, r.w, r.h}; });
-
-    if (!SDL_FillSurfaceRects(m_surface, sdl_rects.data(), static_cast<int>(sdl_rects.size()), mapped_color)) {
-        throw error::from_sdl();
-    }
+    try_fill_rects(rects, c).value();
 }
 
 void surface::clear() {
@@ -160,20 +151,11 @@ void surface::clear() {
 }
 
 void surface::blit(const surface& src, const rect& src_rect, const rect& dst_rect) {
-    const SDL_Rect sdl_src_rect{src_rect.x, src_rect.y, src_rect.w, src_rect.h};
-    const SDL_Rect sdl_dst_rect{dst_rect.x, dst_rect.y, dst_rect.w, dst_rect.h};
-
-    if (!SDL_BlitSurface(src.m_surface, &sdl_src_rect, m_surface, &sdl_dst_rect)) {
-        throw error::from_sdl();
-    }
+    try_blit(src, src_rect, dst_rect).value();
 }
 
 void surface::blit(const surface& src, point dst_pos) {
-    SDL_Rect sdl_dst_rect{dst_pos.x, dst_pos.y, 0, 0};
-
-    if (!SDL_BlitSurface(src.m_surface, nullptr, m_surface, &sdl_dst_rect)) {
-        throw error::from_sdl();
-    }
+    try_blit(src, dst_pos).value();
 }
 
 void surface::set_alpha_mod(std::uint8_t alpha) {
@@ -343,8 +325,70 @@ SDL_Surface* surface::native_handle() const noexcept {
     return m_surface;
 }
 
-surface::surface(SDL_Surface* surf) : m_surface(surf) {
-    // Private constructor for factory methods - takes ownership
+bool surface::owns_handle() const noexcept {
+    return m_owned;
+}
+
+surface::surface(SDL_Surface* surf, bool owned) : m_surface(surf), m_owned(owned) {
+    // Private constructor for factory methods - takes ownership unless borrowing
+}
+
+// ============================================================================
+// Non-throwing operations
+// ============================================================================
+
+result<void> surface::try_fill(color c) {
+    const std::uint32_t mapped_color = SDL_MapSurfaceRGBA(m_surface, c.r, c.g, c.b, c.a);
+
+    if (!SDL_FillSurfaceRect(m_surface, nullptr, mapped_color)) {
+        return error_info::from_sdl("Failed to fill surface");
+    }
+    return {};
+}
+
+result<void> surface::try_fill_rect(const rect& r, color c) {
+    const SDL_Rect sdl_rect{r.x, r.y, r.w, r.h};
+    const std::uint32_t mapped_color = SDL_MapSurfaceRGBA(m_surface, c.r, c.g, c.b, c.a);
+
+    if (!SDL_FillSurfaceRect(m_surface, &sdl_rect, mapped_color)) {
+        return error_info::from_sdl("Failed to fill surface rect");
+    }
+    return {};
+}
+
+result<void> surface::try_fill_rects(std::span<const rect> rects, color c) {
+    const std::uint32_t mapped_color = SDL_MapSurfaceRGBA(m_surface, c.r, c.g, c.b, c.a);
+
+    // Convert laya rects to SDL rects
+    std::vector<SDL_Rect> sdl_rects;
+    sdl_rects.reserve(rects.size());
+
+    std::transform(rects.begin(), rects.end(), std::back_inserter(sdl_rects),
+                   [](const rect& r) { return SDL_Rect{r.x, r.y, r.w, r.h}; });
+
+    if (!SDL_FillSurfaceRects(m_surface, sdl_rects.data(), static_cast<int>(sdl_rects.size()), mapped_color)) {
+        return error_info::from_sdl("Failed to fill surface rects");
+    }
+    return {};
+}
+
+result<void> surface::try_blit(const surface& src, const rect& src_rect, const rect& dst_rect) {
+    const SDL_Rect sdl_src_rect{src_rect.x, src_rect.y, src_rect.w, src_rect.h};
+    const SDL_Rect sdl_dst_rect{dst_rect.x, dst_rect.y, dst_rect.w, dst_rect.h};
+
+    if (!SDL_BlitSurface(src.m_surface, &sdl_src_rect, m_surface, &sdl_dst_rect)) {
+        return error_info::from_sdl("Failed to blit surface");
+    }
+    return {};
+}
+
+result<void> surface::try_blit(const surface& src, point dst_pos) {
+    SDL_Rect sdl_dst_rect{dst_pos.x, dst_pos.y, 0, 0};
+
+    if (!SDL_BlitSurface(src.m_surface, nullptr, m_surface, &sdl_dst_rect)) {
+        return error_info::from_sdl("Failed to blit surface");
+    }
+    return {};
 }
 
 }  // namespace laya
@@ -14,17 +14,12 @@ namespace laya {
 // texture_lock_guard implementation
 // ============================================================================
 
-texture_lock_guard::texture_lock_guard(class texture& tex, const rect* region) : m_texture(&tex) {
-    SDL_Rect sdl_rect{};
-    SDL_Rect* rect_ptr = nullptr;
-    if (region) {
-        sdl_rect = SDL_Rect{region->x, region->y, region->w, region->h};
-        rect_ptr = &sdl_rect;
-    }
+texture_lock_guard::texture_lock_guard(class texture& tex, const rect* region)
+    : texture_lock_guard(region ? tex.try_lock(*region).value() : tex.try_lock().value()) {
+}
 
-    if (!SDL_LockTexture(tex.native_handle(), rect_ptr, &m_pixels, &m_pitch)) {
-        throw error::from_sdl();
-    }
+texture_lock_guard::texture_lock_guard(class texture* tex, void* pixels, int pitch) noexcept
+    : m_texture{tex}, m_pixels{pixels}, m_pitch{pitch} {
 }
 
 texture_lock_guard::texture_lock_guard(texture_lock_guard&& other) noexcept
@@ -66,19 +61,32 @@ texture::texture(const class renderer& renderer, const texture_args& args)
 }
 
 texture::texture(const class renderer& renderer, pixel_format format, dimensions size, texture_access access)
-    : m_size{size}, m_format{format}, m_access{access} {
-    m_texture = SDL_CreateTexture(renderer.native_handle(), static_cast<SDL_PixelFormat>(format),
-                                  static_cast<SDL_TextureAccess>(access), size.width, size.height);
+    : texture(try_create(renderer, texture_args{format, size, access}).value()) {
+}
 
-    if (!m_texture) {
-        throw error::from_sdl();
+result<texture> texture::try_create(const class renderer& renderer, const texture_args& args) {
+    SDL_Texture* tex = SDL_CreateTexture(renderer.native_handle(), static_cast<SDL_PixelFormat>(args.format),
+                                         static_cast<SDL_TextureAccess>(args.access), args.size.width,
+                                         args.size.height);
+    if (!tex) {
+        return error_info::from_sdl("Failed to create texture");
     }
+
+    texture created(tex);
+    created.m_size = args.size;
+    created.m_format = args.format;
+    created.m_access = args.access;
+    return created;
 }
 
 texture texture::from_surface(const class renderer& renderer, const surface& surf) {
+    return try_from_surface(renderer, surf).value();
+}
+
+result<texture> texture::try_from_surface(const class renderer& renderer, const surface& surf) {
     SDL_Texture* tex = SDL_CreateTextureFromSurface(renderer.native_handle(), surf.native_handle());
     if (!tex) {
-        throw error::from_sdl();
+        return error_info::from_sdl("Failed to create texture from surface");
     }
 
     texture result(tex);
@@ -138,22 +146,15 @@ texture& texture::operator=(texture&& other) noexcept {
 }
 
 void texture::update(const void* pixels, int pitch) {
-    if (!SDL_UpdateTexture(m_texture, nullptr, pixels, pitch)) {
-        throw error::from_sdl();
-    }
+    try_update(pixels, pitch).value();
 }
 
 void texture::update(const rect& r, const void* pixels, int pitch) {
-    const SDL_Rect sdl_rect{r.x, r.y, r.w, r.h};
-    if (!SDL_UpdateTexture(m_texture, &sdl_rect, pixels, pitch)) {
-        throw error::from_sdl();
-    }
+    try_update(r, pixels, pitch).value();
 }
 
 void texture::update(const surface& surf) {
-    if (!SDL_UpdateTexture(m_texture, nullptr, surf.native_handle()->pixels, surf.native_handle()->pitch)) {
-        throw error::from_sdl();
-    }
+    try_update(surf).value();
 }
 
 texture_lock_guard texture::lock() {
@@ -165,9 +166,7 @@ texture_lock_guard texture::lock(const rect& r) {
 }
 
 void texture::set_alpha_mod(std::uint8_t alpha) {
-    if (!SDL_SetTextureAlphaMod(m_texture, alpha)) {
-        throw error::from_sdl();
-    }
+    try_set_alpha_mod(alpha).value();
 }
 
 void texture::set_alpha_mod(float alpha) {
@@ -175,15 +174,11 @@ void texture::set_alpha_mod(float alpha) {
 }
 
 void texture::set_color_mod(color c) {
-    if (!SDL_SetTextureColorMod(m_texture, c.r, c.g, c.b)) {
-        throw error::from_sdl();
-    }
+    try_set_color_mod(c).value();
 }
 
 void texture::set_color_mod(std::uint8_t r, std::uint8_t g, std::uint8_t b) {
-    if (!SDL_SetTextureColorMod(m_texture, r, g, b)) {
-        throw error::from_sdl();
-    }
+    try_set_color_mod(color{r, g, b}).value();
 }
 
 void texture::set_color_mod(float r, float g, float b) {
@@ -192,9 +187,7 @@ void texture::set_color_mod(float r, float g, float b) {
 }
 
 void texture::set_blend_mode(blend_mode mode) {
-    if (!SDL_SetTextureBlendMode(m_texture, static_cast<SDL_BlendMode>(mode))) {
-        throw error::from_sdl();
-    }
+    try_set_blend_mode(mode).value();
 }
 
 void texture::set_scale_mode(scale_mode mode) {
@@ -245,6 +238,72 @@ scale_mode texture::get_scale_mode() const {
     return static_cast<scale_mode>(mode);
 }
 
+// ============================================================================
+// Non-throwing operations
+// ============================================================================
+
+result<void> texture::try_update(const void* pixels, int pitch) {
+    if (!SDL_UpdateTexture(m_texture, nullptr, pixels, pitch)) {
+        return error_info::from_sdl("Failed to update texture");
+    }
+    return {};
+}
+
+result<void> texture::try_update(const rect& r, const void* pixels, int pitch) {
+    const SDL_Rect sdl_rect{r.x, r.y, r.w, r.h};
+    if (!SDL_UpdateTexture(m_texture, &sdl_rect, pixels, pitch)) {
+        return error_info::from_sdl("Failed to update texture region");
+    }
+    return {};
+}
+
+result<void> texture::try_update(const surface& surf) {
+    if (!SDL_UpdateTexture(m_texture, nullptr, surf.native_handle()->pixels, surf.native_handle()->pitch)) {
+        return error_info::from_sdl("Failed to update texture from surface");
+    }
+    return {};
+}
+
+result<texture_lock_guard> texture::try_lock() {
+    void* pixels = nullptr;
+    int pitch = 0;
+    if (!SDL_LockTexture(m_texture, nullptr, &pixels, &pitch)) {
+        return error_info::from_sdl("Failed to lock texture");
+    }
+    return texture_lock_guard(this, pixels, pitch);
+}
+
+result<texture_lock_guard> texture::try_lock(const rect& r) {
+    const SDL_Rect sdl_rect{r.x, r.y, r.w, r.h};
+    void* pixels = nullptr;
+    int pitch = 0;
+    if (!SDL_LockTexture(m_texture, &sdl_rect, &pixels, &pitch)) {
+        return error_info::from_sdl("Failed to lock texture region");
+    }
+    return texture_lock_guard(this, pixels, pitch);
+}
+
+result<void> texture::try_set_alpha_mod(std::uint8_t alpha) {
+    if (!SDL_SetTextureAlphaMod(m_texture, alpha)) {
+        return error_info::from_sdl("Failed to set texture alpha mod");
+    }
+    return {};
+}
+
+result<void> texture::try_set_color_mod(color c) {
+    if (!SDL_SetTextureColorMod(m_texture, c.r, c.g, c.b)) {
+        return error_info::from_sdl("Failed to set texture color mod");
+    }
+    return {};
+}
+
+result<void> texture::try_set_blend_mode(blend_mode mode) {
+    if (!SDL_SetTextureBlendMode(m_texture, static_cast<SDL_BlendMode>(mode))) {
+        return error_info::from_sdl("Failed to set texture blend mode");
+    }
+    return {};
+}
+
 dimensions texture::size() const noexcept {
     return m_size;
 }
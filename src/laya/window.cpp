@@ -1,67 +1,126 @@
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
 
 #include <laya/windows/window.hpp>
 #include <laya/errors.hpp>
+#include <laya/logging/log.hpp>
+#include <laya/subsystems.hpp>
+#include <laya/surfaces/surface.hpp>
 #include <SDL3/SDL.h>
 
 namespace laya {
 
-namespace {
+// Dirty rects are handed to SDL without copying
+static_assert(sizeof(rect) == sizeof(SDL_Rect));
+static_assert(offsetof(rect, x) == offsetof(SDL_Rect, x) && offsetof(rect, y) == offsetof(SDL_Rect, y));
+static_assert(offsetof(rect, w) == offsetof(SDL_Rect, w) && offsetof(rect, h) == offsetof(SDL_Rect, h));
 
-template <typename Setter, typename... Args>
-void set_or_throw(SDL_PropertiesID props, Setter setter, Args&&... args) {
-    if (!setter(props, std::forward<Args>(args)...)) {
-        SDL_DestroyProperties(props);
-        throw error::from_sdl();
-    }
-}
+namespace {
 
-SDL_PropertiesID build_window_properties(const window_args& args) {
+/// Window creation properties, destroyed again if any of them cannot be set
+result<SDL_PropertiesID> build_window_properties(const window_args& args) {
     SDL_PropertiesID props = SDL_CreateProperties();
     if (props == 0) {
-        throw error::from_sdl();
+        return error_info::from_sdl("Failed to create window properties");
     }
 
     const std::string title{args.title};
-    set_or_throw(props, SDL_SetStringProperty, SDL_PROP_WINDOW_CREATE_TITLE_STRING, title.c_str());
-    set_or_throw(props, SDL_SetNumberProperty, SDL_PROP_WINDOW_CREATE_WIDTH_NUMBER,
-                 static_cast<Sint64>(args.size.width));
-    set_or_throw(props, SDL_SetNumberProperty, SDL_PROP_WINDOW_CREATE_HEIGHT_NUMBER,
-                 static_cast<Sint64>(args.size.height));
-    set_or_throw(props, SDL_SetNumberProperty, SDL_PROP_WINDOW_CREATE_FLAGS_NUMBER,
-                 static_cast<Sint64>(static_cast<std::uint64_t>(args.flags)));
-
-    if (args.initial_position) {
-        set_or_throw(props, SDL_SetNumberProperty, SDL_PROP_WINDOW_CREATE_X_NUMBER,
-                     static_cast<Sint64>(args.initial_position->x));
-        set_or_throw(props, SDL_SetNumberProperty, SDL_PROP_WINDOW_CREATE_Y_NUMBER,
-                     static_cast<Sint64>(args.initial_position->y));
+    bool ok = SDL_SetStringProperty(props, SDL_PROP_WINDOW_CREATE_TITLE_STRING, title.c_str()) &&
+              SDL_SetNumberProperty(props, SDL_PROP_WINDOW_CREATE_WIDTH_NUMBER, static_cast<Sint64>(args.size.width)) &&
+              SDL_SetNumberProperty(props, SDL_PROP_WINDOW_CREATE_HEIGHT_NUMBER,
+                                    static_cast<Sint64>(args.size.height)) &&
+              SDL_SetNumberProperty(props, SDL_PROP_WINDOW_CREATE_FLAGS_NUMBER,
+                                    static_cast<Sint64>(static_cast<std::uint64_t>(args.flags)));
+
+    if (ok && args.initial_position) {
+        ok = SDL_SetNumberProperty(props, SDL_PROP_WINDOW_CREATE_X_NUMBER,
+                                   static_cast<Sint64>(args.initial_position->x)) &&
+             SDL_SetNumberProperty(props, SDL_PROP_WINDOW_CREATE_Y_NUMBER,
+                                   static_cast<Sint64>(args.initial_position->y));
     }
 
-    if ((args.flags & window_flags::high_pixel_density) == window_flags::high_pixel_density) {
-        set_or_throw(props, SDL_SetBooleanProperty, SDL_PROP_WINDOW_CREATE_HIGH_PIXEL_DENSITY_BOOLEAN, true);
+    if (ok && (args.flags & window_flags::high_pixel_density) == window_flags::high_pixel_density) {
+        ok = SDL_SetBooleanProperty(props, SDL_PROP_WINDOW_CREATE_HIGH_PIXEL_DENSITY_BOOLEAN, true);
     }
 
+    if (!ok) {
+        auto err = error_info::from_sdl("Failed to set window properties");
+        SDL_DestroyProperties(props);
+        return err;
+    }
     return props;
 }
 
+/// Failure reported by try_ methods called on a moved-from window
+error_info null_handle(const std::source_location& location = std::source_location::current()) noexcept {
+    return error_info{error_code::invalid_handle, "Window handle is null", {}, location};
+}
+
+bool operator==(dimensions lhs, dimensions rhs) noexcept {
+    return lhs.width == rhs.width && lhs.height == rhs.height;
+}
+
+bool operator==(position lhs, position rhs) noexcept {
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+/// Pack the boolean state fields so they can be compared at once
+unsigned state_bits(const window_state& state) noexcept {
+    return static_cast<unsigned>(state.shown) | static_cast<unsigned>(state.minimized) << 1 |
+           static_cast<unsigned>(state.maximized) << 2 | static_cast<unsigned>(state.focused) << 3;
+}
+
+/// Compare a cached value against SDL in `checked` mode, SDL's value always wins
+template <class T>
+T check_cached(window_state_cache mode, window_id id, const char* name, const T& cached, const T& actual) {
+    if (mode == window_state_cache::checked && !(cached == actual)) {
+        log_warn("Window {} cached {} is stale, a window event was probably not passed to handle()", id.value(),
+                 name);
+    }
+    return actual;
+}
+
 }  // namespace
 
-window::window(const window_args& args) : m_window{nullptr}, m_id{} {
-    SDL_PropertiesID props = build_window_properties(args);
-    m_window = SDL_CreateWindowWithProperties(props);
-    SDL_DestroyProperties(props);
+window::window(const window_args& args) : window(try_create(args).value()) {
+}
 
-    if (!m_window) {
-        throw error::from_sdl();
+window::window(SDL_Window* handle) noexcept
+    : m_window{handle}, m_id{SDL_GetWindowID(handle)}, m_cache_mode{window_state_cache::none} {
+}
+
+result<window> window::try_create(const window_args& args) {
+    if (auto res = try_use_subsystem(subsystem::video); !res) {
+        return res.error();
     }
 
-    m_id = window_id{SDL_GetWindowID(m_window)};
-    if (!m_id.is_valid()) {
-        throw error::from_sdl();
+    auto props = build_window_properties(args);
+    if (!props) {
+        return props.error();
+    }
+
+    SDL_Window* handle = SDL_CreateWindowWithProperties(*props);
+    SDL_DestroyProperties(*props);
+    if (!handle) {
+        return error_info::from_sdl("Failed to create window");
+    }
+
+    window created(handle);
+    if (!created.m_id.is_valid()) {
+        return error_info::from_sdl("Failed to get window ID");
+    }
+
+    if (args.cache != window_state_cache::none) {
+        auto state = created.try_query_state();
+        if (!state) {
+            return state.error();
+        }
+        created.m_state = *state;
+        created.m_cache_mode = args.cache;
     }
+    return created;
 }
 
 window::window(std::string_view title, dimensions size, window_flags flags)
@@ -75,7 +134,10 @@ window::~window() noexcept {
 }
 
 window::window(window&& other) noexcept
-    : m_window{std::exchange(other.m_window, nullptr)}, m_id{std::exchange(other.m_id, window_id{})} {
+    : m_window{std::exchange(other.m_window, nullptr)},
+      m_id{std::exchange(other.m_id, window_id{})},
+      m_cache_mode{std::exchange(other.m_cache_mode, window_state_cache::none)},
+      m_state{other.m_state} {
 }
 
 window& window::operator=(window&& other) noexcept {
@@ -85,62 +147,48 @@ window& window::operator=(window&& other) noexcept {
         }
         m_window = std::exchange(other.m_window, nullptr);
         m_id = std::exchange(other.m_id, window_id{});
+        m_cache_mode = std::exchange(other.m_cache_mode, window_state_cache::none);
+        m_state = other.m_state;
     }
     return *this;
 }
 
 void window::show() {
-    SDL_Window* win = ensure_handle();
-    if (!SDL_ShowWindow(win)) {
-        throw error::from_sdl();
-    }
+    try_show().value();
 }
 
 void window::hide() {
-    SDL_Window* win = ensure_handle();
-    if (!SDL_HideWindow(win)) {
-        throw error::from_sdl();
-    }
+    try_hide().value();
 }
 
 void window::set_title(std::string_view title) {
-    SDL_Window* win = ensure_handle();
-    const std::string title_str{title};
-    if (!SDL_SetWindowTitle(win, title_str.c_str())) {
-        throw error::from_sdl();
-    }
+    try_set_title(title).value();
 }
 
 void window::set_size(dimensions size) {
-    SDL_Window* win = ensure_handle();
-    if (!SDL_SetWindowSize(win, size.width, size.height)) {
-        throw error::from_sdl();
-    }
+    try_set_size(size).value();
 }
 
-dimensions window::get_size() const {
+dimensions window::query_size() const {
     SDL_Window* win = ensure_handle();
     int w, h;
     if (!SDL_GetWindowSize(win, &w, &h)) {
         throw error::from_sdl();
     }
-    return {w, h};
+    return check_cached(m_cache_mode, m_id, "size", m_state.size, dimensions{w, h});
 }
 
 void window::set_position(position pos) {
-    SDL_Window* win = ensure_handle();
-    if (!SDL_SetWindowPosition(win, pos.x, pos.y)) {
-        throw error::from_sdl();
-    }
+    try_set_position(pos).value();
 }
 
-position window::get_position() const {
+position window::query_position() const {
     SDL_Window* win = ensure_handle();
     int x, y;
     if (!SDL_GetWindowPosition(win, &x, &y)) {
         throw error::from_sdl();
     }
-    return {x, y};
+    return check_cached(m_cache_mode, m_id, "position", m_state.pos, position{x, y});
 }
 
 void window::maximize() {
@@ -148,6 +196,7 @@ void window::maximize() {
     if (!SDL_MaximizeWindow(win)) {
         throw error::from_sdl();
     }
+    refresh_state_cache();
 }
 
 void window::minimize() {
@@ -155,6 +204,7 @@ void window::minimize() {
     if (!SDL_MinimizeWindow(win)) {
         throw error::from_sdl();
     }
+    refresh_state_cache();
 }
 
 void window::restore() {
@@ -162,6 +212,7 @@ void window::restore() {
     if (!SDL_RestoreWindow(win)) {
         throw error::from_sdl();
     }
+    refresh_state_cache();
 }
 
 void window::raise() {
@@ -176,6 +227,7 @@ void window::set_fullscreen(bool enabled) {
     if (!SDL_SetWindowFullscreen(win, enabled)) {
         throw error::from_sdl();
     }
+    refresh_state_cache();
 }
 
 void window::set_borderless(bool borderless) {
@@ -197,6 +249,12 @@ void window::set_minimum_size(dimensions size) {
     if (!SDL_SetWindowMinimumSize(win, size.width, size.height)) {
         throw error::from_sdl();
     }
+    // No event reports minimum size changes
+    if (m_cache_mode != window_state_cache::none) {
+        int w = 0, h = 0;
+        SDL_GetWindowMinimumSize(win, &w, &h);
+        m_state.minimum_size = dimensions{w, h};
+    }
 }
 
 void window::set_maximum_size(dimensions size) {
@@ -206,13 +264,13 @@ void window::set_maximum_size(dimensions size) {
     }
 }
 
-dimensions window::get_minimum_size() const {
+dimensions window::query_minimum_size() const {
     SDL_Window* win = ensure_handle();
     int w = 0, h = 0;
     if (!SDL_GetWindowMinimumSize(win, &w, &h)) {
         throw error::from_sdl();
     }
-    return {w, h};
+    return check_cached(m_cache_mode, m_id, "minimum size", m_state.minimum_size, dimensions{w, h});
 }
 
 dimensions window::get_maximum_size() const {
@@ -229,15 +287,19 @@ void window::set_opacity(float opacity) {
     if (!SDL_SetWindowOpacity(win, opacity)) {
         throw error::from_sdl();
     }
+    // No event reports opacity changes, and SDL clamps the value
+    if (m_cache_mode != window_state_cache::none) {
+        m_state.opacity = SDL_GetWindowOpacity(win);
+    }
 }
 
-float window::get_opacity() const {
+float window::query_opacity() const {
     SDL_Window* win = ensure_handle();
     const float opacity = SDL_GetWindowOpacity(win);
     if (opacity < 0.0f) {
         throw error::from_sdl();
     }
-    return opacity;
+    return check_cached(m_cache_mode, m_id, "opacity", m_state.opacity, opacity);
 }
 
 void window::set_mouse_grab(bool grab) {
@@ -254,6 +316,219 @@ void window::set_keyboard_grab(bool grab) {
     }
 }
 
+laya::surface window::surface() {
+    SDL_Window* win = ensure_handle();
+    SDL_Surface* surf = SDL_GetWindowSurface(win);
+    if (!surf) {
+        throw error::from_sdl();
+    }
+    return laya::surface::borrow(surf);
+}
+
+void window::update_surface() {
+    try_update_surface().value();
+}
+
+void window::update_surface_rects(std::span<const rect> rects) {
+    try_update_surface_rects(rects).value();
+}
+
+void window::set_state_cache(window_state_cache mode) {
+    if (mode != window_state_cache::none) {
+        m_state = query_state();
+    }
+    m_cache_mode = mode;
+}
+
+bool window::handle(const window_event& ev) noexcept {
+    if (m_cache_mode == window_state_cache::none || ev.id != m_id) {
+        return false;
+    }
+
+    switch (ev.event_type) {
+        case window_event_type::moved:
+            if (const auto* pos = std::get_if<window_event_data_position>(&ev.data)) {
+                m_state.pos = position{pos->x, pos->y};
+            }
+            break;
+        case window_event_type::resized:
+            if (const auto* size = std::get_if<window_event_data_size>(&ev.data)) {
+                m_state.size = dimensions{size->width, size->height};
+            }
+            break;
+        case window_event_type::size_changed:
+            if (const auto* size = std::get_if<window_event_data_size>(&ev.data)) {
+                m_state.pixel_size = dimensions{size->width, size->height};
+            }
+            break;
+        case window_event_type::shown:
+            m_state.shown = true;
+            break;
+        case window_event_type::hidden:
+            m_state.shown = false;
+            break;
+        case window_event_type::minimized:
+            m_state.minimized = true;
+            break;
+        case window_event_type::maximized:
+            m_state.minimized = false;
+            m_state.maximized = true;
+            break;
+        case window_event_type::restored:
+            m_state.minimized = false;
+            m_state.maximized = false;
+            break;
+        case window_event_type::focus_gained:
+            m_state.focused = true;
+            break;
+        case window_event_type::focus_lost:
+            m_state.focused = false;
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+window_state window::state() const {
+    if (m_cache_mode == window_state_cache::none) {
+        return query_state();
+    }
+    if (m_cache_mode == window_state_cache::checked) {
+        const window_state actual = query_state();
+        check_cached(m_cache_mode, m_id, "position", m_state.pos, actual.pos);
+        check_cached(m_cache_mode, m_id, "size", m_state.size, actual.size);
+        check_cached(m_cache_mode, m_id, "pixel size", m_state.pixel_size, actual.pixel_size);
+        check_cached(m_cache_mode, m_id, "flags", state_bits(m_state), state_bits(actual));
+        return actual;
+    }
+    return m_state;
+}
+
+window_state window::query_state() const {
+    return try_query_state().value();
+}
+
+void window::refresh_state_cache() noexcept {
+    if (m_cache_mode == window_state_cache::none) {
+        return;
+    }
+    // On failure the cache keeps its old values until the next event or setter
+    if (auto state = try_query_state()) {
+        m_state = *state;
+    }
+}
+
+result<window_state> window::try_query_state() const {
+    SDL_Window* win = m_window;
+    if (!win) {
+        return null_handle();
+    }
+
+    window_state state;
+    if (!SDL_GetWindowPosition(win, &state.pos.x, &state.pos.y) ||
+        !SDL_GetWindowSize(win, &state.size.width, &state.size.height) ||
+        !SDL_GetWindowSizeInPixels(win, &state.pixel_size.width, &state.pixel_size.height) ||
+        !SDL_GetWindowMinimumSize(win, &state.minimum_size.width, &state.minimum_size.height)) {
+        return error_info::from_sdl("Failed to query window geometry");
+    }
+
+    state.opacity = SDL_GetWindowOpacity(win);
+    if (state.opacity < 0.0f) {
+        return error_info::from_sdl("Failed to query window opacity");
+    }
+
+    const SDL_WindowFlags flags = SDL_GetWindowFlags(win);
+    state.shown = (flags & SDL_WINDOW_HIDDEN) == 0;
+    state.minimized = (flags & SDL_WINDOW_MINIMIZED) != 0;
+    state.maximized = (flags & SDL_WINDOW_MAXIMIZED) != 0;
+    state.focused = (flags & SDL_WINDOW_INPUT_FOCUS) != 0;
+    return state;
+}
+
+// ============================================================================
+// Non-throwing operations
+// ============================================================================
+
+result<void> window::try_show() {
+    if (!m_window) {
+        return null_handle();
+    }
+    if (!SDL_ShowWindow(m_window)) {
+        return error_info::from_sdl("Failed to show window");
+    }
+    refresh_state_cache();
+    return {};
+}
+
+result<void> window::try_hide() {
+    if (!m_window) {
+        return null_handle();
+    }
+    if (!SDL_HideWindow(m_window)) {
+        return error_info::from_sdl("Failed to hide window");
+    }
+    refresh_state_cache();
+    return {};
+}
+
+result<void> window::try_set_title(std::string_view title) {
+    if (!m_window) {
+        return null_handle();
+    }
+    const std::string title_str{title};
+    if (!SDL_SetWindowTitle(m_window, title_str.c_str())) {
+        return error_info::from_sdl("Failed to set window title");
+    }
+    return {};
+}
+
+result<void> window::try_set_size(dimensions size) {
+    if (!m_window) {
+        return null_handle();
+    }
+    if (!SDL_SetWindowSize(m_window, size.width, size.height)) {
+        return error_info::from_sdl("Failed to set window size");
+    }
+    refresh_state_cache();
+    return {};
+}
+
+result<void> window::try_set_position(position pos) {
+    if (!m_window) {
+        return null_handle();
+    }
+    if (!SDL_SetWindowPosition(m_window, pos.x, pos.y)) {
+        return error_info::from_sdl("Failed to set window position");
+    }
+    refresh_state_cache();
+    return {};
+}
+
+result<void> window::try_update_surface() {
+    if (!m_window) {
+        return null_handle();
+    }
+    if (!SDL_UpdateWindowSurface(m_window)) {
+        return error_info::from_sdl("Failed to update window surface");
+    }
+    return {};
+}
+
+result<void> window::try_update_surface_rects(std::span<const rect> rects) {
+    if (!m_window) {
+        return null_handle();
+    }
+    if (rects.empty()) {
+        return {};
+    }
+    const auto* sdl_rects = reinterpret_cast<const SDL_Rect*>(rects.data());
+    if (!SDL_UpdateWindowSurfaceRects(m_window, sdl_rects, static_cast<int>(rects.size()))) {
+        return error_info::from_sdl("Failed to update window surface rects");
+    }
+    return {};
+}
+
 bool window::is_valid() const noexcept {
     return m_window != nullptr && m_id.is_valid();
 }
@@ -0,0 +1,146 @@
+/// @file window_registry.cpp
+/// @date 2026-10-17
+
+#include <source_location>
+#include <utility>
+
+#include <laya/errors.hpp>
+#include <laya/windows/window_registry.hpp>
+
+namespace laya {
+
+window_handle window_registry::create(const window_args& args) {
+    return insert(window{args});
+}
+
+window_handle window_registry::create(const window_args& args, const renderer_args& render_args) {
+    const window_handle handle = create(args);
+    try {
+        create_renderer(handle, render_args);
+    } catch (...) {
+        destroy(handle);
+        throw;
+    }
+    return handle;
+}
+
+window_handle window_registry::insert(window&& win) {
+    if (!win.is_valid()) {
+        throw error(std::source_location::current(), "Cannot register an invalid window");
+    }
+
+    // The free slot is only taken once the id map insertion, the last step that can throw, succeeded
+    const bool reuse = !m_free.empty();
+    const std::uint32_t index = reuse ? m_free.back() : static_cast<std::uint32_t>(m_slots.size());
+    if (!reuse) {
+        m_slots.emplace_back();
+    }
+    try {
+        m_ids.emplace(win.id().value(), index);
+    } catch (...) {
+        if (!reuse) {
+            m_slots.pop_back();
+        }
+        throw;
+    }
+    if (reuse) {
+        m_free.pop_back();
+    }
+
+    slot& s = m_slots[index];
+    s.win.emplace(std::move(win));
+    return window_handle{index, s.generation};
+}
+
+renderer& window_registry::create_renderer(window_handle handle, const renderer_args& args) {
+    slot* s = find_slot(handle);
+    if (!s) {
+        throw error(std::source_location::current(), "Window handle is stale");
+    }
+    // Destroy the old renderer first, SDL allows one renderer per window
+    s->rend.reset();
+    return s->rend.emplace(*s->win, args);
+}
+
+bool window_registry::destroy(window_handle handle) noexcept {
+    slot* s = find_slot(handle);
+    if (!s) {
+        return false;
+    }
+
+    m_ids.erase(s->win->id().value());
+    s->rend.reset();
+    s->win.reset();
+
+    // Skip generation 0 on wrap-around, it marks invalid handles
+    if (++s->generation == 0) {
+        s->generation = 1;
+    }
+    m_free.push_back(handle.index);
+    return true;
+}
+
+void window_registry::clear() noexcept {
+    for (std::size_t i = 0; i < m_slots.size(); ++i) {
+        if (m_slots[i].win) {
+            destroy(window_handle{static_cast<std::uint32_t>(i), m_slots[i].generation});
+        }
+    }
+}
+
+window_handle window_registry::find(window_id id) const noexcept {
+    const auto it = m_ids.find(id.value());
+    if (it == m_ids.end()) {
+        return {};
+    }
+    return window_handle{it->second, m_slots[it->second].generation};
+}
+
+window* window_registry::get(window_id id) noexcept {
+    const auto it = m_ids.find(id.value());
+    return it != m_ids.end() ? &*m_slots[it->second].win : nullptr;
+}
+
+const window* window_registry::get(window_id id) const noexcept {
+    const auto it = m_ids.find(id.value());
+    return it != m_ids.end() ? &*m_slots[it->second].win : nullptr;
+}
+
+bool window_registry::handle(const event& ev) noexcept {
+    const auto* win_ev = std::get_if<window_event>(&ev);
+    if (!win_ev) {
+        return false;
+    }
+    window* win = get(win_ev->id);
+    if (!win) {
+        return false;
+    }
+    win->handle(*win_ev);
+    return true;
+}
+
+void window_registry::show_all() {
+    for_each([](window_handle, window& win, renderer*) { win.show(); });
+}
+
+void window_registry::hide_all() {
+    for_each([](window_handle, window& win, renderer*) { win.hide(); });
+}
+
+void window_registry::clear_all() {
+    for_each([](window_handle, window&, renderer* rend) {
+        if (rend) {
+            rend->clear();
+        }
+    });
+}
+
+void window_registry::present_all() {
+    for_each([](window_handle, window&, renderer* rend) {
+        if (rend) {
+            rend->present();
+        }
+    });
+}
+
+}  // namespace laya
@@ -0,0 +1,35 @@
+/// @file bench_allocations.cpp
+/// @brief Global operator new replacement that counts heap allocations for the benchmarks
+/// @date 2026-10-17
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "bench_utils.hpp"
+
+// Only allocations made through operator new are counted. Exception objects are allocated by the
+// C++ runtime and SDL allocates with malloc, so neither shows up here.
+namespace {
+std::atomic<std::size_t> allocation_counter{0};
+}  // anonymous namespace
+
+void* operator new(std::size_t size) {
+    allocation_counter.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size != 0 ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+std::size_t laya_bench::allocation_count() noexcept {
+    return allocation_counter.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,485 @@
+/// @file bench_compare.cpp
+/// @brief Compare two benchmark result files and flag statistically significant regressions
+/// @date 2026-10-17
+///
+/// Usage: laya_bench_compare [--threshold PERCENT] baseline.json current.json
+///
+/// Reads the JSON or CSV files laya_tests_benchmark writes to LAYA_BENCH_RESULTS. A result is a
+/// regression when its mean grew by more than the threshold (default 5%) and Welch's t-test finds
+/// the difference significant at 95%. Exits with 1 if any result regressed.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+struct result_row {
+    std::string key;  ///< "group / name"
+    double mean = 0.0;
+    double stddev = 0.0;  ///< Population standard deviation, as calculate_statistics() reports it
+    std::size_t samples = 0;
+};
+
+struct result_file {
+    std::map<std::string, std::string> environment;
+    std::vector<result_row> rows;
+};
+
+// ============================================================================
+// JSON
+// ============================================================================
+
+/// Just enough JSON for the files bench_report.cpp writes
+struct json_value {
+    enum class kind { null, boolean, number, string, array, object };
+
+    kind type = kind::null;
+    double number = 0.0;
+    std::string text;
+    std::vector<json_value> items;
+    std::vector<std::pair<std::string, json_value>> members;
+
+    [[nodiscard]] const json_value* find(std::string_view key) const {
+        for (const auto& [name, value] : members) {
+            if (name == key) {
+                return &value;
+            }
+        }
+        return nullptr;
+    }
+};
+
+class json_parser {
+public:
+    explicit json_parser(std::string_view input) : m_input{input} {
+    }
+
+    std::optional<json_value> parse() {
+        auto value = parse_value();
+        skip_whitespace();
+        if (!value || m_pos != m_input.size()) {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+private:
+    void skip_whitespace() {
+        while (m_pos < m_input.size() && std::string_view{" \t\r\n"}.find(m_input[m_pos]) != std::string_view::npos) {
+            ++m_pos;
+        }
+    }
+
+    bool consume(char c) {
+        skip_whitespace();
+        if (m_pos < m_input.size() && m_input[m_pos] == c) {
+            ++m_pos;
+            return true;
+        }
+        return false;
+    }
+
+    bool consume_word(std::string_view word) {
+        if (m_input.substr(m_pos, word.size()) == word) {
+            m_pos += word.size();
+            return true;
+        }
+        return false;
+    }
+
+    std::optional<std::string> parse_string() {
+        if (!consume('"')) {
+            return std::nullopt;
+        }
+        std::string out;
+        while (m_pos < m_input.size() && m_input[m_pos] != '"') {
+            char c = m_input[m_pos++];
+            if (c == '\\' && m_pos < m_input.size()) {
+                c = m_input[m_pos++];
+                switch (c) {
+                    case 'n':
+                        c = '\n';
+                        break;
+                    case 't':
+                        c = '\t';
+                        break;
+                    case 'r':
+                        c = '\r';
+                        break;
+                    case 'u':
+                        // Only control characters are escaped this way, they fit in one byte
+                        if (m_pos + 4 > m_input.size()) {
+                            return std::nullopt;
+                        }
+                        c = static_cast<char>(std::stoi(std::string{m_input.substr(m_pos, 4)}, nullptr, 16));
+                        m_pos += 4;
+                        break;
+                    default:
+                        break;
+                }
+            }
+            out += c;
+        }
+        if (m_pos >= m_input.size()) {
+            return std::nullopt;
+        }
+        ++m_pos;
+        return out;
+    }
+
+    std::optional<json_value> parse_value() {
+        skip_whitespace();
+        if (m_pos >= m_input.size()) {
+            return std::nullopt;
+        }
+
+        json_value value;
+        const char c = m_input[m_pos];
+        if (c == '{') {
+            ++m_pos;
+            value.type = json_value::kind::object;
+            if (consume('}')) {
+                return value;
+            }
+            do {
+                auto key = parse_string();
+                if (!key || !consume(':')) {
+                    return std::nullopt;
+                }
+                auto member = parse_value();
+                if (!member) {
+                    return std::nullopt;
+                }
+                value.members.emplace_back(std::move(*key), std::move(*member));
+            } while (consume(','));
+            return consume('}') ? std::optional{std::move(value)} : std::nullopt;
+        }
+        if (c == '[') {
+            ++m_pos;
+            value.type = json_value::kind::array;
+            if (consume(']')) {
+                return value;
+            }
+            do {
+                auto item = parse_value();
+                if (!item) {
+                    return std::nullopt;
+                }
+                value.items.push_back(std::move(*item));
+            } while (consume(','));
+            return consume(']') ? std::optional{std::move(value)} : std::nullopt;
+        }
+        if (c == '"') {
+            auto text = parse_string();
+            if (!text) {
+                return std::nullopt;
+            }
+            value.type = json_value::kind::string;
+            value.text = std::move(*text);
+            return value;
+        }
+        if (consume_word("true") || consume_word("false")) {
+            value.type = json_value::kind::boolean;
+            return value;
+        }
+        if (consume_word("null")) {
+            return value;
+        }
+
+        // Number
+        const std::string rest{m_input.substr(m_pos, 64)};
+        std::size_t used = 0;
+        try {
+            value.number = std::stod(rest, &used);
+        } catch (const std::exception&) {
+            return std::nullopt;
+        }
+        m_pos += used;
+        value.type = json_value::kind::number;
+        return value;
+    }
+
+    std::string_view m_input;
+    std::size_t m_pos = 0;
+};
+
+double number_member(const json_value& object, std::string_view key) {
+    const auto* value = object.find(key);
+    return value != nullptr && value->type == json_value::kind::number ? value->number : 0.0;
+}
+
+std::string string_member(const json_value& object, std::string_view key) {
+    const auto* value = object.find(key);
+    return value != nullptr && value->type == json_value::kind::string ? value->text : std::string{};
+}
+
+std::optional<result_file> read_json(const std::string& content) {
+    auto root = json_parser{content}.parse();
+    if (!root || root->type != json_value::kind::object) {
+        return std::nullopt;
+    }
+
+    result_file file;
+    if (const auto* env = root->find("environment")) {
+        for (const auto& [key, value] : env->members) {
+            file.environment[key] =
+                value.type == json_value::kind::string ? value.text : std::format("{:g}", value.number);
+        }
+    }
+    const auto* results = root->find("results");
+    if (results == nullptr || results->type != json_value::kind::array) {
+        return std::nullopt;
+    }
+    for (const auto& item : results->items) {
+        file.rows.push_back({string_member(item, "group") + " / " + string_member(item, "name"),
+                             number_member(item, "mean"), number_member(item, "stddev"),
+                             static_cast<std::size_t>(number_member(item, "samples"))});
+    }
+    return file;
+}
+
+// ============================================================================
+// CSV
+// ============================================================================
+
+std::vector<std::string> split_csv_line(const std::string& line) {
+    std::vector<std::string> fields(1);
+    bool quoted = false;
+    for (std::size_t i = 0; i < line.size(); ++i) {
+        const char c = line[i];
+        if (quoted) {
+            if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                fields.back() += '"';
+                ++i;
+            } else if (c == '"') {
+                quoted = false;
+            } else {
+                fields.back() += c;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            fields.emplace_back();
+        } else if (c != '\r') {
+            fields.back() += c;
+        }
+    }
+    return fields;
+}
+
+std::optional<result_file> read_csv(const std::string& content) {
+    result_file file;
+    std::istringstream in{content};
+    std::string line;
+    std::map<std::string, std::size_t> columns;
+
+    while (std::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        // Environment comments look like "# key: value"
+        if (line.starts_with("#")) {
+            const auto colon = line.find(':');
+            if (colon != std::string::npos && colon + 2 <= line.size()) {
+                file.environment[line.substr(2, colon - 2)] = line.substr(colon + 2);
+            }
+            continue;
+        }
+
+        const auto fields = split_csv_line(line);
+        if (columns.empty()) {
+            for (std::size_t i = 0; i < fields.size(); ++i) {
+                columns[fields[i]] = i;
+            }
+            if (!columns.contains("group") || !columns.contains("name") || !columns.contains("mean") ||
+                !columns.contains("stddev") || !columns.contains("samples")) {
+                return std::nullopt;
+            }
+            continue;
+        }
+
+        auto field = [&](const char* column) -> std::string {
+            const auto index = columns.at(column);
+            return index < fields.size() ? fields[index] : std::string{};
+        };
+        auto number = [&](const char* column) {
+            const auto text = field(column);
+            return text.empty() ? 0.0 : std::strtod(text.c_str(), nullptr);
+        };
+        file.rows.push_back({field("group") + " / " + field("name"), number("mean"), number("stddev"),
+                             static_cast<std::size_t>(number("samples"))});
+    }
+    return columns.empty() ? std::nullopt : std::optional{std::move(file)};
+}
+
+std::optional<result_file> read_results(const std::string& path) {
+    std::ifstream in{path, std::ios::binary};
+    if (!in) {
+        std::cerr << "Cannot open " << path << "\n";
+        return std::nullopt;
+    }
+    std::ostringstream buffer;
+    buffer << in.rdbuf();
+    const std::string content = buffer.str();
+
+    const auto first = content.find_first_not_of(" \t\r\n");
+    std::optional<result_file> file;
+    try {
+        file = first != std::string::npos && content[first] == '{' ? read_json(content) : read_csv(content);
+    } catch (const std::exception&) {
+        file.reset();
+    }
+    if (!file) {
+        std::cerr << "Cannot parse " << path << " as benchmark results\n";
+    }
+    return file;
+}
+
+// ============================================================================
+// Comparison
+// ============================================================================
+
+/// Welch's t-test, which does not assume both runs have the same variance
+bool significant_difference(const result_row& baseline, const result_row& current) {
+    if (baseline.samples < 2 || current.samples < 2) {
+        return false;
+    }
+    // Reported deviations are population deviations, convert them to sample variances
+    auto sample_variance = [](const result_row& row) {
+        const auto n = static_cast<double>(row.samples);
+        return row.stddev * row.stddev * n / (n - 1.0);
+    };
+    const double a = sample_variance(baseline) / static_cast<double>(baseline.samples);
+    const double b = sample_variance(current) / static_cast<double>(current.samples);
+    if (a + b <= 0.0) {
+        return baseline.mean != current.mean;
+    }
+
+    const double t = std::abs(current.mean - baseline.mean) / std::sqrt(a + b);
+    const double degrees_of_freedom =
+        (a + b) * (a + b) /
+        (a * a / static_cast<double>(baseline.samples - 1) + b * b / static_cast<double>(current.samples - 1));
+    return t > laya_bench::t_critical_95(static_cast<std::size_t>(std::max(1.0, std::floor(degrees_of_freedom))));
+}
+
+void print_environment_differences(const result_file& baseline, const result_file& current) {
+    // The timestamp always differs and says nothing about comparability
+    static constexpr const char* keys[] = {"cpu",         "cores",       "os",           "compiler",     "build_type",
+                                           "laya_version", "sdl_version", "video_driver", "render_driver"};
+    bool header = false;
+    for (const char* key : keys) {
+        const auto b = baseline.environment.find(key);
+        const auto c = current.environment.find(key);
+        const std::string before = b != baseline.environment.end() ? b->second : "?";
+        const std::string after = c != current.environment.end() ? c->second : "?";
+        if (before == after) {
+            continue;
+        }
+        if (!header) {
+            std::cout << "\n  Environment differences (results may not be comparable):\n";
+            header = true;
+        }
+        std::cout << "    " << key << ": " << before << " -> " << after << "\n";
+    }
+}
+
+int usage() {
+    std::cerr << "Usage: laya_bench_compare [--threshold PERCENT] baseline current\n";
+    return 2;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    double threshold = 5.0;
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--threshold" && i + 1 < argc) {
+            char* end = nullptr;
+            threshold = std::strtod(argv[++i], &end);
+            if (end == argv[i] || threshold < 0.0) {
+                return usage();
+            }
+        } else if (arg.starts_with("-")) {
+            return usage();
+        } else {
+            paths.emplace_back(arg);
+        }
+    }
+    if (paths.size() != 2) {
+        return usage();
+    }
+
+    const auto baseline = read_results(paths[0]);
+    const auto current = read_results(paths[1]);
+    if (!baseline || !current) {
+        return 2;
+    }
+
+    // Not print_header(), which would also start a group in the benchmark report
+    std::cout << "\n" << std::string(64, '=') << "\n  Benchmark Comparison\n" << std::string(64, '=') << "\n";
+    std::cout << "\n  Baseline:  " << paths[0] << "\n";
+    std::cout << "  Current:   " << paths[1] << "\n";
+    std::cout << std::format("  Threshold: {:.1f}% with a significant difference at 95%\n", threshold);
+    print_environment_differences(*baseline, *current);
+
+    std::map<std::string, const result_row*> baseline_rows;
+    for (const auto& row : baseline->rows) {
+        baseline_rows[row.key] = &row;
+    }
+
+    int regressions = 0;
+    int improvements = 0;
+    laya_bench::print_separator();
+    std::cout << "\n";
+    for (const auto& row : current->rows) {
+        const auto found = baseline_rows.find(row.key);
+        if (found == baseline_rows.end()) {
+            std::cout << std::format("  {:<10} {}\n", "new", row.key);
+            continue;
+        }
+        const auto& before = *found->second;
+        baseline_rows.erase(found);
+
+        const double change = before.mean > 0.0 ? (row.mean - before.mean) / before.mean * 100.0 : 0.0;
+        const bool significant = significant_difference(before, row);
+
+        const char* verdict = "unchanged";
+        if (std::abs(change) > threshold) {
+            if (!significant) {
+                verdict = "noise";
+            } else if (change > 0.0) {
+                verdict = "REGRESSION";
+                ++regressions;
+            } else {
+                verdict = "improved";
+                ++improvements;
+            }
+        }
+        std::cout << std::format("  {:<10} {}: {} -> {} ({:+.1f}%)\n", verdict, row.key,
+                                 laya_bench::format_time_auto(before.mean), laya_bench::format_time_auto(row.mean),
+                                 change);
+    }
+    for (const auto& [key, row] : baseline_rows) {
+        std::cout << std::format("  {:<10} {}\n", "missing", key);
+    }
+
+    laya_bench::print_separator();
+    std::cout << "\n  " << regressions << " regression(s), " << improvements << " improvement(s)\n\n";
+    return regressions > 0 ? 1 : 0;
+}
@@ -0,0 +1,274 @@
+/// @file bench_harness.cpp
+/// @brief Calibrated benchmark runner with warm-up, outlier detection and confidence intervals
+/// @date 2026-10-17
+
+#include "bench_harness.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <iostream>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define LAYA_BENCH_HAS_TSC 1
+#else
+#define LAYA_BENCH_HAS_TSC 0
+#endif
+
+namespace laya_bench {
+
+namespace {
+
+std::uint64_t steady_now() noexcept {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+#if LAYA_BENCH_HAS_TSC
+std::uint64_t tsc_now() noexcept {
+    // The fences keep the read from moving into or out of the timed code
+    _mm_lfence();
+    const std::uint64_t ticks = __rdtsc();
+    _mm_lfence();
+    return ticks;
+}
+
+/// Nanoseconds per time stamp counter tick, measured once against steady_clock
+double tsc_ns_per_tick() noexcept {
+    static const double ns_per_tick = [] {
+        const std::uint64_t steady_start = steady_now();
+        const std::uint64_t tsc_start = tsc_now();
+        while (steady_now() - steady_start < 20'000'000) {
+        }
+        const std::uint64_t tsc_end = tsc_now();
+        const std::uint64_t steady_end = steady_now();
+        return static_cast<double>(steady_end - steady_start) / static_cast<double>(tsc_end - tsc_start);
+    }();
+    return ns_per_tick;
+}
+#endif
+
+std::uint64_t read_clock(timer clock) noexcept {
+#if LAYA_BENCH_HAS_TSC
+    if (clock == timer::tsc) {
+        return tsc_now();
+    }
+#endif
+    static_cast<void>(clock);
+    return steady_now();
+}
+
+double to_ns(timer clock, std::uint64_t ticks) noexcept {
+#if LAYA_BENCH_HAS_TSC
+    if (clock == timer::tsc) {
+        return static_cast<double>(ticks) * tsc_ns_per_tick();
+    }
+#endif
+    static_cast<void>(clock);
+    return static_cast<double>(ticks);
+}
+
+/// Linear interpolation between the closest ranks of sorted values
+double quantile(const std::vector<double>& sorted, double q) noexcept {
+    const double position = q * static_cast<double>(sorted.size() - 1);
+    const auto lower = static_cast<std::size_t>(position);
+    const std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (position - static_cast<double>(lower));
+}
+
+outlier_counts classify_outliers(std::vector<double> values) {
+    outlier_counts counts;
+    if (values.size() < 4) {
+        return counts;
+    }
+    std::sort(values.begin(), values.end());
+    const double q1 = quantile(values, 0.25);
+    const double q3 = quantile(values, 0.75);
+    const double iqr = q3 - q1;
+    for (double value : values) {
+        if (value < q1 - 3.0 * iqr) {
+            ++counts.low_severe;
+        } else if (value < q1 - 1.5 * iqr) {
+            ++counts.low_mild;
+        } else if (value > q3 + 3.0 * iqr) {
+            ++counts.high_severe;
+        } else if (value > q3 + 1.5 * iqr) {
+            ++counts.high_mild;
+        }
+    }
+    return counts;
+}
+
+/// Run the body once with `iterations` and return the timed nanoseconds
+double run_once(const std::function<void(state&)>& body, std::uint64_t iterations, timer clock,
+                std::size_t& items_per_iteration) {
+    state s{iterations, clock};
+    body(s);
+    items_per_iteration = s.items_per_iteration();
+    return s.elapsed_ns();
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// state implementation
+// ============================================================================
+
+state::state(std::uint64_t iterations, timer clock) noexcept : m_iterations{iterations}, m_clock{clock} {
+}
+
+state::iterator state::begin() noexcept {
+    start_timing();
+    return iterator{this, m_iterations};
+}
+
+state::iterator state::end() noexcept {
+    return iterator{this, 0};
+}
+
+void state::pause_timing() noexcept {
+    stop_timing();
+}
+
+void state::resume_timing() noexcept {
+    start_timing();
+}
+
+void state::set_items_per_iteration(std::size_t items) noexcept {
+    m_items = items;
+}
+
+std::uint64_t state::iterations() const noexcept {
+    return m_iterations;
+}
+
+std::size_t state::items_per_iteration() const noexcept {
+    return m_items;
+}
+
+double state::elapsed_ns() const noexcept {
+    return m_elapsed_ns;
+}
+
+void state::start_timing() noexcept {
+    if (!m_running) {
+        m_running = true;
+        m_started = read_clock(m_clock);
+    }
+}
+
+void state::stop_timing() noexcept {
+    if (m_running) {
+        m_elapsed_ns += to_ns(m_clock, read_clock(m_clock) - m_started);
+        m_running = false;
+    }
+}
+
+// ============================================================================
+// Runner
+// ============================================================================
+
+benchmark_result run_benchmark(std::string name, const std::function<void(state&)>& body,
+                               const harness_options& options) {
+    benchmark_result result;
+    result.name = std::move(name);
+
+    const double target_ns = static_cast<double>(options.sample_time.count());
+    const std::uint64_t warmup_end = steady_now() + static_cast<std::uint64_t>(options.warmup.count());
+
+    // Calibration: grow the iteration count until one sample takes the target time. These runs
+    // also warm caches, branch predictors and lazily initialized state. A body that pauses timing
+    // for most of each iteration stops at ten times the target in wall time instead.
+    std::uint64_t iterations = 1;
+    while (true) {
+        const std::uint64_t wall_start = steady_now();
+        const double elapsed = run_once(body, iterations, options.clock, result.items_per_iteration);
+        const auto wall = static_cast<double>(steady_now() - wall_start);
+        result.total_iterations += iterations;
+        if (elapsed >= target_ns || wall >= 10.0 * target_ns) {
+            break;
+        }
+        // Overshoot a little so the next try usually lands past the target
+        const double factor = elapsed > 0.0 ? std::clamp(target_ns * 1.2 / elapsed, 1.5, 10.0) : 10.0;
+        iterations = static_cast<std::uint64_t>(std::ceil(static_cast<double>(iterations) * factor));
+    }
+
+    // Whatever warm-up time is left runs at the calibrated count
+    while (steady_now() < warmup_end) {
+        run_once(body, iterations, options.clock, result.items_per_iteration);
+        result.total_iterations += iterations;
+    }
+
+    result.iterations_per_sample = iterations;
+    result.samples.reserve(options.samples);
+    for (std::size_t i = 0; i < options.samples; ++i) {
+        const double elapsed = run_once(body, iterations, options.clock, result.items_per_iteration);
+        result.total_iterations += iterations;
+        result.samples.push_back(elapsed / 1000.0 / static_cast<double>(iterations));
+    }
+
+    result.stats = calculate_statistics(result.samples);
+    result.outliers = classify_outliers(result.samples);
+
+    // Confidence interval of the mean from the sample standard deviation
+    const std::size_t n = result.samples.size();
+    if (n > 1) {
+        double sum_squares = 0.0;
+        for (double value : result.samples) {
+            sum_squares += (value - result.stats.mean) * (value - result.stats.mean);
+        }
+        const double standard_error = std::sqrt(sum_squares / static_cast<double>(n - 1) / static_cast<double>(n));
+        const double half_width = t_critical_95(n - 1) * standard_error;
+        result.ci_low = result.stats.mean - half_width;
+        result.ci_high = result.stats.mean + half_width;
+    } else {
+        result.ci_low = result.ci_high = result.stats.mean;
+    }
+
+    return result;
+}
+
+// ============================================================================
+// Reporting
+// ============================================================================
+
+void print_configuration(const harness_options& options, const std::string& unit) {
+    std::cout << "    Samples per test:   " << options.samples << "\n";
+    const double sample_time_us = static_cast<double>(options.sample_time.count()) / 1000.0;
+    std::cout << "    Sample time:        " << format_time_auto(sample_time_us) << " (" << unit
+              << " calibrated per test)\n";
+}
+
+void print_result(const benchmark_result& result) {
+    print_statistics(result.name, result.stats, result.items_per_iteration);
+    report_samples(result);
+    std::cout << "    95% CI: [" << format_time_auto(result.ci_low) << ", " << format_time_auto(result.ci_high)
+              << std::format("] (±{:.1f}%)", result.relative_error() * 100.0) << "\n";
+    std::cout << "    Samples: " << result.samples.size() << " x " << result.iterations_per_sample << " iterations\n";
+
+    const auto& o = result.outliers;
+    if (o.total() > 0) {
+        std::cout << "    Outliers: " << o.total() << " of " << result.samples.size() << " (" << o.low_severe
+                  << " low severe, " << o.low_mild << " low mild, " << o.high_mild << " high mild, " << o.high_severe
+                  << " high severe)\n";
+    }
+    if (result.relative_error() > 0.05 || o.low_severe + o.high_severe > 0) {
+        std::cout << "    Warning: noisy result, close other programs or raise the sample time\n";
+    }
+}
+
+void print_comparison(const benchmark_result& baseline, const benchmark_result& comparison) {
+    print_comparison(baseline.name, baseline.stats, comparison.name, comparison.stats);
+    if (comparison.ci_low <= baseline.ci_high && baseline.ci_low <= comparison.ci_high) {
+        std::cout << "    The 95% confidence intervals overlap, the difference may be noise\n";
+    }
+}
+
+}  // namespace laya_bench
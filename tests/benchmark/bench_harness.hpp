@@ -0,0 +1,217 @@
+/// @file bench_harness.hpp
+/// @brief Calibrated benchmark runner with warm-up, outlier detection and confidence intervals
+/// @date 2026-10-17
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "bench_utils.hpp"
+
+namespace laya_bench {
+
+// ============================================================================
+// Optimization barriers
+// ============================================================================
+
+/// @brief Make the compiler assume `value` is read, so the computation producing it is kept
+template <class T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static_cast<void>(*static_cast<const volatile char*>(static_cast<const volatile void*>(&value)));
+#endif
+}
+
+/// @brief Make the compiler assume `value` is read and modified, so it cannot be folded to a constant
+template <class T>
+inline void do_not_optimize(T& value) {
+#if defined(__clang__)
+    asm volatile("" : "+r,m"(value) : : "memory");
+#elif defined(__GNUC__)
+    asm volatile("" : "+m,r"(value) : : "memory");
+#else
+    static_cast<void>(*static_cast<volatile char*>(static_cast<volatile void*>(&value)));
+#endif
+}
+
+/// @brief Make the compiler assume all memory is read and written here, so stores are not dropped
+inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// ============================================================================
+// Harness
+// ============================================================================
+
+/// @brief Clock used to time samples
+enum class timer {
+    steady,  ///< std::chrono::steady_clock
+    tsc      ///< CPU time stamp counter scaled to nanoseconds, steady_clock where unavailable
+};
+
+/// @brief How run_benchmark() samples a benchmark body
+struct harness_options {
+    std::chrono::nanoseconds warmup{std::chrono::milliseconds{100}};      ///< Untimed runs before sampling
+    std::chrono::nanoseconds sample_time{std::chrono::milliseconds{10}};  ///< Target duration of one sample
+    std::size_t samples = 30;                                             ///< Timed samples kept for statistics
+    timer clock = timer::steady;
+};
+
+/// @brief Iteration control handed to a benchmark body
+/// @note The body loops `for (auto _ : state)` around the code being measured. Only the loop is
+///       timed, setup before it is not. The harness picks the iteration count.
+class state {
+public:
+    /// @brief What the loop variable holds, marked so `auto _` does not trip unused variable warnings
+    struct [[maybe_unused]] loop_value {};
+
+    class iterator {
+    public:
+        bool operator!=(const iterator&) noexcept {
+            if (m_remaining != 0) {
+                return true;
+            }
+            m_state->stop_timing();
+            return false;
+        }
+        void operator++() noexcept {
+            --m_remaining;
+        }
+        loop_value operator*() const noexcept {
+            return {};
+        }
+
+    private:
+        friend class state;
+        iterator(state* owner, std::uint64_t remaining) noexcept : m_state{owner}, m_remaining{remaining} {
+        }
+
+        state* m_state;
+        std::uint64_t m_remaining;
+    };
+
+    state(std::uint64_t iterations, timer clock) noexcept;
+
+    [[nodiscard]] iterator begin() noexcept;
+    [[nodiscard]] iterator end() noexcept;
+
+    /// @brief Exclude the following code from the timing, e.g. per-iteration setup
+    void pause_timing() noexcept;
+
+    /// @brief Resume timing after pause_timing()
+    void resume_timing() noexcept;
+
+    /// @brief Items each iteration processes, for the throughput report (default 1)
+    void set_items_per_iteration(std::size_t items) noexcept;
+
+    [[nodiscard]] std::uint64_t iterations() const noexcept;
+    [[nodiscard]] std::size_t items_per_iteration() const noexcept;
+
+    /// @brief Timed nanoseconds of the loop
+    [[nodiscard]] double elapsed_ns() const noexcept;
+
+private:
+    void start_timing() noexcept;
+    void stop_timing() noexcept;
+
+    std::uint64_t m_iterations;
+    timer m_clock;
+    std::uint64_t m_started = 0;
+    double m_elapsed_ns = 0.0;
+    bool m_running = false;
+    std::size_t m_items = 1;
+};
+
+/// @brief Samples outside the Tukey fences of the interquartile range
+struct outlier_counts {
+    std::size_t low_severe = 0;   ///< Below Q1 - 3 IQR
+    std::size_t low_mild = 0;     ///< Below Q1 - 1.5 IQR
+    std::size_t high_mild = 0;    ///< Above Q3 + 1.5 IQR
+    std::size_t high_severe = 0;  ///< Above Q3 + 3 IQR
+
+    [[nodiscard]] std::size_t total() const noexcept {
+        return low_severe + low_mild + high_mild + high_severe;
+    }
+};
+
+/// @brief Everything run_benchmark() measured
+struct benchmark_result {
+    std::string name;
+    std::vector<double> samples;  ///< Microseconds per iteration, one entry per sample
+    statistics stats;             ///< Of `samples`
+    double ci_low = 0.0;          ///< 95% confidence interval of the mean, microseconds
+    double ci_high = 0.0;
+    outlier_counts outliers;
+    std::uint64_t iterations_per_sample = 0;
+    std::uint64_t total_iterations = 0;  ///< Including warm-up and calibration
+    std::size_t items_per_iteration = 1;
+
+    /// @brief Half width of the confidence interval relative to the mean
+    [[nodiscard]] double relative_error() const noexcept {
+        return stats.mean > 0.0 ? (ci_high - ci_low) / 2.0 / stats.mean : 0.0;
+    }
+};
+
+/// @brief Warm up, calibrate the iteration count to `options.sample_time`, then take the samples
+benchmark_result run_benchmark(std::string name, const std::function<void(state&)>& body,
+                               const harness_options& options = {});
+
+/// @brief Attach the samples and confidence interval of `result` to its entry in the
+///        machine-readable report, defined in bench_report.cpp
+void report_samples(const benchmark_result& result);
+
+/// @brief Print the sample count and sample time as lines of a "Configuration" block
+/// @param unit What the harness calibrates the count of, e.g. "frames"
+void print_configuration(const harness_options& options = {}, const std::string& unit = "iterations");
+
+/// @brief Print statistics, confidence interval, outliers and a warning if the result is noisy
+void print_result(const benchmark_result& result);
+
+/// @brief Compare two results, noting when the confidence intervals overlap
+void print_comparison(const benchmark_result& baseline, const benchmark_result& comparison);
+
+}  // namespace laya_bench
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+#define LAYA_BENCH_CONCAT_IMPL(a, b) a##b
+#define LAYA_BENCH_CONCAT(a, b) LAYA_BENCH_CONCAT_IMPL(a, b)
+
+/// @brief Register a benchmark body with its own options as a test case of the "benchmark" suite
+#define LAYA_BENCHMARK_WITH_OPTIONS(name, options)                                                              \
+    static void LAYA_BENCH_CONCAT(laya_bench_body_, __LINE__)(::laya_bench::state&);                            \
+    TEST_CASE(name* doctest::test_suite("benchmark")) {                                                         \
+        ::laya_bench::print_header(name);                                                                       \
+        ::laya_bench::print_result(                                                                             \
+            ::laya_bench::run_benchmark(name, LAYA_BENCH_CONCAT(laya_bench_body_, __LINE__), options));         \
+        ::laya_bench::print_separator();                                                                        \
+    }                                                                                                           \
+    static void LAYA_BENCH_CONCAT(laya_bench_body_, __LINE__)([[maybe_unused]] ::laya_bench::state & state)
+
+/// @brief Register a benchmark body as a test case of the "benchmark" suite
+/// @code
+/// LAYA_BENCHMARK("command_list fill_rect") {
+///     laya::command_list list;
+///     for (auto _ : state) {
+///         list.fill_rect({0, 0, 8, 8});
+///     }
+///     laya_bench::do_not_optimize(list);
+/// }
+/// @endcode
+#define LAYA_BENCHMARK(name) LAYA_BENCHMARK_WITH_OPTIONS(name, ::laya_bench::harness_options{})
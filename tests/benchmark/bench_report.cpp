@@ -0,0 +1,386 @@
+/// @file bench_report.cpp
+/// @brief Machine-readable benchmark results with environment metadata, written at exit
+/// @date 2026-10-17
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <SDL3/SDL.h>
+
+#include "bench_harness.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#define LAYA_BENCH_HAS_CPUID 1
+#else
+#define LAYA_BENCH_HAS_CPUID 0
+#endif
+
+#ifndef LAYA_BENCH_BUILD_TYPE
+#define LAYA_BENCH_BUILD_TYPE ""
+#endif
+
+#ifndef LAYA_BENCH_LAYA_VERSION
+#define LAYA_BENCH_LAYA_VERSION "unknown"
+#endif
+
+// Results are collected as print_header(), print_statistics() and print_result() report them. When
+// LAYA_BENCH_RESULTS names a file they are written there on exit, as CSV if the name ends in ".csv"
+// and as JSON otherwise. tests/benchmark/bench_compare.cpp reads both.
+namespace laya_bench {
+
+namespace {
+
+struct report_entry {
+    std::string group;
+    std::string name;
+    statistics stats{};
+    std::size_t items = 0;
+    std::string render_driver;
+
+    // Only results of run_benchmark() have these
+    double ci_low = 0.0;
+    double ci_high = 0.0;
+    std::uint64_t iterations_per_sample = 0;
+    std::vector<double> values;
+
+    // Counts that are not times, added with report_counter()
+    std::vector<std::pair<std::string, double>> counters;
+};
+
+struct environment {
+    std::string cpu;
+    unsigned cores = 0;
+    std::string os;
+    std::string compiler;
+    std::string build_type;
+    std::string laya_version;
+    std::string sdl_version;
+    std::string video_driver;
+    std::string render_driver;  ///< SDL_HINT_RENDER_DRIVER at the first result, each result has its own
+    std::string timestamp;
+};
+
+std::string cpu_name() {
+#if LAYA_BENCH_HAS_CPUID
+    // The brand string is spread over extended leaves 0x80000002 to 0x80000004
+    unsigned regs[12]{};
+#if defined(_MSC_VER)
+    int info[4]{};
+    __cpuid(info, static_cast<int>(0x80000000u));
+    if (static_cast<unsigned>(info[0]) >= 0x80000004u) {
+        for (unsigned leaf = 0; leaf < 3; ++leaf) {
+            __cpuid(info, static_cast<int>(0x80000002u + leaf));
+            for (unsigned i = 0; i < 4; ++i) {
+                regs[leaf * 4 + i] = static_cast<unsigned>(info[i]);
+            }
+        }
+    }
+#else
+    if (__get_cpuid_max(0x80000000u, nullptr) >= 0x80000004u) {
+        for (unsigned leaf = 0; leaf < 3; ++leaf) {
+            __get_cpuid(0x80000002u + leaf, &regs[leaf * 4], &regs[leaf * 4 + 1], &regs[leaf * 4 + 2],
+                        &regs[leaf * 4 + 3]);
+        }
+    }
+#endif
+    std::string brand(reinterpret_cast<const char*>(regs), sizeof(regs));
+    brand.resize(brand.find('\0') == std::string::npos ? brand.size() : brand.find('\0'));
+    const auto first = brand.find_first_not_of(' ');
+    if (first != std::string::npos) {
+        return brand.substr(first, brand.find_last_not_of(' ') - first + 1);
+    }
+#endif
+
+    // Other architectures name the CPU in /proc/cpuinfo on Linux
+    std::ifstream cpuinfo{"/proc/cpuinfo"};
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.starts_with("model name") || line.starts_with("Model") || line.starts_with("Hardware")) {
+            const auto colon = line.find(':');
+            if (colon != std::string::npos && colon + 2 <= line.size()) {
+                return line.substr(colon + 2);
+            }
+        }
+    }
+    return "unknown";
+}
+
+std::string compiler_name() {
+#if defined(__clang__)
+    return "Clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "GCC " __VERSION__;
+#elif defined(_MSC_VER)
+    return "MSVC " + std::to_string(_MSC_FULL_VER);
+#else
+    return "unknown";
+#endif
+}
+
+std::string build_type() {
+    std::string type = LAYA_BENCH_BUILD_TYPE;
+    if (type.empty()) {
+        type = "unspecified";
+    }
+#ifdef NDEBUG
+    return type + " (NDEBUG)";
+#else
+    return type + " (assertions on)";
+#endif
+}
+
+std::string utc_timestamp() {
+    const std::time_t now = std::time(nullptr);
+    std::tm utc{};
+#if defined(_WIN32)
+    gmtime_s(&utc, &now);
+#else
+    gmtime_r(&now, &utc);
+#endif
+    char buffer[32]{};
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    return buffer;
+}
+
+struct report {
+    std::mutex mutex;
+    std::string group;
+    std::string group_render_driver;
+    std::vector<report_entry> entries;
+    environment env;
+
+    report() {
+        env.cpu = cpu_name();
+        env.cores = std::thread::hardware_concurrency();
+        env.os = SDL_GetPlatform();
+        env.compiler = compiler_name();
+        env.build_type = build_type();
+        env.laya_version = LAYA_BENCH_LAYA_VERSION;
+        const int version = SDL_GetVersion();
+        env.sdl_version = std::to_string(SDL_VERSIONNUM_MAJOR(version)) + "." +
+                          std::to_string(SDL_VERSIONNUM_MINOR(version)) + "." +
+                          std::to_string(SDL_VERSIONNUM_MICRO(version));
+        env.timestamp = utc_timestamp();
+    }
+
+    ~report();
+};
+
+report& the_report() {
+    static report r;
+    return r;
+}
+
+/// The render driver SDL picks for renderers created without naming one
+std::string hinted_render_driver() {
+    const char* hint = SDL_GetHint(SDL_HINT_RENDER_DRIVER);
+    return hint != nullptr && *hint != '\0' ? hint : "default";
+}
+
+/// Drivers are only known while a benchmark holds a context, so they are read with each result
+void capture_drivers(environment& env) {
+    if (env.video_driver.empty()) {
+        if (const char* driver = SDL_GetCurrentVideoDriver()) {
+            env.video_driver = driver;
+        }
+    }
+    if (env.render_driver.empty()) {
+        env.render_driver = hinted_render_driver();
+    }
+}
+
+std::string json_escape(std::string_view text) {
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+            escaped += code;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string csv_field(std::string_view text) {
+    if (text.find_first_of(",\"\n") == std::string_view::npos) {
+        return std::string{text};
+    }
+    std::string quoted = "\"";
+    for (const char c : text) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+void write_json(std::ostream& out, const environment& env, const std::vector<report_entry>& entries) {
+    out << "{\n  \"format\": \"laya-benchmark-results\",\n  \"version\": 1,\n";
+    out << std::format(
+        "  \"environment\": {{\n    \"cpu\": \"{}\",\n    \"cores\": {},\n    \"os\": \"{}\",\n"
+        "    \"compiler\": \"{}\",\n    \"build_type\": \"{}\",\n    \"laya_version\": \"{}\",\n"
+        "    \"sdl_version\": \"{}\",\n    \"video_driver\": \"{}\",\n    \"render_driver\": \"{}\",\n"
+        "    \"timestamp\": \"{}\"\n  }},\n",
+        json_escape(env.cpu), env.cores, json_escape(env.os), json_escape(env.compiler), json_escape(env.build_type),
+        json_escape(env.laya_version), json_escape(env.sdl_version), json_escape(env.video_driver),
+        json_escape(env.render_driver), json_escape(env.timestamp));
+
+    out << "  \"results\": [\n";
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const auto& e = entries[i];
+        const auto& s = e.stats;
+        out << std::format(
+            "    {{\"group\": \"{}\", \"name\": \"{}\", \"unit\": \"us\", \"mean\": {:.6g}, \"median\": {:.6g}, "
+            "\"min\": {:.6g}, \"max\": {:.6g}, \"stddev\": {:.6g}, \"p95\": {:.6g}, \"p99\": {:.6g}, "
+            "\"samples\": {}, \"items\": {}, \"render_driver\": \"{}\"",
+            json_escape(e.group), json_escape(e.name), s.mean, s.median, s.min, s.max, s.stddev, s.p95, s.p99,
+            s.samples, e.items, json_escape(e.render_driver));
+        if (!e.values.empty()) {
+            out << std::format(
+                ", \"ci_low\": {:.6g}, \"ci_high\": {:.6g}, \"iterations_per_sample\": {}, \"values\": [", e.ci_low,
+                e.ci_high, e.iterations_per_sample);
+            for (std::size_t v = 0; v < e.values.size(); ++v) {
+                out << std::format("{}{:.6g}", v > 0 ? ", " : "", e.values[v]);
+            }
+            out << "]";
+        }
+        if (!e.counters.empty()) {
+            out << ", \"counters\": {";
+            for (std::size_t c = 0; c < e.counters.size(); ++c) {
+                out << std::format("{}\"{}\": {:.6g}", c > 0 ? ", " : "", json_escape(e.counters[c].first),
+                                   e.counters[c].second);
+            }
+            out << "}";
+        }
+        out << "}" << (i + 1 < entries.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+void write_csv(std::ostream& out, const environment& env, const std::vector<report_entry>& entries) {
+    // The environment goes in leading comment lines, the rest is one row per result
+    out << "# format: laya-benchmark-results\n# version: 1\n";
+    out << "# cpu: " << env.cpu << "\n# cores: " << env.cores << "\n# os: " << env.os << "\n";
+    out << "# compiler: " << env.compiler << "\n# build_type: " << env.build_type << "\n";
+    out << "# laya_version: " << env.laya_version << "\n# sdl_version: " << env.sdl_version << "\n";
+    out << "# video_driver: " << env.video_driver << "\n# render_driver: " << env.render_driver << "\n";
+    out << "# timestamp: " << env.timestamp << "\n";
+
+    out << "group,name,unit,mean,median,min,max,stddev,p95,p99,samples,items,ci_low,ci_high,render_driver,counters\n";
+    for (const auto& e : entries) {
+        const auto& s = e.stats;
+        out << std::format("{},{},us,{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{:.6g},{},{},", csv_field(e.group),
+                           csv_field(e.name), s.mean, s.median, s.min, s.max, s.stddev, s.p95, s.p99, s.samples,
+                           e.items);
+        if (!e.values.empty()) {
+            out << std::format("{:.6g},{:.6g}", e.ci_low, e.ci_high);
+        } else {
+            out << ",";
+        }
+
+        // Counters share one field as "name=value;name=value"
+        std::string counters;
+        for (const auto& [name, value] : e.counters) {
+            counters += std::format("{}{}={:.6g}", counters.empty() ? "" : ";", name, value);
+        }
+        out << "," << csv_field(e.render_driver) << "," << csv_field(counters) << "\n";
+    }
+}
+
+report::~report() {
+    const char* path = std::getenv("LAYA_BENCH_RESULTS");
+    if (path == nullptr || *path == '\0' || entries.empty()) {
+        return;
+    }
+
+    std::ofstream out{path};
+    if (!out) {
+        std::cout << "\n  Warning: could not write " << path << "\n";
+        return;
+    }
+    if (std::string_view{path}.ends_with(".csv")) {
+        write_csv(out, env, entries);
+    } else {
+        write_json(out, env, entries);
+    }
+    std::cout << "\n  Results written to " << path << "\n";
+}
+
+}  // anonymous namespace
+
+void report_group(const std::string& title, const std::string& render_driver) {
+    auto& r = the_report();
+    std::lock_guard lock{r.mutex};
+    r.group = title;
+    r.group_render_driver = render_driver;
+}
+
+void report_statistics(const std::string& label, const statistics& stats, std::size_t items) {
+    auto& r = the_report();
+    std::lock_guard lock{r.mutex};
+    capture_drivers(r.env);
+
+    // Results are matched by group and name, so a repeated label would hide the earlier result
+    for (const auto& e : r.entries) {
+        if (e.group == r.group && e.name == label) {
+            std::cout << "\n  Warning: \"" << label << "\" is reported twice under \"" << r.group << "\"\n";
+            break;
+        }
+    }
+
+    report_entry entry;
+    entry.group = r.group;
+    entry.name = label;
+    entry.stats = stats;
+    entry.items = items;
+    entry.render_driver = r.group_render_driver.empty() ? hinted_render_driver() : r.group_render_driver;
+    r.entries.push_back(std::move(entry));
+}
+
+void report_counter(const std::string& name, double value) {
+    auto& r = the_report();
+    std::lock_guard lock{r.mutex};
+    if (r.entries.empty()) {
+        return;
+    }
+    r.entries.back().counters.emplace_back(name, value);
+}
+
+void report_samples(const benchmark_result& result) {
+    auto& r = the_report();
+    std::lock_guard lock{r.mutex};
+    if (r.entries.empty()) {
+        return;
+    }
+    // print_result() reports the statistics first, so the entry is the most recent one
+    auto& e = r.entries.back();
+    e.ci_low = result.ci_low;
+    e.ci_high = result.ci_high;
+    e.iterations_per_sample = result.iterations_per_sample;
+    e.values = result.samples;
+}
+
+}  // namespace laya_bench
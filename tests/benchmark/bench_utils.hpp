@@ -9,12 +9,16 @@
 #include <cmath>
 #include <format>
 #include <iostream>
+#include <iterator>
 #include <numeric>
 #include <string>
 #include <vector>
 
 namespace laya_bench {
 
+/// @brief Number of operator new calls so far in this process, defined in bench_allocations.cpp
+std::size_t allocation_count() noexcept;
+
 /// @brief Statistical results from benchmark runs
 struct statistics {
     double min;
@@ -27,6 +31,18 @@ struct statistics {
     std::size_t samples;
 };
 
+/// @brief Start a new group of results in the machine-readable report, defined in bench_report.cpp
+/// @param render_driver Driver the group's results ran on, when the group picks one; otherwise each
+///                      result records the driver SDL_HINT_RENDER_DRIVER selects
+void report_group(const std::string& title, const std::string& render_driver = {});
+
+/// @brief Add a result to the machine-readable report, defined in bench_report.cpp
+void report_statistics(const std::string& label, const statistics& stats, std::size_t items);
+
+/// @brief Attach a count, e.g. retries, to the most recent result in the machine-readable report,
+///        defined in bench_report.cpp
+void report_counter(const std::string& name, double value);
+
 /// @brief Calculate statistics from a series of measurements
 /// @param values Vector of measurement values in microseconds
 /// @return Statistical analysis of the data
@@ -70,6 +86,27 @@ inline statistics calculate_statistics(std::vector<double> values) {
     return stats;
 }
 
+/// @brief Two-sided 95% critical value of Student's t distribution
+/// @param degrees_of_freedom Degrees of freedom, 0 yields 0
+inline double t_critical_95(std::size_t degrees_of_freedom) noexcept {
+    static constexpr double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                       2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                       2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (degrees_of_freedom == 0) {
+        return 0.0;
+    }
+    if (degrees_of_freedom <= std::size(table)) {
+        return table[degrees_of_freedom - 1];
+    }
+    if (degrees_of_freedom <= 60) {
+        return 2.000;
+    }
+    if (degrees_of_freedom <= 120) {
+        return 1.980;
+    }
+    return 1.960;
+}
+
 /// @brief Format microseconds as "0.123456s / 123.456ms / 123456.789µs"
 /// @param microseconds Time in microseconds
 /// @return Formatted string with multiple units
@@ -125,6 +162,8 @@ inline std::string format_throughput(double items_per_second) {
 /// @param stats Statistical results
 /// @param items Number of items processed (for throughput calculation)
 inline void print_statistics(const std::string& label, const statistics& stats, std::size_t items = 0) {
+    report_statistics(label, stats, items);
+
     std::cout << "\n  " << label << ":\n";
     std::cout << "    Mean:   " << format_time_auto(stats.mean) << "\n";
     std::cout << "    Median: " << format_time_auto(stats.median) << "\n";
@@ -172,6 +211,8 @@ inline void print_separator() {
 /// @brief Print a benchmark header
 /// @param title Title of the benchmark section
 inline void print_header(const std::string& title) {
+    report_group(title);
+
     std::cout << "\n" << std::string(64, '=') << "\n";
     std::cout << "  " << title << "\n";
     std::cout << std::string(64, '=') << "\n";
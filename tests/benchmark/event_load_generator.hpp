@@ -0,0 +1,247 @@
+/// @file event_load_generator.hpp
+/// @brief Synthetic SDL event load generator for stress benchmarks
+/// @date 2026-10-17
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <SDL3/SDL.h>
+
+namespace laya_bench {
+
+/// @brief Event categories the load generator can produce
+enum class load_event_kind : std::size_t { key, mouse_motion, mouse_wheel, window, unsupported, count };
+
+/// @brief Relative weights of each event category in the generated stream
+/// @note Weights are relative to each other; a zero weight disables that category
+struct event_mix {
+    std::uint32_t key = 1;
+    std::uint32_t mouse_motion = 1;
+    std::uint32_t mouse_wheel = 1;
+    std::uint32_t window = 1;
+    std::uint32_t unsupported = 0;  ///< Events laya does not convert (skipped by the polling paths)
+};
+
+/// @brief Load generator configuration
+struct load_config {
+    std::size_t total_events = 10'000;  ///< Events to push across all producers
+    double events_per_second = 0.0;     ///< Target aggregate push rate, 0 pushes as fast as possible
+    std::size_t producer_threads = 1;   ///< Number of producer threads sharing the load
+    event_mix mix{};
+    std::uint32_t window_id = 0;  ///< Window the generated events are addressed to
+    std::uint64_t seed = 0x9E3779B97F4A7C15ull;
+    std::chrono::milliseconds push_timeout{1'000};  ///< How long one event is retried before it is dropped
+};
+
+/// @brief Pushes a configurable mix of synthetic events into the SDL queue from one or more threads
+/// @note Every event is stamped with SDL_GetTicksNS() right before it is pushed, so consumers can
+///       compute queue latency as `SDL_GetTicksNS() - timestamp`. When SDL refuses an event, e.g.
+///       because its queue is full, the producer yields and retries for up to `push_timeout`. SDL also
+///       refuses events an event filter drops or that arrive after the event subsystem quit, so an
+///       event still refused then is counted as dropped instead of retried forever.
+class event_load_generator {
+public:
+    explicit event_load_generator(const load_config& config) : m_config{config} {
+    }
+
+    ~event_load_generator() {
+        join();
+    }
+
+    event_load_generator(const event_load_generator&) = delete;
+    event_load_generator& operator=(const event_load_generator&) = delete;
+
+    /// @brief Launch the producer threads
+    void start() {
+        const std::size_t threads = m_config.producer_threads == 0 ? 1 : m_config.producer_threads;
+        m_producer_count = threads;
+        const auto start_time = std::chrono::steady_clock::now();
+
+        for (std::size_t t = 0; t < threads; ++t) {
+            // Spread the remainder over the first producers
+            const std::size_t share = m_config.total_events / threads + (t < m_config.total_events % threads ? 1 : 0);
+            m_threads.emplace_back([this, t, threads, share, start_time] { produce(t, threads, share, start_time); });
+        }
+    }
+
+    /// @brief Wait for every producer to finish
+    void join() {
+        for (auto& thread : m_threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+        m_threads.clear();
+    }
+
+    /// @brief Check if every producer has pushed its share
+    [[nodiscard]] bool done() const noexcept {
+        return m_finished_producers.load(std::memory_order_acquire) == m_producer_count;
+    }
+
+    /// @brief Total number of events pushed so far
+    [[nodiscard]] std::size_t pushed() const noexcept {
+        std::size_t total = 0;
+        for (const auto& counter : m_pushed) {
+            total += counter.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /// @brief Number of events pushed for one category
+    [[nodiscard]] std::size_t pushed(load_event_kind kind) const noexcept {
+        return m_pushed[static_cast<std::size_t>(kind)].load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of events laya is expected to surface (everything except unsupported events)
+    [[nodiscard]] std::size_t pushed_supported() const noexcept {
+        return pushed() - pushed(load_event_kind::unsupported);
+    }
+
+    /// @brief Number of times a producer found the SDL queue full and had to retry
+    [[nodiscard]] std::size_t queue_full_retries() const noexcept {
+        return m_retries.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of events SDL still refused after `push_timeout`, not counted as pushed
+    [[nodiscard]] std::size_t dropped() const noexcept {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const load_config& config() const noexcept {
+        return m_config;
+    }
+
+private:
+    static constexpr std::size_t kind_count = static_cast<std::size_t>(load_event_kind::count);
+
+    /// @brief Pick a category from the configured weights using a per-thread xorshift stream
+    load_event_kind pick_kind(std::uint64_t& state) const noexcept {
+        const std::array<std::uint32_t, kind_count> weights{m_config.mix.key, m_config.mix.mouse_motion,
+                                                            m_config.mix.mouse_wheel, m_config.mix.window,
+                                                            m_config.mix.unsupported};
+        std::uint64_t total = 0;
+        for (const auto w : weights) {
+            total += w;
+        }
+        if (total == 0) {
+            return load_event_kind::key;
+        }
+
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        std::uint64_t roll = state % total;
+        for (std::size_t i = 0; i < kind_count; ++i) {
+            if (roll < weights[i]) {
+                return static_cast<load_event_kind>(i);
+            }
+            roll -= weights[i];
+        }
+        return load_event_kind::key;
+    }
+
+    /// @brief Fill an SDL event of the given category
+    void make_event(load_event_kind kind, std::size_t sequence, SDL_Event& event) const noexcept {
+        event = SDL_Event{};
+        const auto coord = static_cast<float>(sequence % 1024);
+
+        switch (kind) {
+            case load_event_kind::key:
+                event.type = (sequence & 1) ? SDL_EVENT_KEY_UP : SDL_EVENT_KEY_DOWN;
+                event.key.windowID = m_config.window_id;
+                event.key.scancode = SDL_SCANCODE_A;
+                event.key.key = SDLK_A;
+                event.key.down = (sequence & 1) == 0;
+                break;
+            case load_event_kind::mouse_motion:
+                event.type = SDL_EVENT_MOUSE_MOTION;
+                event.motion.windowID = m_config.window_id;
+                event.motion.x = coord;
+                event.motion.y = coord;
+                event.motion.xrel = 1.0f;
+                event.motion.yrel = 1.0f;
+                break;
+            case load_event_kind::mouse_wheel:
+                event.type = SDL_EVENT_MOUSE_WHEEL;
+                event.wheel.windowID = m_config.window_id;
+                event.wheel.y = 1.0f;
+                break;
+            case load_event_kind::window:
+                event.type = SDL_EVENT_WINDOW_EXPOSED;
+                event.window.windowID = m_config.window_id;
+                break;
+            case load_event_kind::unsupported:
+            case load_event_kind::count:
+                event.type = SDL_EVENT_USER;
+                event.user.windowID = m_config.window_id;
+                event.user.code = static_cast<Sint32>(sequence);
+                break;
+        }
+    }
+
+    /// @brief Push one event, retrying while SDL refuses it until `push_timeout` passes
+    bool push(SDL_Event& event) {
+        const auto deadline = std::chrono::steady_clock::now() + m_config.push_timeout;
+        while (true) {
+            event.common.timestamp = SDL_GetTicksNS();
+            if (SDL_PushEvent(&event)) {
+                return true;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            m_retries.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::yield();
+        }
+    }
+
+    void produce(std::size_t index, std::size_t threads, std::size_t share,
+                 std::chrono::steady_clock::time_point start_time) {
+        std::uint64_t rng = m_config.seed + 0x9E3779B97F4A7C15ull * (index + 1);
+
+        // Each producer runs at its fraction of the aggregate rate
+        const bool paced = m_config.events_per_second > 0.0;
+        const std::chrono::duration<double> period{paced ? threads / m_config.events_per_second : 0.0};
+
+        SDL_Event event;
+        for (std::size_t i = 0; i < share; ++i) {
+            if (paced) {
+                const auto due =
+                    start_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(period * i);
+                if (std::chrono::steady_clock::now() < due) {
+                    std::this_thread::sleep_until(due);
+                }
+            }
+
+            const auto kind = pick_kind(rng);
+            make_event(kind, i, event);
+
+            if (push(event)) {
+                m_pushed[static_cast<std::size_t>(kind)].fetch_add(1, std::memory_order_relaxed);
+            } else {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        m_finished_producers.fetch_add(1, std::memory_order_release);
+    }
+
+private:
+    load_config m_config;
+    std::vector<std::thread> m_threads;
+    std::size_t m_producer_count = 0;  ///< Kept apart from m_threads, which join() clears
+    std::array<std::atomic<std::size_t>, kind_count> m_pushed{};
+    std::atomic<std::size_t> m_retries{0};
+    std::atomic<std::size_t> m_dropped{0};
+    std::atomic<std::size_t> m_finished_producers{0};
+};
+
+}  // namespace laya_bench
@@ -0,0 +1,108 @@
+/// @file test_error_benchmark.cpp
+/// @brief Benchmark tests for throwing and catching laya::error
+/// @date 2026-10-17
+
+#include <chrono>
+#include <format>
+#include <iostream>
+#include <source_location>
+#include <stdexcept>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+#include "bench_harness.hpp"
+
+// Exception objects themselves are allocated by the C++ runtime and are not counted by
+// laya_bench::allocation_count(), so the numbers are the allocations the message costs.
+namespace {
+
+/// Number of round trips used to count allocations, outside the timed samples
+constexpr int counted_throws = 10'000;
+
+struct throw_measurement {
+    laya_bench::benchmark_result timing;
+    double allocations_per_throw = 0.0;
+};
+
+/// Time throw-and-catch round trips, one per harness iteration, then count the allocations of a fixed number
+/// @return Time of one round trip and allocations per round trip
+template <class Throw, class Catch>
+throw_measurement measure_throws(const char* label, Throw do_throw, Catch on_catch) {
+    const auto round_trip = [&] {
+        try {
+            do_throw();
+        } catch (const std::runtime_error& e) {
+            on_catch(e);
+        }
+    };
+
+    throw_measurement result;
+    result.timing = laya_bench::run_benchmark(label, [&round_trip](laya_bench::state& state) {
+        for (auto _ : state) {
+            round_trip();
+        }
+    });
+
+    const std::size_t allocations_before = laya_bench::allocation_count();
+    for (int i = 0; i < counted_throws; ++i) {
+        round_trip();
+    }
+    const std::size_t allocations = laya_bench::allocation_count() - allocations_before;
+    result.allocations_per_throw = static_cast<double>(allocations) / counted_throws;
+    return result;
+}
+
+/// What laya::error::from_sdl built before formatting became lazy
+[[noreturn]] void throw_eager(const std::source_location& location = std::source_location::current()) {
+    throw std::runtime_error(std::format("[{}:{}:{}] SDL Error: {}", location.file_name(), location.line(),
+                                         location.function_name(), SDL_GetError()));
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("laya::error throw and catch") {
+        SDL_SetError("Parameter 'texture' is invalid");
+
+        laya_bench::print_header("laya::error Throw and Catch");
+
+        std::cout << "\n  Configuration:\n";
+        laya_bench::print_configuration();
+        std::cout << "    Counted throws:     " << counted_throws << "\n";
+
+        laya_bench::print_separator();
+
+        std::size_t checksum = 0;
+        const auto discard = [](const std::runtime_error&) {};
+        const auto read_message = [&checksum](const std::runtime_error& e) { checksum += e.what()[0]; };
+
+        std::cout << "\n  Running: eager formatting, caught and discarded...\n";
+        auto eager = measure_throws("eager (discarded)", [] { throw_eager(); }, discard);
+        laya_bench::print_result(eager.timing);
+
+        std::cout << "\n  Running: laya::error::from_sdl, caught and discarded...\n";
+        auto lazy = measure_throws("lazy (discarded)", [] { throw laya::error::from_sdl(); }, discard);
+        laya_bench::print_result(lazy.timing);
+
+        std::cout << "\n  Running: laya::error::from_sdl, caught and what() read...\n";
+        auto lazy_read = measure_throws("lazy (what() read)", [] { throw laya::error::from_sdl(); }, read_message);
+        laya_bench::print_result(lazy_read.timing);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Allocations per throw:\n";
+        std::cout << "    eager (discarded):  " << eager.allocations_per_throw << "\n";
+        std::cout << "    lazy (discarded):   " << lazy.allocations_per_throw << "\n";
+        std::cout << "    lazy (what() read): " << lazy_read.allocations_per_throw << "\n";
+
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison(eager.timing, lazy.timing);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+
+        CHECK(checksum > 0);
+        CHECK(lazy.allocations_per_throw < eager.allocations_per_throw);
+    }
+}
@@ -0,0 +1,214 @@
+/// @file test_event_stress_benchmark.cpp
+/// @brief Stress benchmarks for event polling under synthetic load
+/// @date 2026-10-17
+
+#include <chrono>
+#include <span>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <SDL3/SDL.h>
+#include <laya/laya.hpp>
+
+#include "bench_utils.hpp"
+#include "event_load_generator.hpp"
+
+namespace {
+
+constexpr auto drain_timeout = std::chrono::seconds{5};
+
+/// A polling strategy under test
+/// @note To benchmark a new queue type, add a consumer that drains whatever is currently
+///       queued and appends one latency sample (µs) per event it surfaces
+struct stress_consumer {
+    const char* name;
+    bool surfaces_unsupported;  ///< True if unsupported events are delivered to the caller
+    std::size_t (*drain)(std::vector<double>& latencies);
+};
+
+struct stress_scenario {
+    const char* name;
+    laya_bench::load_config config;
+};
+
+struct stress_result {
+    std::string consumer;
+    std::size_t events;
+    std::size_t queue_full_retries;
+    std::size_t dropped;
+    double wall_time_us;
+    double throughput;
+    laya_bench::statistics latency;
+};
+
+double latency_us(std::uint64_t timestamp_ns) {
+    return static_cast<double>(SDL_GetTicksNS() - timestamp_ns) / 1'000.0;
+}
+
+std::size_t drain_raw_sdl(std::vector<double>& latencies) {
+    std::size_t count = 0;
+    SDL_Event event;
+    while (SDL_PollEvent(&event)) {
+        latencies.push_back(latency_us(event.common.timestamp));
+        ++count;
+    }
+    return count;
+}
+
+std::size_t drain_event_view(std::vector<double>& latencies) {
+    std::size_t count = 0;
+    for (const auto& event : laya::events_view()) {
+        latencies.push_back(latency_us(std::visit([](const auto& e) { return e.timestamp; }, event)));
+        ++count;
+    }
+    return count;
+}
+
+std::size_t drain_event_range(std::vector<double>& latencies) {
+    const auto events = laya::events_range();
+    for (const auto& event : events) {
+        latencies.push_back(latency_us(std::visit([](const auto& e) { return e.timestamp; }, event)));
+    }
+    return events.size();
+}
+
+std::size_t drain_event_batch(std::vector<double>& latencies) {
+    static laya::event_batch batch;
+    batch.clear();
+    batch.poll();
+
+    const auto add_latencies = [&latencies](std::span<const std::uint64_t> timestamps) {
+        for (const auto timestamp : timestamps) {
+            latencies.push_back(latency_us(timestamp));
+        }
+    };
+    add_latencies(batch.keys().timestamp);
+    add_latencies(batch.mouse_motions().timestamp);
+    add_latencies(batch.mouse_buttons().timestamp);
+    add_latencies(batch.mouse_wheels().timestamp);
+    add_latencies(batch.windows().timestamp);
+    return batch.size();
+}
+
+constexpr stress_consumer consumers[] = {
+    {"raw SDL3", true, drain_raw_sdl},
+    {"laya::event_view", false, drain_event_view},
+    {"laya::event_range", false, drain_event_range},
+    {"laya::event_batch", false, drain_event_batch},
+};
+
+std::vector<stress_scenario> make_scenarios(std::uint32_t window_id) {
+    laya_bench::event_mix mixed{};
+    mixed.key = 2;
+    mixed.mouse_motion = 6;
+    mixed.mouse_wheel = 1;
+    mixed.window = 1;
+
+    laya_bench::event_mix with_unsupported = mixed;
+    with_unsupported.unsupported = 2;
+
+    std::vector<stress_scenario> scenarios;
+    scenarios.push_back({"burst, 1 producer", {50'000, 0.0, 1, mixed, window_id}});
+    scenarios.push_back({"burst, 4 producers", {50'000, 0.0, 4, mixed, window_id}});
+    scenarios.push_back({"burst, 4 producers, unsupported", {50'000, 0.0, 4, with_unsupported, window_id}});
+    scenarios.push_back({"paced 100K/s, 2 producers", {50'000, 100'000.0, 2, mixed, window_id}});
+    return scenarios;
+}
+
+stress_result run_scenario(const stress_consumer& consumer, const stress_scenario& scenario) {
+    laya::flush_events();
+
+    std::vector<double> latencies;
+    latencies.reserve(scenario.config.total_events);
+
+    laya_bench::event_load_generator generator{scenario.config};
+
+    const auto start = std::chrono::steady_clock::now();
+    generator.start();
+
+    std::size_t consumed = 0;
+    auto drained_at = start;
+    std::chrono::steady_clock::time_point producers_done_at{};
+    while (true) {
+        const std::size_t n = consumer.drain(latencies);
+        consumed += n;
+        if (n > 0) {
+            drained_at = std::chrono::steady_clock::now();
+        }
+
+        if (generator.done()) {
+            const std::size_t expected =
+                consumer.surfaces_unsupported ? generator.pushed() : generator.pushed_supported();
+            if (consumed >= expected) {
+                break;
+            }
+
+            // Guard against a consumer that silently loses events
+            const auto now = std::chrono::steady_clock::now();
+            if (producers_done_at == std::chrono::steady_clock::time_point{}) {
+                producers_done_at = now;
+            } else if (now - producers_done_at > drain_timeout) {
+                std::cout << "    Warning: " << consumer.name << " consumed " << consumed << " of " << expected
+                          << " events before timing out\n";
+                break;
+            }
+        }
+    }
+    generator.join();
+
+    const double wall_us = std::chrono::duration<double, std::micro>(drained_at - start).count();
+
+    stress_result result;
+    result.consumer = consumer.name;
+    result.events = consumed;
+    result.queue_full_retries = generator.queue_full_retries();
+    result.dropped = generator.dropped();
+    result.wall_time_us = wall_us;
+    result.throughput = laya_bench::calculate_throughput(consumed, wall_us);
+    result.latency = laya_bench::calculate_statistics(std::move(latencies));
+    return result;
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("event polling under synthetic load") {
+        laya_bench::print_header("Event Polling Stress (end-to-end throughput & queue latency)");
+
+        laya::context ctx(laya::subsystem::video);
+        laya::window window("Stress Benchmark Window", {800, 600});
+
+        const auto scenarios = make_scenarios(window.id().value());
+
+        for (const auto& scenario : scenarios) {
+            laya_bench::print_separator();
+            std::cout << "\n  Scenario: " << scenario.name << " (" << scenario.config.total_events << " events)\n";
+
+            // One group per scenario, so each consumer's results are told apart by the consumer name
+            laya_bench::report_group(std::format("Event Polling Stress: {}", scenario.name));
+
+            for (const auto& consumer : consumers) {
+                auto result = run_scenario(consumer, scenario);
+                std::cout << std::format(
+                    "    {:20} {:>12} events  {:>12}  p50 {:>10}  p99 {:>10}  retries {}  dropped {}\n",
+                    result.consumer, result.events, laya_bench::format_throughput(result.throughput),
+                    laya_bench::format_time_auto(result.latency.median),
+                    laya_bench::format_time_auto(result.latency.p99), result.queue_full_retries, result.dropped);
+                laya_bench::report_statistics(result.consumer + " latency", result.latency, 1);
+
+                // End to end is one sample of the whole run, its items over its mean is the throughput
+                laya_bench::report_statistics(result.consumer + " end to end",
+                                              laya_bench::calculate_statistics({result.wall_time_us}), result.events);
+                laya_bench::report_counter("queue_full_retries", static_cast<double>(result.queue_full_retries));
+                laya_bench::report_counter("dropped", static_cast<double>(result.dropped));
+                CHECK(result.events > 0);
+            }
+        }
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}  // TEST_SUITE("benchmark")
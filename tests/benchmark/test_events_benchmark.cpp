@@ -5,18 +5,15 @@
 #include <chrono>
 #include <iostream>
 #include <numeric>
-#include <vector>
 
 #include <doctest/doctest.h>
 #include <SDL3/SDL.h>
 #include <laya/laya.hpp>
 
-#include "bench_utils.hpp"
+#include "bench_harness.hpp"
 
 namespace {
 
-constexpr int runs_per_test = 10;
-constexpr int iterations = 500;
 constexpr int events_per_iteration = 100;
 
 // Global storage for benchmark results to enable summary printing
@@ -92,6 +89,26 @@ void flush_all_events() {
     }
 }
 
+/// Time polling `events_per_iteration` freshly pushed events, one batch per harness iteration
+/// @note Pushing the events and flushing the queue afterwards are not timed
+template <class Poll>
+laya_bench::benchmark_result measure_polling(const char* label, std::uint32_t window_id, Poll poll) {
+    return laya_bench::run_benchmark(label, [&](laya_bench::state& state) {
+        state.set_items_per_iteration(events_per_iteration);
+        for (auto _ : state) {
+            state.pause_timing();
+            generate_synthetic_events(events_per_iteration, window_id);
+            state.resume_timing();
+
+            poll();
+
+            state.pause_timing();
+            flush_all_events();  // Ensure clean slate
+            state.resume_timing();
+        }
+    });
+}
+
 }  // anonymous namespace
 
 TEST_SUITE("benchmark") {
@@ -99,15 +116,13 @@ TEST_SUITE("benchmark") {
         laya_bench::print_header("Event Polling Performance Comparison");
 
         std::cout << "\n  Configuration:\n";
-        std::cout << "    Runs per test:        " << runs_per_test << "\n";
-        std::cout << "    Iterations per run:   " << iterations << "\n";
-        std::cout << "    Events per iteration: " << events_per_iteration << "\n";
-        std::cout << "    Total events/run:     " << (iterations * events_per_iteration) << "\n";
+        laya_bench::print_configuration();
+        std::cout << "    Events/iteration:   " << events_per_iteration << "\n";
 
         // Storage for all benchmark results
-        laya_bench::statistics event_range_stats;
-        laya_bench::statistics event_view_stats;
-        laya_bench::statistics raw_sdl_stats;
+        laya_bench::benchmark_result event_range;
+        laya_bench::benchmark_result event_view;
+        laya_bench::benchmark_result raw_sdl;
 
         // Benchmark 1: laya::event_range
         {
@@ -117,41 +132,17 @@ TEST_SUITE("benchmark") {
             laya::context ctx(laya::subsystem::video);
             laya::window window("Benchmark Window", {800, 600});
 
-            std::vector<double> run_times;
-            run_times.reserve(runs_per_test);
-
-            for (int run = 0; run < runs_per_test; ++run) {
-                double total_time = 0.0;
-
-                for (int i = 0; i < iterations; ++i) {
-                    generate_synthetic_events(events_per_iteration, window.id().value());
-
-                    auto start = std::chrono::high_resolution_clock::now();
-
-                    // Poll events using event_range
-                    auto events = laya::events_range();
-
-                    // Process events (simulate real work)
-                    std::size_t count = 0;
-                    for (const auto& event : events) {
-                        ++count;
-                        // Touch the event data to prevent optimization
-                        std::visit([](const auto&) {}, event);
-                    }
+            event_range = measure_polling("laya::event_range", window.id().value(), [] {
+                // Poll events using event_range
+                auto events = laya::events_range();
 
-                    auto end = std::chrono::high_resolution_clock::now();
-                    auto duration = std::chrono::duration<double, std::micro>(end - start);
-                    total_time += duration.count();
-
-                    flush_all_events();  // Ensure clean slate
+                // Process events (simulate real work)
+                for (const auto& event : events) {
+                    // Touch the event data to prevent optimization
+                    std::visit([](const auto& e) { laya_bench::do_not_optimize(e); }, event);
                 }
-
-                double avg = total_time / iterations;
-                run_times.push_back(avg);
-            }
-
-            event_range_stats = laya_bench::calculate_statistics(run_times);
-            laya_bench::print_statistics("laya::event_range", event_range_stats, events_per_iteration);
+            });
+            laya_bench::print_result(event_range);
         }
 
         // Benchmark 2: laya::event_view
@@ -162,38 +153,14 @@ TEST_SUITE("benchmark") {
             laya::context ctx(laya::subsystem::video);
             laya::window window("Benchmark Window", {800, 600});
 
-            std::vector<double> run_times;
-            run_times.reserve(runs_per_test);
-
-            for (int run = 0; run < runs_per_test; ++run) {
-                double total_time = 0.0;
-
-                for (int i = 0; i < iterations; ++i) {
-                    generate_synthetic_events(events_per_iteration, window.id().value());
-
-                    auto start = std::chrono::high_resolution_clock::now();
-
-                    // Poll events using event_view (lazy, zero-allocation)
-                    std::size_t count = 0;
-                    for (const auto& event : laya::events_view()) {
-                        ++count;
-                        // Touch the event data to prevent optimization
-                        std::visit([](const auto&) {}, event);
-                    }
-
-                    auto end = std::chrono::high_resolution_clock::now();
-                    auto duration = std::chrono::duration<double, std::micro>(end - start);
-                    total_time += duration.count();
-
-                    flush_all_events();  // Ensure clean slate
+            event_view = measure_polling("laya::event_view", window.id().value(), [] {
+                // Poll events using event_view (lazy, zero-allocation)
+                for (const auto& event : laya::events_view()) {
+                    // Touch the event data to prevent optimization
+                    std::visit([](const auto& e) { laya_bench::do_not_optimize(e); }, event);
                 }
-
-                double avg = total_time / iterations;
-                run_times.push_back(avg);
-            }
-
-            event_view_stats = laya_bench::calculate_statistics(run_times);
-            laya_bench::print_statistics("laya::event_view", event_view_stats, events_per_iteration);
+            });
+            laya_bench::print_result(event_view);
         }
 
         // Benchmark 3: raw SDL3
@@ -205,40 +172,15 @@ TEST_SUITE("benchmark") {
             SDL_Window* window = SDL_CreateWindow("Benchmark Window", 800, 600, 0);
             std::uint32_t window_id = SDL_GetWindowID(window);
 
-            std::vector<double> run_times;
-            run_times.reserve(runs_per_test);
-
-            for (int run = 0; run < runs_per_test; ++run) {
-                double total_time = 0.0;
-
-                for (int i = 0; i < iterations; ++i) {
-                    generate_synthetic_events(events_per_iteration, window_id);
-
-                    auto start = std::chrono::high_resolution_clock::now();
-
-                    // Poll events using raw SDL
-                    SDL_Event event;
-                    std::size_t count = 0;
-                    while (SDL_PollEvent(&event)) {
-                        ++count;
-                        // Touch the event data to prevent optimization
-                        volatile auto timestamp = event.common.timestamp;
-                        (void)timestamp;
-                    }
-
-                    auto end = std::chrono::high_resolution_clock::now();
-                    auto duration = std::chrono::duration<double, std::micro>(end - start);
-                    total_time += duration.count();
-
-                    flush_all_events();  // Ensure clean slate
+            raw_sdl = measure_polling("raw SDL3", window_id, [] {
+                // Poll events using raw SDL
+                SDL_Event event;
+                while (SDL_PollEvent(&event)) {
+                    // Touch the event data to prevent optimization
+                    laya_bench::do_not_optimize(event.common.timestamp);
                 }
-
-                double avg = total_time / iterations;
-                run_times.push_back(avg);
-            }
-
-            raw_sdl_stats = laya_bench::calculate_statistics(run_times);
-            laya_bench::print_statistics("raw SDL3", raw_sdl_stats, events_per_iteration);
+            });
+            laya_bench::print_result(raw_sdl);
 
             SDL_DestroyWindow(window);
             SDL_Quit();
@@ -247,17 +189,17 @@ TEST_SUITE("benchmark") {
         // Comparative analysis
         laya_bench::print_separator();
         std::cout << "\n  Performance Comparisons:\n";
-        laya_bench::print_comparison("raw SDL3", raw_sdl_stats, "laya::event_range", event_range_stats);
-        laya_bench::print_comparison("raw SDL3", raw_sdl_stats, "laya::event_view", event_view_stats);
-        laya_bench::print_comparison("laya::event_range", event_range_stats, "laya::event_view", event_view_stats);
+        laya_bench::print_comparison(raw_sdl, event_range);
+        laya_bench::print_comparison(raw_sdl, event_view);
+        laya_bench::print_comparison(event_range, event_view);
 
         laya_bench::print_separator();
         std::cout << "\n";
 
         // Store results for summary printing
-        g_event_benchmark_results.event_range_stats = event_range_stats;
-        g_event_benchmark_results.event_view_stats = event_view_stats;
-        g_event_benchmark_results.raw_sdl_stats = raw_sdl_stats;
+        g_event_benchmark_results.event_range_stats = event_range.stats;
+        g_event_benchmark_results.event_view_stats = event_view.stats;
+        g_event_benchmark_results.raw_sdl_stats = raw_sdl.stats;
         g_event_benchmark_results.populated = true;
     }
 
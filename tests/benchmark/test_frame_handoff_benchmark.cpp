@@ -0,0 +1,146 @@
+/// @file test_frame_handoff_benchmark.cpp
+/// @brief Benchmark tests for recording frames on a simulation thread while the main thread presents
+/// @date 2026-10-17
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr int runs_per_test = 5;
+constexpr int frames_per_run = 60;
+constexpr int sprites_per_frame = 2000;
+constexpr auto simulation_cost = std::chrono::milliseconds{6};
+
+/// Stand-in for physics and game logic: keep the thread busy for `simulation_cost`
+void simulate(std::vector<laya::rect>& sprites, int frame) {
+    const auto end = std::chrono::steady_clock::now() + simulation_cost;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+    for (std::size_t i = 0; i < sprites.size(); ++i) {
+        sprites[i].x = static_cast<int>((i * 7 + static_cast<std::size_t>(frame) * 3) % 1900);
+        sprites[i].y = static_cast<int>((i * 13 + static_cast<std::size_t>(frame) * 2) % 1060);
+    }
+}
+
+/// Record one frame, through either laya::renderer or laya::command_list
+template <class Target>
+void draw_frame(Target& target, const std::vector<laya::rect>& sprites) {
+    target.set_draw_color(laya::colors::black);
+    target.clear();
+    target.set_draw_color(laya::color{200, 120, 40});
+    for (const auto& sprite : sprites) {
+        target.fill_rect(sprite);
+    }
+}
+
+std::vector<laya::rect> make_sprites() {
+    return std::vector<laya::rect>(sprites_per_frame, laya::rect{0, 0, 16, 16});
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("frame handoff with vsync") {
+        laya::context ctx(laya::subsystem::video);
+        laya::window window("Frame Handoff Benchmark Window", {1920, 1080});
+        laya::renderer renderer(window, laya::renderer_args{.vsync = laya::vsync_mode::enabled});
+
+        laya_bench::print_header("Decoupled Render Thread (vsync on)");
+
+        std::cout << "\n  Configuration:\n";
+        std::cout << "    Runs per test:      " << runs_per_test << "\n";
+        std::cout << "    Frames per run:     " << frames_per_run << "\n";
+        std::cout << "    Sprites per frame:  " << sprites_per_frame << "\n";
+        std::cout << "    Simulation cost:    " << simulation_cost.count() << "ms per frame\n";
+
+        laya_bench::print_separator();
+
+        // Simulate, draw and present on one thread, so the simulation stalls on every vsync
+        std::cout << "\n  Running: single thread...\n";
+        std::vector<double> single_times;
+        {
+            auto sprites = make_sprites();
+            for (int run = 0; run < runs_per_test; ++run) {
+                auto start = std::chrono::high_resolution_clock::now();
+                for (int frame = 0; frame < frames_per_run; ++frame) {
+                    simulate(sprites, frame);
+                    draw_frame(renderer, sprites);
+                    renderer.present();
+                }
+                auto end = std::chrono::high_resolution_clock::now();
+                single_times.push_back(std::chrono::duration<double, std::micro>(end - start).count() /
+                                       frames_per_run);
+            }
+        }
+        auto single_stats = laya_bench::calculate_statistics(single_times);
+        laya_bench::print_statistics("single thread (per frame)", single_stats, 1);
+
+        // Simulate and record frame N+1 on a worker while the main thread replays and presents frame N
+        std::cout << "\n  Running: frame_handoff...\n";
+        std::vector<double> handoff_times;
+        std::size_t steady_allocations = 0;
+        std::size_t steady_frames = 0;
+        laya::frame_handoff handoff;
+        for (int run = 0; run < runs_per_test; ++run) {
+            std::thread simulation{[&handoff] {
+                auto sprites = make_sprites();
+                for (int frame = 0; frame < frames_per_run; ++frame) {
+                    simulate(sprites, frame);
+                    draw_frame(handoff.recording(), sprites);
+                    handoff.submit();
+                }
+            }};
+
+            auto start = std::chrono::high_resolution_clock::now();
+            std::size_t allocations_at_warm = 0;
+            for (int frame = 0; frame < frames_per_run; ++frame) {
+                const bool presented = handoff.render(renderer, std::chrono::seconds{5});
+                CHECK(presented);
+                if (!presented) {
+                    handoff.close();
+                    break;
+                }
+                // From here on both lists have already held a full frame
+                if (frame == 1) {
+                    allocations_at_warm = laya_bench::allocation_count();
+                }
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            if (run > 0) {
+                steady_allocations += laya_bench::allocation_count() - allocations_at_warm;
+                steady_frames += frames_per_run - 2;
+            }
+            simulation.join();
+
+            handoff_times.push_back(std::chrono::duration<double, std::micro>(end - start).count() / frames_per_run);
+        }
+        auto handoff_stats = laya_bench::calculate_statistics(handoff_times);
+        laya_bench::print_statistics("frame_handoff (per frame)", handoff_stats, 1);
+
+        const auto counters = handoff.stats();
+        std::cout << "    Simulation blocked in submit(): "
+                  << std::chrono::duration<double, std::milli>(counters.submit_wait).count() << "ms total\n";
+        std::cout << "    Render thread waiting for frames: "
+                  << std::chrono::duration<double, std::milli>(counters.render_wait).count() << "ms total\n";
+        std::cout << "    operator new calls per steady-state frame: "
+                  << static_cast<double>(steady_allocations) / static_cast<double>(steady_frames) << "\n";
+        CHECK(steady_allocations == 0);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison("single thread", single_stats, "frame_handoff", handoff_stats);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
@@ -0,0 +1,104 @@
+/// @file test_input_benchmark.cpp
+/// @brief Benchmark tests for per-frame input queries
+/// @date 2026-10-17
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+#include <doctest/doctest.h>
+#include <SDL3/SDL.h>
+#include <laya/laya.hpp>
+
+#include "bench_harness.hpp"
+
+namespace {
+
+constexpr std::size_t checks_per_frame = 100;
+
+/// Keycodes a typical game polls every frame (letters, digits, punctuation, function keys)
+std::array<laya::keycode, checks_per_frame> frame_keycodes() {
+    constexpr std::array pool{
+        laya::keycode::w,       laya::keycode::a,      laya::keycode::s,         laya::keycode::d,
+        laya::keycode::space,   laya::keycode::escape, laya::keycode::tab,       laya::keycode::return_,
+        laya::keycode::q,       laya::keycode::e,      laya::keycode::r,         laya::keycode::f,
+        laya::keycode::num_1,   laya::keycode::num_2,  laya::keycode::num_3,     laya::keycode::num_4,
+        laya::keycode::f1,      laya::keycode::f2,     laya::keycode::f5,        laya::keycode::f12,
+        laya::keycode::comma,   laya::keycode::period, laya::keycode::slash,     laya::keycode::backquote,
+        laya::keycode::minus,   laya::keycode::equals, laya::keycode::caps_lock, laya::keycode::m,
+    };
+
+    std::array<laya::keycode, checks_per_frame> keys{};
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = pool[i % pool.size()];
+    }
+    return keys;
+}
+
+/// Time frames of `checks_per_frame` keycode checks, one frame per harness iteration
+template <class Check>
+laya_bench::benchmark_result measure_frames(const char* label, const std::array<laya::keycode, checks_per_frame>& keys,
+                                            Check check) {
+    int held = 0;
+    auto result = laya_bench::run_benchmark(label, [&](laya_bench::state& state) {
+        state.set_items_per_iteration(checks_per_frame);
+        for (auto _ : state) {
+            for (const auto key : keys) {
+                held += check(key) ? 1 : 0;
+            }
+        }
+    });
+
+    // Keep the results observable so the checks are not optimized away
+    CHECK(held >= 0);
+    return result;
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("keycode queries per frame") {
+        laya::context ctx(laya::subsystem::video);
+
+        const auto keys = frame_keycodes();
+
+        laya_bench::print_header("Keycode Queries (" + std::to_string(checks_per_frame) + " per frame)");
+
+        std::cout << "\n  Configuration:\n";
+        laya_bench::print_configuration({}, "frames");
+        std::cout << "    Checks per frame:   " << checks_per_frame << "\n";
+
+        laya_bench::print_separator();
+
+        std::cout << "\n  Running: raw SDL3 (SDL_GetScancodeFromKey per check)...\n";
+        auto raw_sdl = measure_frames("raw SDL3", keys, [](laya::keycode key) {
+            int num_keys = 0;
+            const bool* state = SDL_GetKeyboardState(&num_keys);
+            const auto scan = SDL_GetScancodeFromKey(static_cast<SDL_Keycode>(key), nullptr);
+            return static_cast<int>(scan) < num_keys && state[scan];
+        });
+        laya_bench::print_result(raw_sdl);
+
+        std::cout << "\n  Running: laya::is_key_pressed(keycode)...\n";
+        auto cached = measure_frames("laya::is_key_pressed(keycode)", keys,
+                                     [](laya::keycode key) { return laya::is_key_pressed(key); });
+        laya_bench::print_result(cached);
+
+        std::cout << "\n  Running: keyboard_snapshot + keycode_to_scancode...\n";
+        laya::keyboard_snapshot snapshot;
+        snapshot.update();
+        auto snapshot_result = measure_frames("keyboard_snapshot", keys, [&snapshot](laya::keycode key) {
+            return snapshot.held(laya::keycode_to_scancode(key));
+        });
+        laya_bench::print_result(snapshot_result);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison(raw_sdl, cached);
+        laya_bench::print_comparison(raw_sdl, snapshot_result);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
@@ -0,0 +1,110 @@
+/// @file test_job_system_benchmark.cpp
+/// @brief Benchmark tests for the work-stealing job system
+/// @date 2026-10-17
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_harness.hpp"
+
+namespace {
+
+constexpr int image_width = 1920;
+constexpr int image_height = 1080;
+constexpr int small_jobs = 10'000;
+
+/// Per-pixel work of a typical surface conversion: swizzle RGBA to BGRA and apply a brightness curve
+void convert_rows(std::vector<std::uint32_t>& pixels, int row_begin, int row_end) {
+    for (int y = row_begin; y < row_end; ++y) {
+        std::uint32_t* row = pixels.data() + static_cast<std::size_t>(y) * image_width;
+        for (int x = 0; x < image_width; ++x) {
+            const std::uint32_t p = row[x];
+            const std::uint32_t r = (p >> 24) & 0xFF;
+            const std::uint32_t g = (p >> 16) & 0xFF;
+            const std::uint32_t b = (p >> 8) & 0xFF;
+            const std::uint32_t a = p & 0xFF;
+            row[x] = ((b * b / 255) << 24) | ((g * g / 255) << 16) | ((r * r / 255) << 8) | a;
+        }
+    }
+}
+
+/// Time an operation, one run per harness iteration
+template <class Operation>
+laya_bench::benchmark_result measure_runs(const char* label, std::size_t items, Operation operation) {
+    return laya_bench::run_benchmark(label, [&](laya_bench::state& state) {
+        state.set_items_per_iteration(items);
+        for (auto _ : state) {
+            operation();
+        }
+    });
+}
+
+void print_counters(const laya::job_system& jobs) {
+    const auto stats = jobs.stats();
+    std::cout << "    Jobs executed: " << stats.jobs_executed << ", steals: " << stats.steals
+              << ", worker idle: " << std::chrono::duration<double, std::milli>(stats.idle_time).count() << "ms\n";
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("job_system parallel_for and job throughput") {
+        laya::job_system jobs;
+        std::vector<std::uint32_t> pixels(static_cast<std::size_t>(image_width) * image_height, 0x336699FFu);
+        const std::size_t pixel_count = pixels.size();
+
+        laya_bench::print_header("Job System");
+
+        std::cout << "\n  Configuration:\n";
+        laya_bench::print_configuration({}, "runs");
+        std::cout << "    Worker threads:     " << jobs.thread_count() << "\n";
+        std::cout << "    Image size:         " << image_width << "x" << image_height << "\n";
+        std::cout << "    Small jobs per run: " << small_jobs << "\n";
+
+        laya_bench::print_separator();
+
+        std::cout << "\n  Running: pixel conversion, single thread...\n";
+        auto serial = measure_runs("serial", pixel_count, [&] { convert_rows(pixels, 0, image_height); });
+        laya_bench::print_result(serial);
+
+        std::cout << "\n  Running: pixel conversion, parallel_for over rows...\n";
+        jobs.reset_stats();
+        auto parallel = measure_runs("parallel_for", pixel_count, [&] {
+            jobs.parallel_for(0, image_height,
+                              [&pixels](int row_begin, int row_end) { convert_rows(pixels, row_begin, row_end); });
+        });
+        laya_bench::print_result(parallel);
+        print_counters(jobs);
+
+        std::cout << "\n  Running: " << small_jobs << " independent jobs, then wait...\n";
+        jobs.reset_stats();
+        std::vector<laya::job_handle> handles;
+        handles.reserve(small_jobs);
+        auto submit = measure_runs("submit + wait", small_jobs, [&] {
+            handles.clear();
+            std::atomic<std::uint64_t> sum{0};
+            for (int i = 0; i < small_jobs; ++i) {
+                handles.push_back(jobs.submit([&sum, i] { sum.fetch_add(static_cast<std::uint64_t>(i)); }));
+            }
+            for (const auto& handle : handles) {
+                jobs.wait(handle);
+            }
+            CHECK(sum.load() > 0);
+        });
+        laya_bench::print_result(submit);
+        print_counters(jobs);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison(serial, parallel);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
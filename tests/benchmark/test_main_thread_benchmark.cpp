@@ -0,0 +1,144 @@
+/// @file test_main_thread_benchmark.cpp
+/// @brief Benchmark tests for handing tasks from worker threads to the main thread
+/// @date 2026-10-17
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr int runs_per_test = 10;
+constexpr int producers = 4;
+constexpr int tasks_per_producer = 25'000;
+constexpr int batch_size = 64;
+
+/// The usual alternative: one lock per push and per popped item
+class mutex_queue {
+public:
+    void push(std::function<void()> task) {
+        std::lock_guard lock{m_mutex};
+        m_tasks.push_back(std::move(task));
+    }
+
+    std::size_t drain() {
+        std::size_t ran = 0;
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_tasks.empty()) {
+                    return ran;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+            ++ran;
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::deque<std::function<void()>> m_tasks;
+};
+
+/// Push each task on its own
+template <class Queue>
+void push_each(Queue& queue, std::size_t& sum) {
+    for (int i = 0; i < tasks_per_producer; ++i) {
+        queue.push([&sum, i] { sum += static_cast<std::size_t>(i); });
+    }
+}
+
+/// Gather tasks locally and hand them over `batch_size` at a time
+void push_batched(laya::main_thread_queue& queue, std::size_t& sum) {
+    laya::main_thread_batch batch;
+    for (int i = 0; i < tasks_per_producer; ++i) {
+        batch.add([&sum, i] { sum += static_cast<std::size_t>(i); });
+        if (batch.size() == batch_size) {
+            queue.push(std::move(batch));
+        }
+    }
+    queue.push(std::move(batch));
+}
+
+/// Push from `producers` threads while the calling thread drains, as a loader and a frame loop would
+/// @return Per-run time until every task has run, in microseconds
+template <class Queue, class Producer>
+std::vector<double> measure_handoff(Producer produce) {
+    std::vector<double> run_times;
+    run_times.reserve(runs_per_test);
+
+    for (int run = 0; run < runs_per_test; ++run) {
+        Queue queue;
+        std::size_t sum = 0;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, &sum, produce] { produce(queue, sum); });
+        }
+
+        std::size_t ran = 0;
+        while (ran < static_cast<std::size_t>(producers * tasks_per_producer)) {
+            ran += queue.drain();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        for (auto& t : threads) {
+            t.join();
+        }
+        CHECK(sum > 0);
+        run_times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return run_times;
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("main-thread task handoff") {
+        laya_bench::print_header("Main-Thread Task Handoff");
+
+        std::cout << "\n  Configuration:\n";
+        std::cout << "    Runs per test:      " << runs_per_test << "\n";
+        std::cout << "    Producer threads:   " << producers << "\n";
+        std::cout << "    Tasks per producer: " << tasks_per_producer << "\n";
+        std::cout << "    Batch size:         " << batch_size << "\n";
+
+        laya_bench::print_separator();
+
+        constexpr std::size_t total_tasks = producers * tasks_per_producer;
+
+        std::cout << "\n  Running: std::mutex + std::deque<std::function>...\n";
+        auto mutex_stats = laya_bench::calculate_statistics(measure_handoff<mutex_queue>(push_each<mutex_queue>));
+        laya_bench::print_statistics("mutex queue", mutex_stats, total_tasks);
+
+        std::cout << "\n  Running: laya::main_thread_queue...\n";
+        auto queue_stats = laya_bench::calculate_statistics(
+            measure_handoff<laya::main_thread_queue>(push_each<laya::main_thread_queue>));
+        laya_bench::print_statistics("main_thread_queue", queue_stats, total_tasks);
+
+        std::cout << "\n  Running: laya::main_thread_queue with main_thread_batch...\n";
+        auto batch_stats = laya_bench::calculate_statistics(measure_handoff<laya::main_thread_queue>(push_batched));
+        laya_bench::print_statistics("main_thread_batch", batch_stats, total_tasks);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison("mutex queue", mutex_stats, "main_thread_queue", queue_stats);
+        laya_bench::print_comparison("mutex queue", mutex_stats, "main_thread_batch", batch_stats);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
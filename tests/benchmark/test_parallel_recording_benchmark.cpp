@@ -0,0 +1,141 @@
+/// @file test_parallel_recording_benchmark.cpp
+/// @brief Benchmark tests for recording command lists on several threads and merging them in order
+/// @date 2026-10-17
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_harness.hpp"
+
+namespace {
+
+constexpr int runs_per_test = 10;
+constexpr int total_primitives = 200'000;
+constexpr int regions = 64;
+constexpr int primitives_per_region = total_primitives / regions;
+
+/// Draw one UI region: a panel color, then a grid of filled cells with outlines
+void record_region(laya::command_list& list, int region) {
+    const int origin_x = (region % 8) * 240;
+    const int origin_y = (region / 8) * 135;
+    list.set_draw_color(laya::color{static_cast<std::uint8_t>(region * 4), 80, 160});
+    for (int i = 0; i < primitives_per_region; ++i) {
+        const laya::rect cell{origin_x + (i % 48) * 5, origin_y + (i / 48) % 27 * 5, 4, 4};
+        if (i % 4 == 0) {
+            list.draw_rect(cell);
+        } else {
+            list.fill_rect(cell);
+        }
+    }
+}
+
+/// Time recording every region on `threads` threads and merging the result into one list
+/// @param merged Receives the list merged in the last run
+/// @return Per-run time in microseconds
+std::vector<double> measure_recording(std::size_t threads, laya::command_list& merged) {
+    std::vector<double> run_times;
+    run_times.reserve(runs_per_test);
+
+    laya::command_list_group group{regions};
+    std::unique_ptr<laya::job_system> jobs;
+    if (threads > 1) {
+        // The calling thread records too, so it needs one worker less
+        jobs = std::make_unique<laya::job_system>(laya::job_system_args{threads - 1});
+    }
+
+    // One untimed frame so every list has its storage
+    for (int run = -1; run < runs_per_test; ++run) {
+        group.reset();
+        merged.reset();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        if (jobs) {
+            jobs->parallel_for(0, regions, [&group](int begin, int end) {
+                for (int region = begin; region < end; ++region) {
+                    record_region(group[static_cast<std::size_t>(region)], region);
+                }
+            }, 1);
+        } else {
+            for (int region = 0; region < regions; ++region) {
+                record_region(group[static_cast<std::size_t>(region)], region);
+            }
+        }
+        group.merge_into(merged);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        if (run >= 0) {
+            run_times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+    }
+    return run_times;
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("parallel command recording with ordered merge") {
+        const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+        laya_bench::print_header("Parallel Command Recording");
+
+        std::cout << "\n  Configuration:\n";
+        std::cout << "    Runs per test:      " << runs_per_test << "\n";
+        std::cout << "    Primitives:         " << total_primitives << "\n";
+        std::cout << "    Regions:            " << regions << "\n";
+        std::cout << "    Hardware threads:   " << max_threads << "\n";
+
+        laya_bench::print_separator();
+
+        laya::command_list baseline_list;
+        std::cout << "\n  Running: 1 thread...\n";
+        auto baseline = laya_bench::calculate_statistics(measure_recording(1, baseline_list));
+        laya_bench::print_statistics("1 thread", baseline, total_primitives);
+        std::cout << "    Merged commands: " << baseline_list.size() << "\n";
+
+        // Double the thread count, ending on every hardware thread even when that is not a power of two
+        const std::size_t last_threads = std::max<std::size_t>(max_threads, 2);
+        for (std::size_t threads = 2;; threads = std::min(threads * 2, last_threads)) {
+            const std::string label = std::to_string(threads) + " threads";
+            laya::command_list merged;
+
+            std::cout << "\n  Running: " << label << "...\n";
+            auto stats = laya_bench::calculate_statistics(measure_recording(threads, merged));
+            laya_bench::print_statistics(label, stats, total_primitives);
+            laya_bench::print_comparison("1 thread", baseline, label, stats);
+
+            // The merge order depends only on the keys, so every thread count builds the same list
+            CHECK(merged == baseline_list);
+
+            if (threads == last_threads) {
+                break;
+            }
+        }
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
+
+LAYA_BENCHMARK("command_list recording (1,000 fill_rect)") {
+    constexpr int rects = 1000;
+    laya::command_list list;
+    list.reserve(1, rects);
+    state.set_items_per_iteration(rects);
+    for (auto _ : state) {
+        list.reset();
+        for (int i = 0; i < rects; ++i) {
+            list.fill_rect({i % 1920, (i * 7) % 1080, 16, 16});
+        }
+        laya_bench::clobber_memory();
+    }
+    laya_bench::do_not_optimize(list);
+}
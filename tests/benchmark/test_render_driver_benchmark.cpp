@@ -0,0 +1,186 @@
+/// @file test_render_driver_benchmark.cpp
+/// @brief Benchmark matrix of drawing workloads against every available render driver
+/// @date 2026-10-17
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr int runs_per_test = 10;
+constexpr int iterations = 50;
+constexpr int primitives_per_iteration = 1000;
+
+/// One row of the matrix: draws `primitives_per_iteration` primitives on a cleared target
+struct workload {
+    const char* name;
+    std::function<void(laya::renderer&)> draw;
+};
+
+std::vector<workload> make_workloads() {
+    return {
+        {"draw_point()",
+         [](laya::renderer& r) {
+             for (int p = 0; p < primitives_per_iteration; ++p) {
+                 r.draw_point({p % 1920, (p * 7) % 1080});
+             }
+         }},
+        {"draw_line()",
+         [](laya::renderer& r) {
+             for (int l = 0; l < primitives_per_iteration; ++l) {
+                 r.draw_line({l % 1920, (l * 7) % 1080}, {(l + 100) % 1920, (l * 13) % 1080});
+             }
+         }},
+        {"draw_rect()",
+         [](laya::renderer& r) {
+             for (int i = 0; i < primitives_per_iteration; ++i) {
+                 r.draw_rect({i % 1920, (i * 7) % 1080, 50, 50});
+             }
+         }},
+        {"fill_rect()",
+         [](laya::renderer& r) {
+             for (int i = 0; i < primitives_per_iteration; ++i) {
+                 r.fill_rect({i % 1920, (i * 7) % 1080, 50, 50});
+             }
+         }},
+    };
+}
+
+/// Time one workload per iteration, including the flush that makes the driver execute the batch
+laya_bench::statistics measure(laya::renderer& renderer, const workload& work) {
+    std::vector<double> run_times;
+    run_times.reserve(runs_per_test);
+
+    for (int run = 0; run < runs_per_test; ++run) {
+        double total_time = 0.0;
+
+        for (int i = 0; i < iterations; ++i) {
+            renderer.clear();
+            renderer.flush();
+
+            auto start = std::chrono::high_resolution_clock::now();
+            work.draw(renderer);
+            renderer.flush();
+            auto end = std::chrono::high_resolution_clock::now();
+
+            total_time += std::chrono::duration<double, std::micro>(end - start).count();
+        }
+
+        run_times.push_back(total_time / iterations);
+    }
+
+    return laya_bench::calculate_statistics(run_times);
+}
+
+/// Mean time per iteration of every workload on one driver, empty if the driver is unusable here
+struct driver_results {
+    std::string driver;
+    std::vector<double> means;
+};
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("render driver matrix") {
+        // Single context/window for every driver to avoid SDL3 reinitialization issues on Linux
+        laya::context ctx(laya::subsystem::video);
+        laya::window window("Render Driver Benchmark Window", {1920, 1080});
+
+        const auto drivers = laya::available_render_drivers();
+        const auto workloads = make_workloads();
+
+        laya_bench::print_header("Render Driver Matrix");
+
+        std::cout << "\n  Configuration:\n";
+        std::cout << "    Runs per test:      " << runs_per_test << "\n";
+        std::cout << "    Iterations per run: " << iterations << "\n";
+        std::cout << "    Primitives/iter:    " << primitives_per_iteration << "\n";
+        std::cout << "    Drivers:           ";
+        for (const auto& driver : drivers) {
+            std::cout << " " << driver;
+        }
+        std::cout << "\n";
+
+        std::vector<driver_results> matrix;
+
+        for (const auto& driver : drivers) {
+            laya_bench::print_separator();
+            std::cout << "\n  Driver: " << driver << "\n";
+
+            driver_results row{driver, {}};
+            {
+                auto created = laya::renderer::try_create(
+                    window, laya::renderer_args{.vsync = laya::vsync_mode::disabled, .driver = driver});
+                if (!created) {
+                    std::cout << "    Skipped: " << created.error().message() << "\n";
+                    matrix.push_back(std::move(row));
+                    continue;
+                }
+                laya_bench::report_group(std::format("Render Driver Matrix: {}", driver),
+                                         std::string{created->driver_name()});
+
+                for (const auto& work : workloads) {
+                    auto stats = measure(*created, work);
+                    laya_bench::print_statistics(work.name, stats, primitives_per_iteration);
+                    row.means.push_back(stats.mean);
+                }
+            }
+            matrix.push_back(std::move(row));
+
+            // Line drawing cost depends on how the driver is told to draw lines
+            std::vector<std::pair<std::string, laya_bench::statistics>> line_methods;
+            for (auto [method, method_name] : {std::pair{laya::line_method::lines, "lines"},
+                                               std::pair{laya::line_method::points, "points"},
+                                               std::pair{laya::line_method::geometry, "geometry"}}) {
+                auto created = laya::renderer::try_create(
+                    window,
+                    laya::renderer_args{.vsync = laya::vsync_mode::disabled, .driver = driver, .lines = method});
+                if (!created) {
+                    continue;
+                }
+                const auto label = std::format("draw_line() as {}", method_name);
+                auto stats = measure(*created, workloads[1]);
+                laya_bench::print_statistics(label, stats, primitives_per_iteration);
+                line_methods.emplace_back(label, stats);
+            }
+            for (std::size_t i = 1; i < line_methods.size(); ++i) {
+                laya_bench::print_comparison(line_methods[0].first, line_methods[0].second, line_methods[i].first,
+                                             line_methods[i].second);
+            }
+        }
+
+        // Summary: mean time per iteration, one column per driver
+        laya_bench::print_separator();
+        std::cout << "\n  Mean time per iteration:\n";
+        std::cout << std::format("    {:<16}", "");
+        for (const auto& row : matrix) {
+            std::cout << std::format("{:>14}", row.driver);
+        }
+        std::cout << "\n";
+        for (std::size_t w = 0; w < workloads.size(); ++w) {
+            std::cout << std::format("    {:<16}", workloads[w].name);
+            for (const auto& row : matrix) {
+                std::cout << (row.means.empty() ? std::format("{:>14}", "n/a")
+                                                : std::format("{:>14}", laya_bench::format_time_auto(row.means[w])));
+            }
+            std::cout << "\n";
+        }
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+
+        // The software renderer is always built in, so at least one column has numbers
+        CHECK(std::any_of(matrix.begin(), matrix.end(), [](const driver_results& row) { return !row.means.empty(); }));
+    }
+}
@@ -0,0 +1,123 @@
+/// @file test_result_benchmark.cpp
+/// @brief Benchmark tests for the success path of the throwing and result-based APIs
+/// @date 2026-10-17
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+#include "bench_harness.hpp"
+
+namespace {
+
+constexpr laya::dimensions texture_size{64, 64};
+
+/// Time successful calls of an operation, one call per harness iteration
+template <class Operation>
+laya_bench::benchmark_result measure_calls(std::string label, Operation operation) {
+    return laya_bench::run_benchmark(std::move(label), [&operation](laya_bench::state& state) {
+        int i = 0;
+        for (auto _ : state) {
+            operation(i++);
+        }
+    });
+}
+
+/// Run the raw SDL, throwing and result-based variants of one operation and compare them
+/// @note Labels start with the operation so each result has its own name in the report
+template <class Raw, class Throwing, class Result>
+void compare_variants(const char* name, Raw raw, Throwing throwing, Result result) {
+    std::cout << "\n  Running: " << name << "...\n";
+
+    auto raw_result = measure_calls(std::format("{}: raw SDL3", name), raw);
+    laya_bench::print_result(raw_result);
+
+    auto throwing_result = measure_calls(std::format("{}: throwing", name), throwing);
+    laya_bench::print_result(throwing_result);
+
+    auto result_result = measure_calls(std::format("{}: laya::result", name), result);
+    laya_bench::print_result(result_result);
+
+    std::cout << "\n";
+    laya_bench::print_comparison(raw_result, throwing_result);
+    laya_bench::print_comparison(throwing_result, result_result);
+    laya_bench::print_separator();
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("result-based API success path") {
+        laya::context ctx(laya::subsystem::video);
+        laya::window window("Result Benchmark Window", {640, 480});
+        laya::renderer renderer(window);
+        laya::texture texture(renderer, laya::pixel_format::rgba32, texture_size, laya::texture_access::streaming);
+        laya::surface surface({256, 256});
+
+        std::vector<std::uint32_t> pixels(static_cast<std::size_t>(texture_size.width * texture_size.height),
+                                          0xFF336699u);
+        const int pitch = texture_size.width * static_cast<int>(sizeof(std::uint32_t));
+        const laya::rect small_rect{8, 8, 16, 16};
+        const SDL_FRect sdl_small_rect{8.0f, 8.0f, 16.0f, 16.0f};
+
+        laya_bench::print_header("Throwing vs Result-Based API (success path)");
+
+        std::cout << "\n  Configuration:\n";
+        laya_bench::print_configuration();
+
+        laya_bench::print_separator();
+
+        compare_variants(
+            "set_draw_color()",
+            [&](int i) { SDL_SetRenderDrawColor(renderer.native_handle(), static_cast<std::uint8_t>(i), 0, 0, 255); },
+            [&](int i) { renderer.set_draw_color(laya::color{static_cast<std::uint8_t>(i), 0, 0}); },
+            [&](int i) {
+                if (!renderer.try_set_draw_color(laya::color{static_cast<std::uint8_t>(i), 0, 0})) {
+                    FAIL("try_set_draw_color failed");
+                }
+            });
+
+        compare_variants(
+            "fill_rect()", [&](int) { SDL_RenderFillRect(renderer.native_handle(), &sdl_small_rect); },
+            [&](int) { renderer.fill_rect(small_rect); },
+            [&](int) {
+                if (!renderer.try_fill_rect(small_rect)) {
+                    FAIL("try_fill_rect failed");
+                }
+            });
+
+        compare_variants(
+            "texture update() (64x64 streaming)",
+            [&](int) { SDL_UpdateTexture(texture.native_handle(), nullptr, pixels.data(), pitch); },
+            [&](int) { texture.update(pixels.data(), pitch); },
+            [&](int) {
+                if (!texture.try_update(pixels.data(), pitch)) {
+                    FAIL("try_update failed");
+                }
+            });
+
+        compare_variants(
+            "surface fill_rect()",
+            [&](int) {
+                const SDL_Rect r{small_rect.x, small_rect.y, small_rect.w, small_rect.h};
+                SDL_FillSurfaceRect(surface.native_handle(), &r, 0xFFFFFFFFu);
+            },
+            [&](int) { surface.fill_rect(small_rect, laya::colors::white); },
+            [&](int) {
+                if (!surface.try_fill_rect(small_rect, laya::colors::white)) {
+                    FAIL("try_fill_rect failed");
+                }
+            });
+
+        std::cout << "\n";
+    }
+}
@@ -0,0 +1,75 @@
+/// @file test_startup_benchmark.cpp
+/// @brief Benchmark tests for cold start with subsystems initialized up front or on first use
+/// @date 2026-10-17
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_utils.hpp"
+
+namespace {
+
+constexpr int runs_per_test = 5;
+
+/// Time creating a context and the first window, the part of startup a game waits on
+std::vector<double> measure_startup(const laya::context_args& args) {
+    std::vector<double> run_times;
+    run_times.reserve(runs_per_test);
+
+    for (int run = 0; run < runs_per_test; ++run) {
+        auto start = std::chrono::high_resolution_clock::now();
+        {
+            laya::context ctx(args);
+            laya::window window("Startup Benchmark Window", {640, 480});
+            auto end = std::chrono::high_resolution_clock::now();
+            run_times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+    }
+    return run_times;
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("startup with lazy subsystem initialization") {
+        laya_bench::print_header("Startup: Eager vs On-First-Use Subsystems");
+
+        std::cout << "\n  Configuration:\n";
+        std::cout << "    Runs per test:      " << runs_per_test << "\n";
+        std::cout << "    Measured:           context creation and the first window\n";
+
+        laya_bench::print_separator();
+
+        // Everything up front, as laya::context(laya::subsystem::everything) does
+        std::cout << "\n  Running: everything up front...\n";
+        auto eager_stats = laya_bench::calculate_statistics(
+            measure_startup(laya::context_args{.init = laya::subsystem::everything}));
+        laya_bench::print_statistics("everything up front", eager_stats, 1);
+
+        // Startup timing report, only the first initialization of each subsystem is kept
+        std::cout << "\n  SDL_InitSubSystem time per subsystem (first initialization):\n";
+        for (const auto& timing : laya::subsystem_timings()) {
+            std::cout << "    " << laya::subsystem_name(timing.system) << ": "
+                      << laya_bench::format_time_auto(
+                             std::chrono::duration<double, std::micro>(timing.duration).count())
+                      << "\n";
+        }
+
+        // Only events up front, video waits for the window and the rest is never used
+        std::cout << "\n  Running: on first use...\n";
+        auto lazy_stats = laya_bench::calculate_statistics(measure_startup(
+            laya::context_args{.init = laya::subsystem::events, .on_first_use = laya::subsystem::everything}));
+        laya_bench::print_statistics("on first use", lazy_stats, 1);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison("everything up front", eager_stats, "on first use", lazy_stats);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
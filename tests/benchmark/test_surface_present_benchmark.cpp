@@ -0,0 +1,75 @@
+/// @file test_surface_present_benchmark.cpp
+/// @brief Benchmark tests for window surface presentation
+/// @date 2026-10-17
+
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_harness.hpp"
+
+namespace {
+
+constexpr laya::dimensions resolution{3840, 2160};
+
+/// Regions a typical tool UI redraws per frame: a cursor, a few widgets and a status bar
+constexpr std::array dirty_rects{
+    laya::rect{100, 100, 32, 32},    laya::rect{400, 300, 256, 128},  laya::rect{1200, 800, 256, 128},
+    laya::rect{2000, 150, 256, 128}, laya::rect{3000, 1600, 256, 128}, laya::rect{0, 2120, 3840, 40},
+};
+
+/// Time presents of freshly redrawn dirty regions, one frame per harness iteration
+/// @note Only the present is timed, redrawing the regions is not
+template <class Present>
+laya_bench::benchmark_result measure_presents(const char* label, laya::window& win, Present present) {
+    return laya_bench::run_benchmark(label, [&](laya_bench::state& state) {
+        std::size_t frame = 0;
+        for (auto _ : state) {
+            state.pause_timing();
+            {
+                auto surf = win.surface();
+                surf.fill_rects(dirty_rects, frame++ % 2 == 0 ? laya::colors::white : laya::colors::black);
+            }
+            state.resume_timing();
+
+            present();
+        }
+    });
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("window surface presentation at 4K") {
+        laya::context ctx(laya::subsystem::video);
+        laya::window win("Surface Benchmark Window", resolution);
+
+        laya_bench::print_header("Window Surface Presentation (3840x2160)");
+
+        std::cout << "\n  Configuration:\n";
+        laya_bench::print_configuration({}, "frames");
+        std::cout << "    Dirty rects/frame:  " << dirty_rects.size() << "\n";
+
+        laya_bench::print_separator();
+
+        std::cout << "\n  Running: update_surface() (full window)...\n";
+        auto full = measure_presents("update_surface()", win, [&win] { win.update_surface(); });
+        laya_bench::print_result(full);
+
+        std::cout << "\n  Running: update_surface_rects() (dirty regions only)...\n";
+        auto dirty =
+            measure_presents("update_surface_rects()", win, [&win] { win.update_surface_rects(dirty_rects); });
+        laya_bench::print_result(dirty);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison(full, dirty);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
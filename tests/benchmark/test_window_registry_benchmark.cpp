@@ -0,0 +1,117 @@
+/// @file test_window_registry_benchmark.cpp
+/// @brief Benchmark tests for routing events to many windows
+/// @date 2026-10-17
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include "bench_harness.hpp"
+
+namespace {
+
+constexpr std::size_t window_count = 100;
+constexpr std::size_t lookups_per_frame = 100;
+
+laya::window_args tool_window(std::string_view title) {
+    return laya::window_args{title, {320, 240}, std::nullopt, laya::window_flags::hidden};
+}
+
+/// Time frames of `lookups_per_frame` window id lookups, one frame per harness iteration
+template <class Lookup>
+laya_bench::benchmark_result measure_lookups(const char* label, const std::vector<laya::window_id>& ids,
+                                             Lookup lookup) {
+    std::size_t frames = 0;
+    std::size_t found = 0;
+    auto result = laya_bench::run_benchmark(label, [&](laya_bench::state& state) {
+        state.set_items_per_iteration(lookups_per_frame);
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < lookups_per_frame; ++i) {
+                // Stride through the ids so lookups hit every part of the list
+                found += lookup(ids[(i * 37) % ids.size()]) ? 1 : 0;
+            }
+        }
+        frames += state.iterations();
+    });
+
+    // Keep the results observable so the lookups are not optimized away
+    CHECK(found == frames * lookups_per_frame);
+    return result;
+}
+
+}  // anonymous namespace
+
+TEST_SUITE("benchmark") {
+    TEST_CASE("window lookup and batched presentation with 100 windows") {
+        laya::context ctx(laya::subsystem::video);
+
+        const laya::renderer_args software{.flags = laya::renderer_flags::software,
+                                           .vsync = laya::vsync_mode::disabled};
+
+        std::vector<laya::window> windows;
+        windows.reserve(window_count);
+        laya::window_registry registry;
+        std::vector<laya::window_id> ids;
+
+        for (std::size_t i = 0; i < window_count; ++i) {
+            const std::string title = "Registry Benchmark Window " + std::to_string(i);
+            windows.emplace_back(tool_window(title));
+            const auto handle = registry.create(tool_window(title), software);
+            ids.push_back(registry.get(handle)->id());
+        }
+
+        laya_bench::print_header("Window Registry (" + std::to_string(window_count) + " windows)");
+
+        std::cout << "\n  Configuration:\n";
+        laya_bench::print_configuration({}, "frames");
+        std::cout << "    Lookups per frame:  " << lookups_per_frame << "\n";
+
+        laya_bench::print_separator();
+
+        // The vector holds different windows, so look up its own ids with the same access pattern
+        std::vector<laya::window_id> vector_ids;
+        for (const auto& win : windows) {
+            vector_ids.push_back(win.id());
+        }
+
+        std::cout << "\n  Running: linear search over std::vector<laya::window>...\n";
+        auto linear = measure_lookups("linear search", vector_ids, [&windows](laya::window_id id) {
+            const auto it = std::find_if(windows.begin(), windows.end(),
+                                         [id](const laya::window& win) { return win.id() == id; });
+            return it != windows.end();
+        });
+        laya_bench::print_result(linear);
+
+        std::cout << "\n  Running: window_registry::get(window_id)...\n";
+        auto registry_lookup = measure_lookups("window_registry::get", ids, [&registry](laya::window_id id) {
+            return registry.get(id) != nullptr;
+        });
+        laya_bench::print_result(registry_lookup);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Running: window_registry::present_all()...\n";
+
+        auto present = laya_bench::run_benchmark("clear_all() + present_all()", [&registry](laya_bench::state& state) {
+            state.set_items_per_iteration(window_count);
+            for (auto _ : state) {
+                registry.clear_all();
+                registry.present_all();
+            }
+        });
+        laya_bench::print_result(present);
+
+        laya_bench::print_separator();
+        std::cout << "\n  Performance Comparisons:\n";
+        laya_bench::print_comparison(linear, registry_lookup);
+
+        laya_bench::print_separator();
+        std::cout << "\n";
+    }
+}
@@ -0,0 +1,128 @@
+/// @file test_action_map.cpp
+/// @brief Unit tests for input action bindings
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include <array>
+
+namespace {
+
+enum class action : std::uint8_t { jump, fire, save, crouch };
+
+constexpr auto controls = laya::make_action_map(
+    laya::bind_key(action::jump, laya::scancode::space), laya::bind_gamepad(action::jump, laya::gamepad_button::south),
+    laya::bind_mouse(action::fire, laya::mouse_button::left),
+    laya::bind_key(action::save, laya::scancode::s, laya::key_modifier::ctrl),
+    laya::bind_key(action::crouch, laya::scancode::c));
+
+laya::scancode_set keys(std::initializer_list<laya::scancode> held) {
+    laya::scancode_set::words bits{};
+    for (const auto key : held) {
+        const auto index = static_cast<std::size_t>(key);
+        bits[index / 64] |= std::uint64_t{1} << (index % 64);
+    }
+    return laya::scancode_set{bits};
+}
+
+}  // namespace
+
+// Bindings are evaluated at compile time as well
+static_assert(controls.bindings().size() == 5);
+static_assert(controls.evaluate(laya::action_inputs{}).none());
+static_assert(controls.evaluate(laya::action_inputs{.gamepad_buttons = 1u << 0}).test(action::jump));
+static_assert(controls.evaluate(laya::action_inputs{.mouse = laya::mouse_button_mask::left}).test(action::fire));
+
+TEST_SUITE("unit") {
+    TEST_CASE("static_action_map keeps bindings sorted by input") {
+        const auto bindings = controls.bindings();
+        for (std::size_t i = 1; i < bindings.size(); ++i) {
+            CHECK(bindings[i - 1].input <= bindings[i].input);
+        }
+        CHECK(bindings.front().source() == laya::binding_source::key);
+        CHECK(bindings.back().source() == laya::binding_source::gamepad);
+    }
+
+    TEST_CASE("action bindings evaluate keys, mouse and gamepad in one pass") {
+        laya::action_inputs inputs;
+        inputs.keys = keys({laya::scancode::space, laya::scancode::c});
+        inputs.mouse = laya::mouse_button_mask::left;
+
+        const auto active = controls.evaluate(inputs);
+        CHECK(active.test(action::jump));
+        CHECK(active.test(action::fire));
+        CHECK(active.test(action::crouch));
+        CHECK_FALSE(active.test(action::save));
+        CHECK(active.count() == 3);
+    }
+
+    TEST_CASE("modifier bindings require the modifier on either side") {
+        laya::action_inputs inputs;
+        inputs.keys = keys({laya::scancode::s});
+        CHECK_FALSE(controls.evaluate(inputs).test(action::save));
+
+        inputs.modifiers = laya::key_modifier::rctrl;
+        CHECK(controls.evaluate(inputs).test(action::save));
+
+        // Unrelated modifiers do not block bindings without modifiers
+        inputs.keys = keys({laya::scancode::c});
+        inputs.modifiers = laya::key_modifier::lshift;
+        CHECK(controls.evaluate(inputs).test(action::crouch));
+    }
+
+    TEST_CASE("action_set reports started and ended actions") {
+        laya::action_set previous;
+        previous.set(action::jump);
+        previous.set(action::fire);
+
+        laya::action_set current;
+        current.set(action::fire);
+        current.set(action::crouch);
+
+        CHECK(current.started_since(previous).test(action::crouch));
+        CHECK(current.started_since(previous).count() == 1);
+        CHECK(current.ended_since(previous).test(action::jump));
+        CHECK(current.ended_since(previous).count() == 1);
+    }
+
+    TEST_CASE("action_map rebinds at runtime with the same layout") {
+        laya::action_map map{controls};
+        REQUIRE(map.bindings().size() == controls.bindings().size());
+        for (std::size_t i = 0; i < map.bindings().size(); ++i) {
+            CHECK(map.bindings()[i] == controls.bindings()[i]);
+        }
+
+        map.rebind(laya::bind_key(action::jump, laya::scancode::w));
+
+        laya::action_inputs inputs;
+        inputs.keys = keys({laya::scancode::space});
+        CHECK_FALSE(map.evaluate(inputs).test(action::jump));
+
+        inputs.keys = keys({laya::scancode::w});
+        CHECK(map.evaluate(inputs).test(action::jump));
+
+        // Gamepad binding was replaced along with the old key
+        inputs = laya::action_inputs{.gamepad_buttons = 1u << 0};
+        CHECK_FALSE(map.evaluate(inputs).test(action::jump));
+
+        map.bind(laya::bind_key(action::jump, laya::scancode::w));
+        CHECK(map.unbind_action(action::jump) == 1);
+        CHECK_FALSE(map.unbind(laya::bind_key(action::jump, laya::scancode::w)));
+        CHECK(map.unbind(laya::bind_key(action::crouch, laya::scancode::c)));
+    }
+
+    TEST_CASE("binding an out of range action throws") {
+        CHECK_THROWS_AS((void)laya::bind_key(std::size_t{64}, laya::scancode::a), laya::error);
+    }
+
+    TEST_CASE("action_inputs captures a keyboard snapshot") {
+        std::array<std::uint8_t, 512> state{};
+        state[static_cast<std::size_t>(laya::scancode::space)] = 1;
+
+        laya::keyboard_snapshot snapshot;
+        snapshot.update(state.data(), static_cast<int>(state.size()));
+
+        const auto inputs = laya::action_inputs::from(snapshot, laya::key_modifier::none);
+        CHECK(controls.evaluate(inputs).test(action::jump));
+    }
+}
@@ -0,0 +1,207 @@
+/// @file test_command_list.cpp
+/// @brief Unit tests for recorded command lists and the render thread handoff
+/// @date 2026-10-17
+
+#include <thread>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+constexpr laya::renderer_args software{laya::renderer_flags::software, laya::vsync_mode::disabled};
+
+void set_headless_video_driver() {
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("command_list merges adjacent batched draws") {
+        laya::command_list list;
+        CHECK(list.empty());
+
+        list.fill_rect({0, 0, 4, 4});
+        list.fill_rect({4, 0, 4, 4});
+        const laya::rect more[] = {{8, 0, 4, 4}, {12, 0, 4, 4}};
+        list.fill_rects(more, 2);
+        CHECK(list.size() == 1);
+
+        // A state change or another primitive starts a new command
+        list.set_draw_color(laya::colors::white);
+        list.fill_rect({0, 4, 4, 4});
+        list.draw_point({1, 1});
+        list.draw_point({2, 2});
+        CHECK(list.size() == 4);
+
+        // Line series never merge, they would connect
+        list.draw_line({0, 0}, {1, 1});
+        list.draw_line({2, 2}, {3, 3});
+        CHECK(list.size() == 6);
+
+        // Empty input records nothing
+        const laya::point lone[] = {{5, 5}};
+        list.fill_rects(nullptr, 0);
+        list.draw_lines(lone, 1);
+        CHECK(list.size() == 6);
+
+        list.reset();
+        CHECK(list.empty());
+    }
+
+    TEST_CASE("command_list append merges batched draws at the seam") {
+        laya::command_list first;
+        first.set_draw_color(laya::colors::white);
+        first.fill_rect({0, 0, 4, 4});
+
+        laya::command_list second;
+        second.fill_rect({4, 0, 4, 4});
+        second.draw_line({0, 0}, {4, 4});
+        second.set_viewport({0, 0, 8, 8});
+        second.fill_rect({8, 0, 4, 4});
+
+        first.append(second);
+        CHECK(first.size() == 5);
+        CHECK(second.size() == 4);
+
+        // Same commands recorded into a single list
+        laya::command_list direct;
+        direct.set_draw_color(laya::colors::white);
+        direct.fill_rect({0, 0, 4, 4});
+        direct.fill_rect({4, 0, 4, 4});
+        direct.draw_line({0, 0}, {4, 4});
+        direct.set_viewport({0, 0, 8, 8});
+        direct.fill_rect({8, 0, 4, 4});
+        CHECK(first == direct);
+        CHECK_FALSE(first == second);
+    }
+
+    TEST_CASE("command_list_group merges slots by key, not by recording order") {
+        constexpr std::size_t regions = 8;
+        laya::command_list_group group{regions};
+        laya::job_system jobs{{3}};
+
+        // Each region records its own slot, and keys reverse the slot order
+        jobs.parallel_for(0, static_cast<int>(regions), [&group](int begin, int end) {
+            for (int region = begin; region < end; ++region) {
+                const auto slot = static_cast<std::size_t>(region);
+                group.set_key(slot, regions - slot);
+                group[slot].fill_rect({region, 0, 1, 1});
+                group[slot].fill_rect({region, 1, 1, 1});
+            }
+        }, 1);
+
+        laya::command_list merged;
+        group.merge_into(merged);
+        CHECK(merged.size() == 1);  // Plain fills merge across every seam
+
+        // Reset keeps the keys, new slots are keyed by their index
+        group.reset();
+        CHECK(group[0].empty());
+        CHECK(group.key(0) == regions);
+        group.resize(regions + 1);
+        CHECK(group.key(regions) == regions);
+    }
+
+    TEST_CASE("command_list_group replays the highest key last") {
+        set_headless_video_driver();
+        laya::context ctx{laya::subsystem::video};
+        laya::window win{"Group Window", {64, 48}};
+        laya::renderer rend{win, software};
+
+        laya::command_list_group group{3};
+        for (std::size_t slot = 0; slot < group.size(); ++slot) {
+            group[slot].set_draw_color(laya::color{static_cast<std::uint8_t>(slot + 1), 0, 0});
+            group[slot].fill_rect({0, 0, 4, 4});
+        }
+        group.set_key(1, 100);
+
+        group.replay(rend);
+        CHECK(rend.get_draw_color() == laya::color{2, 0, 0});
+
+        laya::command_list merged;
+        group.merge_into(merged);
+        CHECK(merged.size() == 6);
+        merged.replay(rend);
+        CHECK(rend.get_draw_color() == laya::color{2, 0, 0});
+    }
+
+    TEST_CASE("command_list replays onto a renderer") {
+        set_headless_video_driver();
+        laya::context ctx{laya::subsystem::video};
+        laya::window win{"Command List Window", {64, 48}};
+        laya::renderer rend{win, software};
+
+        laya::command_list list;
+        list.set_draw_color(laya::colors::black);
+        list.clear();
+        list.set_viewport({4, 4, 32, 32});
+        list.set_blend_mode(laya::blend_mode::add);
+        list.set_draw_color(laya::color{10, 20, 30, 40});
+        list.fill_rect({0, 0, 8, 8});
+        list.draw_rect({0, 0, 8, 8});
+        list.draw_line({0, 0}, {7, 7});
+
+        laya::texture tex{rend, laya::pixel_format::rgba32, {8, 8}, laya::texture_access::streaming};
+        list.render(tex, laya::point{16, 16});
+        list.render(tex, laya::rect{0, 0, 4, 4}, laya::rect{0, 0, 8, 8}, 45.0, {4, 4}, laya::flip_mode::horizontal);
+
+        CHECK(list.try_replay(rend).has_value());
+        CHECK(rend.get_draw_color() == laya::color{10, 20, 30, 40});
+        CHECK(rend.get_blend_mode() == laya::blend_mode::add);
+        CHECK(rend.get_viewport() == laya::rect{4, 4, 32, 32});
+
+        list.reset();
+        list.reset_viewport();
+        list.replay(rend);
+        CHECK(rend.get_viewport() == laya::rect{0, 0, 64, 48});
+    }
+
+    TEST_CASE("frame_handoff passes frames from a recording thread") {
+        set_headless_video_driver();
+        laya::context ctx{laya::subsystem::video};
+        laya::window win{"Handoff Window", {64, 48}};
+        laya::renderer rend{win, software};
+
+        constexpr int frames = 20;
+        laya::frame_handoff handoff;
+
+        std::thread simulation{[&handoff] {
+            for (int frame = 0; frame < frames; ++frame) {
+                auto& list = handoff.recording();
+                CHECK(list.empty());
+                list.set_draw_color(laya::color{static_cast<std::uint8_t>(frame), 0, 0});
+                list.clear();
+                if (!handoff.submit()) {
+                    return;
+                }
+            }
+        }};
+
+        int rendered = 0;
+        while (rendered < frames) {
+            if (handoff.render(rend, std::chrono::seconds{5})) {
+                ++rendered;
+            } else {
+                break;
+            }
+        }
+        simulation.join();
+
+        CHECK(rendered == frames);
+        CHECK(rend.get_draw_color() == laya::color{frames - 1, 0, 0});
+
+        const auto stats = handoff.stats();
+        CHECK(stats.frames_submitted == frames);
+        CHECK(stats.frames_rendered == frames);
+
+        // Nothing left to render, and a closed handoff rejects new frames
+        CHECK_FALSE(handoff.render(rend, std::chrono::milliseconds{1}));
+        handoff.close();
+        CHECK_FALSE(handoff.submit());
+        CHECK_FALSE(handoff.render(rend));
+    }
+}
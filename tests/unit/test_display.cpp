@@ -0,0 +1,122 @@
+/// @file test_display.cpp
+/// @brief Unit tests for display queries, display events and frame pacing
+
+#include <chrono>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+laya::event moved_to(laya::window_id id, laya::display_id display) {
+    return laya::window_event{0, id, laya::window_event_type::display_changed,
+                              laya::window_event_data_display{static_cast<std::int32_t>(display.value())}};
+}
+
+laya::event mode_changed(laya::display_id display) {
+    return laya::display_event{0, display, laya::display_event::type::current_mode_changed, 0};
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("display_mode frame duration prefers the exact rational rate") {
+        laya::display_mode ntsc;
+        ntsc.refresh_rate = 59.94f;
+        ntsc.refresh_rate_numerator = 60000;
+        ntsc.refresh_rate_denominator = 1001;
+        CHECK(ntsc.frame_duration() == std::chrono::nanoseconds{16'683'333});
+
+        laya::display_mode rounded;
+        rounded.refresh_rate = 144.0f;
+        CHECK(rounded.frame_duration() == std::chrono::nanoseconds{6'944'444});
+
+        CHECK(laya::display_mode{}.frame_duration() == std::chrono::nanoseconds{0});
+    }
+
+    TEST_CASE("display events convert from and to SDL") {
+        SDL_Event sdl{};
+        sdl.type = SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED;
+        sdl.display.timestamp = 42;
+        sdl.display.displayID = 3;
+
+        const auto converted = laya::from_sdl_event(sdl);
+        REQUIRE(std::holds_alternative<laya::display_event>(converted));
+        const auto& display_ev = std::get<laya::display_event>(converted);
+        CHECK(display_ev.id == laya::display_id{3});
+        CHECK(display_ev.display_change == laya::display_event::type::current_mode_changed);
+
+        SDL_Event round_trip;
+        laya::to_sdl_event(converted, round_trip);
+        CHECK(round_trip.type == SDL_EVENT_DISPLAY_CURRENT_MODE_CHANGED);
+        CHECK(round_trip.display.displayID == 3);
+        CHECK(round_trip.display.timestamp == 42);
+    }
+
+    TEST_CASE("frame_pacer retunes windows that move between displays") {
+        const laya::window_id win{1};
+        const laya::display_id fast{10};
+        const laya::display_id slow{20};
+
+        laya::frame_pacer pacer;
+        pacer.set_refresh_rate(fast, 144.0f);
+        pacer.set_refresh_rate(slow, 60.0f);
+
+        pacer.track(win, fast);
+        CHECK(pacer.display_of(win) == fast);
+        CHECK(pacer.refresh_rate(win) == doctest::Approx(144.0).epsilon(0.001));
+
+        CHECK(pacer.handle(moved_to(win, slow)));
+        CHECK(pacer.display_of(win) == slow);
+        CHECK(pacer.refresh_rate(win) == doctest::Approx(60.0).epsilon(0.001));
+
+        // Same rate, nothing to retune
+        CHECK_FALSE(pacer.handle(moved_to(win, slow)));
+
+        // Events for untracked windows and unrelated events are ignored
+        CHECK_FALSE(pacer.handle(moved_to(laya::window_id{2}, fast)));
+        CHECK_FALSE(pacer.handle(laya::quit_event{0}));
+
+        CHECK(pacer.untrack(win));
+        CHECK(pacer.frame_duration(win) == std::chrono::nanoseconds{16'666'667});
+    }
+
+    TEST_CASE("frame_pacer falls back when a display mode cannot be queried") {
+        const laya::window_id win{1};
+        const laya::display_id unknown{99};
+
+        laya::frame_pacer pacer{std::chrono::milliseconds{10}};
+        pacer.set_refresh_rate(unknown, 120.0f);
+        pacer.track(win, unknown);
+        CHECK(pacer.refresh_rate(win) == doctest::Approx(120.0).epsilon(0.001));
+
+        // The mode change forces a query, which fails without the video subsystem
+        CHECK(pacer.handle(mode_changed(unknown)));
+        CHECK(pacer.frame_duration(win) == std::chrono::milliseconds{10});
+    }
+
+    TEST_CASE("display queries on the dummy video driver") {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        laya::context ctx(laya::subsystem::video);
+
+        const auto displays = laya::display::all();
+        REQUIRE_FALSE(displays.empty());
+
+        const auto primary = laya::display::primary();
+        CHECK(primary.id().is_valid());
+        CHECK_NOTHROW((void)primary.name());
+        CHECK(primary.bounds().w > 0);
+        CHECK(primary.usable_bounds().w > 0);
+        CHECK(primary.content_scale() > 0.0f);
+        CHECK(primary.desktop_mode().size.width == primary.bounds().w);
+
+        laya::window win("Display Window", {64, 48});
+        CHECK(laya::display::of(win) == primary);
+
+        laya::frame_pacer pacer;
+        pacer.track(win);
+        CHECK(pacer.display_of(win.id()) == primary.id());
+        CHECK(pacer.frame_duration(win.id()).count() > 0);
+    }
+}
@@ -0,0 +1,81 @@
+/// @file test_errors.cpp
+/// @brief Unit tests for laya::error message formatting
+/// @date 2026-10-17
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+bool contains(const char* text, const char* part) {
+    return std::string{text}.find(part) != std::string::npos;
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("error without location keeps its message as is") {
+        const laya::error formatted{"value {} out of range", 42};
+        CHECK(std::string{formatted.what()} == "value 42 out of range");
+        CHECK(formatted.code() == laya::error_code::generic);
+    }
+
+    TEST_CASE("error with location formats on first what()") {
+        const laya::error located{std::source_location::current(), "texture {} missing", "atlas"};
+        const char* first = located.what();
+        CHECK(contains(first, "test_errors.cpp"));
+        CHECK(contains(first, "texture atlas missing"));
+
+        // Formatted once, later calls return the same text
+        CHECK(located.what() == first);
+
+        // Copies keep the message
+        const laya::error copy = located;
+        CHECK(std::string{copy.what()} == first);
+    }
+
+    TEST_CASE("error what() is safe from several threads") {
+        static_assert(std::is_nothrow_copy_constructible_v<laya::error>);
+        static_assert(std::is_nothrow_copy_assignable_v<laya::error>);
+
+        const laya::error original{std::source_location::current(), "shader {} failed", "blit"};
+        const laya::error copy = original;  // Copied before the text is formatted
+
+        const char* from_thread = nullptr;
+        std::thread worker{[&] { from_thread = original.what(); }};
+        const char* from_main = original.what();
+        worker.join();
+
+        // Both threads see the one published text
+        CHECK(from_thread == from_main);
+        CHECK(contains(from_main, "shader blit failed"));
+        CHECK(std::string{copy.what()} == from_main);
+    }
+
+    TEST_CASE("from_sdl captures SDL's message at construction") {
+        SDL_SetError("renderer lost");
+        const auto err = laya::error::from_sdl();
+        SDL_SetError("unrelated");
+
+        CHECK(err.code() == laya::error_code::sdl);
+        CHECK(contains(err.what(), "SDL Error: renderer lost"));
+        CHECK(contains(err.what(), "test_errors.cpp"));
+        CHECK(err.location().line() > 0);
+    }
+
+    TEST_CASE("laya::error is caught as std::runtime_error") {
+        bool caught = false;
+        try {
+            throw laya::error::from_sdl();
+        } catch (const std::runtime_error& e) {
+            caught = contains(e.what(), "SDL Error");
+        }
+        CHECK(caught);
+    }
+}
@@ -0,0 +1,125 @@
+/// @file test_event_batch.cpp
+/// @brief Unit tests for the structure-of-arrays event batch
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+SDL_Event make_motion(float xrel, float yrel) {
+    SDL_Event event{};
+    event.type = SDL_EVENT_MOUSE_MOTION;
+    event.motion.timestamp = 42;
+    event.motion.windowID = 1;
+    event.motion.x = 10.0f;
+    event.motion.y = 20.0f;
+    event.motion.xrel = xrel;
+    event.motion.yrel = yrel;
+    return event;
+}
+
+SDL_Event make_key(SDL_EventType type, SDL_Scancode scancode) {
+    SDL_Event event{};
+    event.type = type;
+    event.key.windowID = 1;
+    event.key.scancode = scancode;
+    event.key.key = SDLK_A;
+    event.key.down = type == SDL_EVENT_KEY_DOWN;
+    return event;
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("event_batch stores SDL events as columns") {
+        const SDL_Event events[] = {
+            make_motion(3.0f, 4.0f),
+            make_key(SDL_EVENT_KEY_DOWN, SDL_SCANCODE_A),
+            make_motion(-6.0f, 8.0f),
+            make_key(SDL_EVENT_KEY_UP, SDL_SCANCODE_B),
+        };
+
+        laya::event_batch batch;
+        batch.append(events, std::size(events));
+
+        CHECK(batch.size() == 4);
+        CHECK(batch.skipped() == 0);
+
+        const auto motions = batch.mouse_motions();
+        REQUIRE(motions.size() == 2);
+        CHECK(motions.timestamp[0] == 42);
+        CHECK(motions.x[1] == doctest::Approx(10.0f));
+        CHECK(motions.xrel[1] == doctest::Approx(-6.0f));
+
+        const auto keys = batch.keys();
+        REQUIRE(keys.size() == 2);
+        CHECK(keys.scancode[0] == SDL_SCANCODE_A);
+        CHECK(keys.pressed[0] == 1);
+        CHECK(keys.scancode[1] == SDL_SCANCODE_B);
+        CHECK(keys.pressed[1] == 0);
+
+        // |(3,4)| + |(-6,8)| = 5 + 10
+        CHECK(batch.mouse_travel() == doctest::Approx(15.0f));
+    }
+
+    TEST_CASE("event_batch converts window events and skips unsupported ones") {
+        SDL_Event resized{};
+        resized.type = SDL_EVENT_WINDOW_RESIZED;
+        resized.window.windowID = 2;
+        resized.window.data1 = 640;
+        resized.window.data2 = 480;
+
+        SDL_Event user{};
+        user.type = SDL_EVENT_USER;
+
+        SDL_Event quit{};
+        quit.type = SDL_EVENT_QUIT;
+
+        laya::event_batch batch;
+        batch.append(&resized, 1);
+        batch.append(&user, 1);
+        batch.append(&quit, 1);
+
+        const auto windows = batch.windows();
+        REQUIRE(windows.size() == 1);
+        CHECK(windows.window[0] == 2);
+        CHECK(windows.type[0] == laya::window_event_type::resized);
+        CHECK(windows.data1[0] == 640);
+        CHECK(windows.data2[0] == 480);
+        CHECK(batch.skipped() == 1);
+        CHECK(batch.quit_count() == 1);
+    }
+
+    TEST_CASE("event_batch clear keeps nothing") {
+        laya::event_batch batch;
+        batch.reserve(64);
+
+        laya::mouse_wheel_event wheel{};
+        wheel.precise_y = 1.5f;
+        batch.append(laya::event{wheel});
+        REQUIRE(batch.mouse_wheels().size() == 1);
+        CHECK(batch.mouse_wheels().y[0] == doctest::Approx(1.5f));
+
+        batch.clear();
+        CHECK(batch.empty());
+        CHECK(batch.mouse_wheels().size() == 0);
+        CHECK(batch.quit_count() == 0);
+    }
+
+    TEST_CASE("event_batch polls the SDL queue") {
+        laya::context ctx(laya::subsystem::video);
+        laya::flush_events();
+
+        for (int i = 0; i < 300; ++i) {
+            SDL_Event event = make_motion(1.0f, 0.0f);
+            REQUIRE(SDL_PushEvent(&event));
+        }
+
+        laya::event_batch batch;
+        CHECK(batch.poll() >= 300);
+        CHECK(batch.mouse_motions().size() == 300);
+        CHECK(batch.mouse_travel() == doctest::Approx(300.0f));
+        CHECK_FALSE(laya::has_events());
+    }
+}
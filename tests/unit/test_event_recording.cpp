@@ -0,0 +1,249 @@
+/// @file test_event_recording.cpp
+/// @brief Unit tests for event recording and replay
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+std::string recording_path(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+laya::key_event make_key_event(std::uint64_t timestamp, std::uint32_t scancode) {
+    laya::key_event ev{};
+    ev.timestamp = timestamp;
+    ev.id = laya::window_id{1};
+    ev.key_state = laya::key_event::state::pressed;
+    ev.scancode = scancode;
+    ev.keycode = 'a';
+    ev.mod = 0;
+    ev.repeat = false;
+    return ev;
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("event_recorder round-trips events through a file") {
+        const auto path = recording_path("laya_test_round_trip.layaevt");
+
+        laya::window_event resized{};
+        resized.timestamp = 2'000;
+        resized.id = laya::window_id{3};
+        resized.event_type = laya::window_event_type::resized;
+        resized.data = laya::window_event_data_size{640, 480};
+
+        laya::text_input_event text{};
+        text.timestamp = 3'000;
+        text.id = laya::window_id{3};
+        std::strcpy(text.text, "hello");
+
+        {
+            laya::event_recorder recorder{path};
+            recorder.record(make_key_event(1'000, 4));
+            recorder.record(resized);
+            recorder.flush();
+            recorder.record(text);
+            CHECK(recorder.size() == 3);
+        }
+
+        laya::event_player player{path};
+        REQUIRE(player.size() == 3);
+        CHECK(player.position() == 0);
+
+        const auto events = player.events();
+        REQUIRE(std::holds_alternative<laya::key_event>(events[0]));
+        CHECK(std::get<laya::key_event>(events[0]).timestamp == 1'000);
+        CHECK(std::get<laya::key_event>(events[0]).scancode == 4);
+
+        REQUIRE(std::holds_alternative<laya::window_event>(events[1]));
+        const auto size = laya::get_size(std::get<laya::window_event>(events[1]));
+        REQUIRE(size.has_value());
+        CHECK(size->width == 640);
+        CHECK(size->height == 480);
+
+        REQUIRE(std::holds_alternative<laya::text_input_event>(events[2]));
+        CHECK(std::string{std::get<laya::text_input_event>(events[2]).text} == "hello");
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("event_player rejects files that are not recordings") {
+        const auto path = recording_path("laya_test_invalid.layaevt");
+        {
+            std::ofstream file{path, std::ios::binary};
+            file << "definitely not a recording";
+        }
+
+        CHECK_THROWS_AS(laya::event_player{path}, laya::error);
+        CHECK_THROWS_AS(laya::event_player{recording_path("laya_test_missing.layaevt")}, laya::error);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("event_player rejects recordings from another event layout") {
+        const auto path = recording_path("laya_test_old_layout.layaevt");
+
+        // Overwrite one header field of a valid recording: the version at byte 8, the layout hash at 16
+        const auto write_with = [&path](std::streamoff offset) {
+            {
+                laya::event_recorder recorder{path};
+                recorder.record(make_key_event(1'000, 4));
+            }
+            std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+            const std::uint32_t other = 2;
+            file.seekp(offset);
+            file.write(reinterpret_cast<const char*>(&other), sizeof(other));
+        };
+
+        write_with(8);
+        CHECK_THROWS_AS(laya::event_player{path}, laya::error);
+
+        write_with(16);
+        CHECK_THROWS_AS(laya::event_player{path}, laya::error);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("event_recorder captures events pushed to SDL") {
+        laya::context ctx(laya::subsystem::video);
+        laya::flush_events();
+
+        const auto path = recording_path("laya_test_capture.layaevt");
+        {
+            laya::event_recorder recorder{path};
+            recorder.start();
+            CHECK(recorder.is_recording());
+
+            SDL_Event sdl_event;
+            laya::to_sdl_event(make_key_event(0, 7), sdl_event);
+            REQUIRE(SDL_PushEvent(&sdl_event));
+            laya::flush_events();
+
+            recorder.stop();
+            CHECK_FALSE(recorder.is_recording());
+            CHECK(recorder.size() == 1);
+        }
+
+        laya::event_player player{path};
+        REQUIRE(player.size() == 1);
+        REQUIRE(std::holds_alternative<laya::key_event>(player.events()[0]));
+        CHECK(std::get<laya::key_event>(player.events()[0]).scancode == 7);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("event_recorder drops events past max_pending until flushed") {
+        const auto path = recording_path("laya_test_dropped.layaevt");
+        {
+            laya::event_recorder recorder{path, 2};
+            recorder.record(make_key_event(1'000, 0));
+            recorder.record(make_key_event(2'000, 1));
+            recorder.record(make_key_event(3'000, 2));
+            CHECK(recorder.size() == 2);
+            CHECK(recorder.dropped() == 1);
+
+            recorder.flush();
+            recorder.record(make_key_event(4'000, 3));
+            CHECK(recorder.size() == 3);
+            CHECK(recorder.dropped() == 1);
+            CHECK_FALSE(recorder.watch_error());
+        }
+
+        laya::event_player player{path};
+        CHECK(player.size() == 3);
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("event_recorder skips events replayed by event_player") {
+        laya::context ctx(laya::subsystem::video);
+        laya::flush_events();
+
+        const auto source = recording_path("laya_test_replay_source.layaevt");
+        const auto capture = recording_path("laya_test_replay_capture.layaevt");
+        {
+            laya::event_recorder recorder{source};
+            recorder.record(make_key_event(1'000, 5));
+        }
+
+        {
+            laya::event_recorder recorder{capture};
+            recorder.start();
+
+            laya::event_player player{source};
+            player.start(laya::playback_timing::as_fast_as_possible);
+            CHECK(player.pump() == 1);
+            laya::flush_events();
+
+            recorder.stop();
+            CHECK(recorder.size() == 0);
+        }
+
+        std::filesystem::remove(source);
+        std::filesystem::remove(capture);
+    }
+
+    TEST_CASE("event_player replays events as fast as possible") {
+        laya::context ctx(laya::subsystem::video);
+        laya::flush_events();
+
+        const auto path = recording_path("laya_test_replay.layaevt");
+        {
+            laya::event_recorder recorder{path};
+            for (std::uint32_t i = 0; i < 8; ++i) {
+                recorder.record(make_key_event(1'000'000'000ull * (i + 1), i));
+            }
+        }
+
+        laya::event_player player{path};
+        CHECK(player.pump() == 0);  // not started yet
+
+        player.start(laya::playback_timing::as_fast_as_possible);
+        CHECK(player.pump() == 8);
+        CHECK(player.finished());
+
+        std::uint32_t expected = 0;
+        for (const auto& ev : laya::events_view()) {
+            REQUIRE(std::holds_alternative<laya::key_event>(ev));
+            CHECK(std::get<laya::key_event>(ev).scancode == expected++);
+        }
+        CHECK(expected == 8);
+
+        player.rewind();
+        CHECK(player.position() == 0);
+        CHECK_FALSE(player.finished());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("event_player preserves original timing") {
+        laya::context ctx(laya::subsystem::video);
+        laya::flush_events();
+
+        const auto path = recording_path("laya_test_timing.layaevt");
+        {
+            laya::event_recorder recorder{path};
+            recorder.record(make_key_event(5'000, 0));
+            recorder.record(make_key_event(5'000 + 3'600'000'000'000ull, 1));  // an hour later
+        }
+
+        laya::event_player player{path};
+        player.start(laya::playback_timing::original);
+
+        // The first event is due immediately, the second is far in the future
+        CHECK(player.pump() == 1);
+        CHECK(player.position() == 1);
+        CHECK_FALSE(player.finished());
+
+        laya::flush_events();
+        std::filesystem::remove(path);
+    }
+}
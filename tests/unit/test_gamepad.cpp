@@ -0,0 +1,142 @@
+/// @file test_gamepad.cpp
+/// @brief Unit tests for gamepad/joystick wrappers and gamepad events
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+#include <vector>
+
+namespace {
+
+/// Attach an SDL virtual gamepad for the lifetime of the object
+struct virtual_gamepad {
+    virtual_gamepad() {
+        SDL_VirtualJoystickDesc desc;
+        SDL_INIT_INTERFACE(&desc);
+        desc.type = SDL_JOYSTICK_TYPE_GAMEPAD;
+        desc.naxes = SDL_GAMEPAD_AXIS_COUNT;
+        desc.nbuttons = SDL_GAMEPAD_BUTTON_COUNT;
+        desc.name = "laya virtual gamepad";
+        id = SDL_AttachVirtualJoystick(&desc);
+    }
+
+    ~virtual_gamepad() {
+        if (id != 0) {
+            SDL_DetachVirtualJoystick(id);
+        }
+    }
+
+    SDL_JoystickID id = 0;
+};
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("gamepad events convert from SDL") {
+        SDL_Event axis{};
+        axis.type = SDL_EVENT_GAMEPAD_AXIS_MOTION;
+        axis.gaxis.which = 7;
+        axis.gaxis.axis = SDL_GAMEPAD_AXIS_RIGHT_TRIGGER;
+        axis.gaxis.value = 1234;
+
+        const auto converted_axis = laya::from_sdl_event(axis);
+        REQUIRE(std::holds_alternative<laya::gamepad_axis_event>(converted_axis));
+        CHECK(std::get<laya::gamepad_axis_event>(converted_axis).which == 7);
+        CHECK(std::get<laya::gamepad_axis_event>(converted_axis).axis == laya::gamepad_axis::right_trigger);
+        CHECK(std::get<laya::gamepad_axis_event>(converted_axis).value == 1234);
+
+        SDL_Event button{};
+        button.type = SDL_EVENT_GAMEPAD_BUTTON_UP;
+        button.gbutton.which = 7;
+        button.gbutton.button = SDL_GAMEPAD_BUTTON_START;
+
+        const auto converted_button = laya::from_sdl_event(button);
+        REQUIRE(std::holds_alternative<laya::gamepad_button_event>(converted_button));
+        CHECK(std::get<laya::gamepad_button_event>(converted_button).button == laya::gamepad_button::start);
+        CHECK(std::get<laya::gamepad_button_event>(converted_button).button_state ==
+              laya::gamepad_button_event::state::released);
+
+        SDL_Event removed{};
+        removed.type = SDL_EVENT_GAMEPAD_REMOVED;
+        removed.gdevice.which = 7;
+
+        const auto converted_removed = laya::from_sdl_event(removed);
+        REQUIRE(std::holds_alternative<laya::gamepad_device_event>(converted_removed));
+        CHECK(std::get<laya::gamepad_device_event>(converted_removed).device_event ==
+              laya::gamepad_device_event::type::removed);
+    }
+
+    TEST_CASE("gamepad events round-trip through to_sdl_event") {
+        laya::gamepad_button_event original{};
+        original.timestamp = 99;
+        original.which = 3;
+        original.button = laya::gamepad_button::dpad_left;
+        original.button_state = laya::gamepad_button_event::state::pressed;
+
+        SDL_Event sdl_event;
+        laya::to_sdl_event(original, sdl_event);
+        CHECK(sdl_event.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN);
+
+        const auto back = std::get<laya::gamepad_button_event>(laya::from_sdl_event(sdl_event));
+        CHECK(back.timestamp == 99);
+        CHECK(back.which == 3);
+        CHECK(back.button == laya::gamepad_button::dpad_left);
+    }
+
+    TEST_CASE("gamepad_state bit queries") {
+        laya::gamepad_state state{};
+        state.buttons = (1u << static_cast<unsigned>(laya::gamepad_button::south)) |
+                        (1u << static_cast<unsigned>(laya::gamepad_button::misc6));
+        state.axes[static_cast<std::size_t>(laya::gamepad_axis::left_y)] = -100;
+
+        CHECK(state.pressed(laya::gamepad_button::south));
+        CHECK(state.pressed(laya::gamepad_button::misc6));
+        CHECK_FALSE(state.pressed(laya::gamepad_button::east));
+        CHECK(state.axis(laya::gamepad_axis::left_y) == -100);
+    }
+
+    TEST_CASE("opening an unknown device throws") {
+        laya::context ctx(laya::subsystem::gamepad);
+        CHECK_THROWS_AS(laya::gamepad{0xFFFFFFu}, laya::error);
+        CHECK_THROWS_AS(laya::joystick{0xFFFFFFu}, laya::error);
+    }
+
+    TEST_CASE("snapshots read every device in one pass") {
+        laya::context ctx(laya::subsystem::gamepad);
+
+        virtual_gamepad device;
+        REQUIRE(device.id != 0);
+        CHECK(laya::is_gamepad(device.id));
+
+        std::vector<laya::gamepad> pads;
+        pads.emplace_back(device.id);
+        std::vector<laya::joystick> sticks;
+        sticks.emplace_back(device.id);
+
+        SDL_Joystick* handle = sticks.front().native_handle();
+        REQUIRE(SDL_SetJoystickVirtualAxis(handle, SDL_GAMEPAD_AXIS_LEFTX, 16000));
+        REQUIRE(SDL_SetJoystickVirtualButton(handle, SDL_GAMEPAD_BUTTON_SOUTH, true));
+        SDL_UpdateJoysticks();
+
+        laya::gamepad_snapshot pad_snapshot;
+        pad_snapshot.capture(pads);
+        REQUIRE(pad_snapshot.states().size() == 1);
+        const auto& state = pad_snapshot.states()[0];
+        CHECK(state.id == device.id);
+        CHECK(state.axis(laya::gamepad_axis::left_x) == 16000);
+        CHECK(state.pressed(laya::gamepad_button::south));
+        CHECK_FALSE(state.pressed(laya::gamepad_button::north));
+
+        laya::joystick_snapshot stick_snapshot;
+        stick_snapshot.capture(sticks);
+        REQUIRE(stick_snapshot.size() == 1);
+        CHECK(stick_snapshot.id(0) == device.id);
+        CHECK(stick_snapshot.axes(0).size() == static_cast<std::size_t>(sticks.front().axis_count()));
+        CHECK(stick_snapshot.buttons(0).size() == static_cast<std::size_t>(sticks.front().button_count()));
+
+        // Capturing again reuses the same storage
+        pad_snapshot.capture({});
+        CHECK(pad_snapshot.states().empty());
+    }
+}
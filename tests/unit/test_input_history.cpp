@@ -0,0 +1,185 @@
+/// @file test_input_history.cpp
+/// @brief Unit tests for input history and gesture detectors
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+#include <array>
+
+namespace {
+
+constexpr std::uint64_t ms = 1'000'000;
+
+laya::input_record press(laya::input_code input, std::uint64_t timestamp, bool pressed = true) {
+    return laya::input_record{timestamp, 0, input.code, input.device, pressed};
+}
+
+const auto key_a = laya::input_code::key(laya::scancode::a);
+const auto key_s = laya::input_code::key(laya::scancode::s);
+const auto key_d = laya::input_code::key(laya::scancode::d);
+const auto left_click = laya::input_code::mouse(laya::mouse_button::left);
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("input_history wraps and keeps sequence numbers") {
+        laya::input_history history{4};
+        for (std::uint64_t i = 0; i < 6; ++i) {
+            history.push(press(key_a, i * ms));
+        }
+
+        CHECK(history.size() == 4);
+        CHECK(history.first_sequence() == 2);
+        CHECK(history.end_sequence() == 6);
+        CHECK(history.at(2).timestamp == 2 * ms);
+
+        const auto all = history.records();
+        REQUIRE(all.size() == 4);
+        CHECK(all[0].timestamp == 2 * ms);
+        CHECK(all.back().timestamp == 5 * ms);
+
+        history.clear();
+        CHECK(history.size() == 0);
+        CHECK(history.end_sequence() == 6);
+    }
+
+    TEST_CASE("input_history time window queries") {
+        laya::input_history history{8};
+        for (std::uint64_t i = 0; i < 12; ++i) {
+            history.push(press(key_a, i * 10 * ms));
+        }
+
+        const auto recent = history.since(95 * ms);
+        REQUIRE(recent.size() == 2);
+        CHECK(recent[0].timestamp == 100 * ms);
+
+        const auto window = history.between(40 * ms, 70 * ms);
+        REQUIRE(window.size() == 3);
+        CHECK(window[0].timestamp == 40 * ms);
+        CHECK(window.back().timestamp == 60 * ms);
+
+        // Older than anything still stored
+        CHECK(history.since(0).size() == 8);
+        CHECK(history.between(70 * ms, 40 * ms).empty());
+    }
+
+    TEST_CASE("input_history records button events and skips key repeats") {
+        laya::input_history history;
+
+        laya::key_event key{};
+        key.timestamp = 5;
+        key.key_state = laya::key_event::state::pressed;
+        key.scancode = static_cast<std::uint32_t>(laya::scancode::a);
+        CHECK(history.record(key));
+
+        key.repeat = true;
+        CHECK_FALSE(history.record(key));
+
+        laya::gamepad_button_event pad{7, 3, laya::gamepad_button::south, laya::gamepad_button_event::state::released};
+        CHECK(history.record(pad));
+        CHECK_FALSE(history.record(laya::quit_event{8}));
+
+        const auto all = history.records();
+        REQUIRE(all.size() == 2);
+        CHECK(all[0].input() == key_a);
+        CHECK(all[0].pressed);
+        CHECK(all[1].input() == laya::input_code::gamepad(laya::gamepad_button::south));
+        CHECK(all[1].which == 3);
+        CHECK_FALSE(all[1].pressed);
+    }
+
+    TEST_CASE("multi_click_detector finds double clicks across updates") {
+        laya::input_history history;
+        laya::multi_click_detector double_click{left_click, 2, 300 * ms};
+
+        history.push(press(left_click, 0));
+        history.push(press(left_click, 10 * ms, false));
+        CHECK(double_click.update(history) == 0);
+
+        history.push(press(left_click, 200 * ms));
+        CHECK(double_click.update(history) == 1);
+        CHECK(double_click.last_timestamp() == 200 * ms);
+
+        // Too slow
+        history.push(press(left_click, 1000 * ms));
+        history.push(press(left_click, 1400 * ms));
+        CHECK(double_click.update(history) == 0);
+
+        // Already processed records are not counted twice
+        CHECK(double_click.update(history) == 0);
+    }
+
+    TEST_CASE("hold_detector fires once per hold") {
+        laya::input_history history;
+        laya::hold_detector hold{key_a, 500 * ms};
+
+        history.push(press(key_a, 100 * ms));
+        CHECK_FALSE(hold.update(history, 200 * ms));
+        CHECK(hold.is_down());
+        CHECK_FALSE(hold.is_held());
+
+        CHECK(hold.update(history, 600 * ms));
+        CHECK(hold.is_held());
+        CHECK_FALSE(hold.update(history, 700 * ms));
+
+        history.push(press(key_a, 800 * ms, false));
+        CHECK_FALSE(hold.update(history, 2000 * ms));
+        CHECK_FALSE(hold.is_down());
+    }
+
+    TEST_CASE("sequence_detector matches combos in order and in time") {
+        const std::array combo{key_a, key_s, key_d};
+
+        laya::input_history history;
+        laya::sequence_detector detector{combo, 200 * ms};
+
+        history.push(press(key_a, 0));
+        history.push(press(key_a, 10 * ms, false));
+        history.push(press(key_s, 100 * ms));
+        CHECK(detector.update(history) == 0);
+        CHECK(detector.progress() == 2);
+
+        history.push(press(key_d, 200 * ms));
+        CHECK(detector.update(history) == 1);
+        CHECK(detector.progress() == 0);
+
+        // Wrong key in the middle restarts the attempt
+        history.push(press(key_a, 1000 * ms));
+        history.push(press(key_d, 1050 * ms));
+        history.push(press(key_a, 1100 * ms));
+        history.push(press(key_s, 1150 * ms));
+        history.push(press(key_d, 1200 * ms));
+        CHECK(detector.update(history) == 1);
+
+        // Too slow between steps
+        history.push(press(key_a, 2000 * ms));
+        history.push(press(key_s, 2500 * ms));
+        history.push(press(key_d, 2600 * ms));
+        CHECK(detector.update(history) == 0);
+    }
+
+    TEST_CASE("sequence_detector keeps a repeated prefix after a wrong press") {
+        const std::array combo{key_s, key_s, key_d};
+
+        laya::input_history history;
+        laya::sequence_detector detector{combo, 200 * ms};
+
+        // The third down press does not match, the last two still start the combo
+        history.push(press(key_s, 0));
+        history.push(press(key_s, 50 * ms));
+        history.push(press(key_s, 100 * ms));
+        CHECK(detector.update(history) == 0);
+        CHECK(detector.progress() == 2);
+
+        history.push(press(key_d, 150 * ms));
+        CHECK(detector.update(history) == 1);
+        CHECK(detector.progress() == 0);
+
+        // A late press still only starts a new attempt
+        history.push(press(key_s, 1000 * ms));
+        history.push(press(key_s, 1050 * ms));
+        history.push(press(key_s, 1500 * ms));
+        CHECK(detector.update(history) == 0);
+        CHECK(detector.progress() == 1);
+    }
+}
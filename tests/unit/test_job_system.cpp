@@ -0,0 +1,115 @@
+/// @file test_job_system.cpp
+/// @brief Unit tests for the work-stealing job system
+/// @date 2026-10-17
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+TEST_SUITE("unit") {
+    TEST_CASE("job_system runs submitted jobs") {
+        laya::job_system jobs{{2}};
+        CHECK(jobs.thread_count() == 2);
+
+        std::atomic<int> count{0};
+        std::vector<laya::job_handle> handles;
+        for (int i = 0; i < 100; ++i) {
+            handles.push_back(jobs.submit([&count] { count.fetch_add(1); }));
+        }
+        for (const auto& handle : handles) {
+            jobs.wait(handle);
+            CHECK(handle.done());
+        }
+        CHECK(count == 100);
+        CHECK(jobs.stats().jobs_executed == 100);
+
+        jobs.reset_stats();
+        CHECK(jobs.stats().jobs_executed == 0);
+    }
+
+    TEST_CASE("job_system runs dependencies first") {
+        laya::job_system jobs{{3}};
+        std::mutex order_mutex;
+        std::vector<char> order;
+        auto record = [&](char c) {
+            return [&, c] {
+                std::lock_guard lock{order_mutex};
+                order.push_back(c);
+            };
+        };
+
+        // Diamond: a before b and c, both before d
+        const auto a = jobs.submit(record('a'));
+        const auto b = jobs.submit(record('b'), {a});
+        const auto c = jobs.submit(record('c'), {a});
+        const auto d = jobs.submit(record('d'), {b, c, laya::job_handle{}});
+        jobs.wait(d);
+
+        REQUIRE(order.size() == 4);
+        CHECK(order.front() == 'a');
+        CHECK(order.back() == 'd');
+    }
+
+    TEST_CASE("job_system rethrows a job's exception from wait") {
+        laya::job_system jobs{{1}};
+        const auto failing = jobs.submit([] { throw std::runtime_error("job failed"); });
+        bool dependent_ran = false;
+        const auto dependent = jobs.submit([&dependent_ran] { dependent_ran = true; }, {failing});
+
+        CHECK_THROWS_AS(jobs.wait(failing), std::runtime_error);
+        jobs.wait(dependent);
+        CHECK(dependent_ran);
+    }
+
+    TEST_CASE("job_system parallel_for covers every row once") {
+        laya::job_system jobs{{3}};
+        std::vector<int> hits(1000, 0);
+
+        jobs.parallel_for(0, 1000, [&hits](int row_begin, int row_end) {
+            for (int row = row_begin; row < row_end; ++row) {
+                ++hits[static_cast<std::size_t>(row)];
+            }
+        });
+        CHECK(std::count(hits.begin(), hits.end(), 1) == 1000);
+
+        // Explicit grain, nested inside a job, and an empty range
+        std::atomic<int> rows{0};
+        jobs.wait(jobs.submit([&] {
+            jobs.parallel_for(10, 47, [&rows](int row_begin, int row_end) { rows += row_end - row_begin; }, 4);
+        }));
+        CHECK(rows == 37);
+        jobs.parallel_for(5, 5, [](int, int) { FAIL("empty range ran"); });
+
+        CHECK_THROWS_AS(jobs.parallel_for(0, 100, [](int row_begin, int) {
+            if (row_begin == 0) {
+                throw std::runtime_error("row failed");
+            }
+        }, 10),
+                        std::runtime_error);
+    }
+
+    TEST_CASE("job_system runs main-thread jobs only when asked") {
+        laya::job_system jobs{{2}};
+        std::atomic<bool> ran{false};
+        const auto upload = jobs.submit([&ran] { ran = true; }, {}, laya::job_affinity::main_thread);
+
+        const auto worker = jobs.submit([] {});
+        jobs.wait(worker);
+        CHECK_FALSE(ran);
+        CHECK_FALSE(upload.done());
+
+        CHECK(jobs.run_main_thread_jobs() == 1);
+        CHECK(ran);
+        CHECK(upload.done());
+
+        // Waiting from the thread that created the job system runs them too
+        const auto another = jobs.submit([] {}, {}, laya::job_affinity::main_thread);
+        jobs.wait(another);
+        CHECK(another.done());
+    }
+}
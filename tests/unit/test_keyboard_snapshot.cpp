@@ -0,0 +1,138 @@
+/// @file test_keyboard_snapshot.cpp
+/// @brief Unit tests for keyboard snapshots and edge detection
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+#include <array>
+#include <vector>
+
+namespace {
+
+using key_state = std::array<std::uint8_t, 512>;
+
+key_state make_state(std::initializer_list<laya::scancode> held) {
+    key_state state{};
+    for (const auto key : held) {
+        state[static_cast<std::size_t>(key)] = 1;
+    }
+    return state;
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("keyboard_snapshot detects presses and releases") {
+        laya::keyboard_snapshot snapshot;
+
+        auto frame1 = make_state({laya::scancode::w, laya::scancode::lshift});
+        snapshot.update(frame1.data(), static_cast<int>(frame1.size()));
+
+        CHECK(snapshot.held(laya::scancode::w));
+        CHECK(snapshot.pressed(laya::scancode::w));
+        CHECK(snapshot.pressed(laya::scancode::lshift));
+        CHECK_FALSE(snapshot.released(laya::scancode::w));
+        CHECK(snapshot.any_held());
+
+        auto frame2 = make_state({laya::scancode::w, laya::scancode::space});
+        snapshot.update(frame2.data(), static_cast<int>(frame2.size()));
+
+        CHECK(snapshot.held(laya::scancode::w));
+        CHECK_FALSE(snapshot.pressed(laya::scancode::w));
+        CHECK_FALSE(snapshot.changed(laya::scancode::w));
+        CHECK(snapshot.pressed(laya::scancode::space));
+        CHECK(snapshot.released(laya::scancode::lshift));
+        CHECK_FALSE(snapshot.held(laya::scancode::lshift));
+
+        auto frame3 = make_state({});
+        snapshot.update(frame3.data(), static_cast<int>(frame3.size()));
+        CHECK_FALSE(snapshot.any_held());
+        CHECK(snapshot.released(laya::scancode::w));
+        CHECK(snapshot.released(laya::scancode::space));
+    }
+
+    TEST_CASE("keyboard_snapshot iterates changed keys in order") {
+        laya::keyboard_snapshot snapshot;
+
+        auto frame1 = make_state({laya::scancode::a, laya::scancode::rgui});
+        snapshot.update(frame1.data(), static_cast<int>(frame1.size()));
+
+        auto frame2 = make_state({laya::scancode::rgui, laya::scancode::f1, laya::scancode::up});
+        snapshot.update(frame2.data(), static_cast<int>(frame2.size()));
+
+        std::vector<laya::scancode> changed(snapshot.changed_keys().begin(), snapshot.changed_keys().end());
+        REQUIRE(changed.size() == 3);
+        CHECK(changed[0] == laya::scancode::a);
+        CHECK(changed[1] == laya::scancode::f1);
+        CHECK(changed[2] == laya::scancode::up);
+
+        const auto pressed = snapshot.pressed_keys();
+        CHECK(pressed.size() == 2);
+        CHECK(pressed.contains(laya::scancode::f1));
+        CHECK(pressed.contains(laya::scancode::up));
+
+        const auto released = snapshot.released_keys();
+        REQUIRE(released.size() == 1);
+        CHECK(*released.begin() == laya::scancode::a);
+
+        CHECK(snapshot.held_keys().size() == 3);
+    }
+
+    TEST_CASE("keyboard_snapshot handles short and unaligned state arrays") {
+        laya::keyboard_snapshot snapshot;
+
+        std::array<std::uint8_t, 13> state{};
+        state[12] = 1;
+        snapshot.update(state.data(), static_cast<int>(state.size()));
+        CHECK(snapshot.held(static_cast<laya::scancode>(12)));
+        CHECK(snapshot.held_keys().size() == 1);
+
+        snapshot.update(nullptr, 0);
+        CHECK_FALSE(snapshot.any_held());
+        CHECK(snapshot.released(static_cast<laya::scancode>(12)));
+    }
+
+    TEST_CASE("empty scancode_set has no elements") {
+        const laya::scancode_set set;
+        CHECK(set.empty());
+        CHECK(set.begin() == set.end());
+    }
+
+    TEST_CASE("keyboard_snapshot reads SDL state") {
+        laya::context ctx(laya::subsystem::video);
+        laya::keyboard_snapshot snapshot;
+        snapshot.update();
+        CHECK_FALSE(snapshot.any_held());
+    }
+
+    TEST_CASE("cached keycode lookups match SDL across keymap changes") {
+        laya::context ctx(laya::subsystem::video);
+
+        const std::array keys{laya::keycode::a,      laya::keycode::z,  laya::keycode::space, laya::keycode::escape,
+                              laya::keycode::exclaim, laya::keycode::f1, laya::keycode::f12,   laya::keycode::unknown,
+                              static_cast<laya::keycode>(0x20AC)};  // Euro sign, not in the flat tables
+
+        const auto check_against_sdl = [&] {
+            for (const auto key : keys) {
+                const auto expected = SDL_GetScancodeFromKey(static_cast<SDL_Keycode>(key), nullptr);
+                CHECK(static_cast<SDL_Scancode>(laya::keycode_to_scancode(key)) == expected);
+                // Second lookup is served from the cache
+                CHECK(static_cast<SDL_Scancode>(laya::keycode_to_scancode(key)) == expected);
+            }
+        };
+
+        check_against_sdl();
+
+        SDL_Event sdl_ev{};
+        sdl_ev.type = SDL_EVENT_KEYMAP_CHANGED;
+        const auto ev = laya::from_sdl_event(sdl_ev);
+        CHECK(std::holds_alternative<laya::keymap_changed_event>(ev));
+
+        SDL_Event round_trip{};
+        laya::to_sdl_event(ev, round_trip);
+        CHECK(round_trip.type == SDL_EVENT_KEYMAP_CHANGED);
+
+        check_against_sdl();
+    }
+}
@@ -0,0 +1,148 @@
+/// @file test_main_thread.cpp
+/// @brief Unit tests for running work on the main thread
+/// @date 2026-10-17
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+TEST_SUITE("unit") {
+    TEST_CASE("main_thread_queue runs tasks in push order") {
+        laya::main_thread_queue queue;
+        std::vector<int> order;
+
+        for (int i = 0; i < 5; ++i) {
+            queue.push([&order, i] { order.push_back(i); });
+        }
+        CHECK(queue.size() == 5);
+
+        CHECK(queue.drain() == 5);
+        CHECK(order == std::vector<int>{0, 1, 2, 3, 4});
+        CHECK(queue.empty());
+        CHECK(queue.drain() == 0);
+    }
+
+    TEST_CASE("main_thread_batch keeps its order between single pushes") {
+        laya::main_thread_queue queue;
+        std::vector<int> order;
+
+        queue.push([&order] { order.push_back(0); });
+
+        laya::main_thread_batch batch;
+        for (int i = 1; i < 4; ++i) {
+            batch.add([&order, i] { order.push_back(i); });
+        }
+        CHECK(batch.size() == 3);
+        queue.push(std::move(batch));
+        CHECK(batch.empty());
+
+        queue.push(laya::main_thread_batch{});
+        queue.push([&order] { order.push_back(4); });
+        CHECK(queue.size() == 5);
+
+        CHECK(queue.drain() == 5);
+        CHECK(order == std::vector<int>{0, 1, 2, 3, 4});
+    }
+
+    TEST_CASE("main_thread_batch destroys tasks that were never pushed") {
+        auto alive = std::make_shared<int>(0);
+        {
+            laya::main_thread_batch batch;
+            batch.add([alive] { ++*alive; });
+            laya::main_thread_batch moved{std::move(batch)};
+            CHECK(alive.use_count() == 2);
+        }
+        CHECK(alive.use_count() == 1);
+        CHECK(*alive == 0);
+    }
+
+    TEST_CASE("main_thread_queue collects tasks pushed from worker threads") {
+        constexpr int producers = 4;
+        constexpr int tasks_per_producer = 1000;
+
+        laya::main_thread_queue queue;
+        std::vector<std::vector<int>> seen(producers);
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&queue, &seen, p] {
+                for (int i = 0; i < tasks_per_producer; ++i) {
+                    // Tasks run on the draining thread, so writing to `seen` needs no lock
+                    queue.push([&seen, p, i] { seen[p].push_back(i); });
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        CHECK(queue.drain() == producers * tasks_per_producer);
+        for (const auto& values : seen) {
+            REQUIRE(values.size() == tasks_per_producer);
+            // Each producer's tasks keep their relative order
+            for (int i = 0; i < tasks_per_producer; ++i) {
+                CHECK(values[i] == i);
+            }
+        }
+    }
+
+    TEST_CASE("main_thread_queue respects the time budget") {
+        laya::main_thread_queue queue;
+        int ran = 0;
+        for (int i = 0; i < 3; ++i) {
+            queue.push([&ran] {
+                ++ran;
+                std::this_thread::sleep_for(std::chrono::milliseconds{2});
+            });
+        }
+
+        // A zero budget still runs one task so the queue makes progress
+        CHECK(queue.drain(std::chrono::nanoseconds{0}) == 1);
+        CHECK(ran == 1);
+        CHECK(queue.size() == 2);
+
+        // Tasks pushed later run after the leftovers
+        queue.push([&ran] { ran *= 10; });
+        CHECK(queue.drain() == 3);
+        CHECK(ran == 30);
+    }
+
+    TEST_CASE("main_thread_queue keeps remaining tasks when one throws") {
+        laya::main_thread_queue queue;
+        int ran = 0;
+        queue.push([] { throw std::runtime_error("upload failed"); });
+        queue.push([&ran] { ++ran; });
+
+        CHECK_THROWS_AS(queue.drain(), std::runtime_error);
+        CHECK(queue.size() == 1);
+        CHECK(queue.drain() == 1);
+        CHECK(ran == 1);
+    }
+
+    TEST_CASE("main_thread_queue destroys pending tasks without running them") {
+        auto payload = std::make_shared<int>(7);
+        bool ran = false;
+        {
+            laya::main_thread_queue queue;
+            queue.push([payload, &ran] { ran = *payload == 7; });
+            CHECK(payload.use_count() == 2);
+        }
+        CHECK_FALSE(ran);
+        CHECK(payload.use_count() == 1);
+    }
+
+    TEST_CASE("run_on_main_thread runs immediately on the main thread") {
+        laya::context ctx{laya::subsystem::video};
+        REQUIRE(laya::is_main_thread());
+
+        auto resource = std::make_unique<int>(3);
+        int value = 0;
+        laya::run_on_main_thread([&value, resource = std::move(resource)] { value = *resource; }, true);
+        CHECK(value == 3);
+    }
+}
@@ -0,0 +1,72 @@
+/// @file test_mouse_motion.cpp
+/// @brief Unit tests for sub-pixel mouse motion and its accumulation
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+SDL_Event make_motion(float x, float y, float xrel, float yrel) {
+    SDL_Event event{};
+    event.type = SDL_EVENT_MOUSE_MOTION;
+    event.motion.windowID = 1;
+    event.motion.x = x;
+    event.motion.y = y;
+    event.motion.xrel = xrel;
+    event.motion.yrel = yrel;
+    return event;
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("mouse motion events keep sub-pixel precision") {
+        const auto ev = laya::from_sdl_event(make_motion(10.75f, 20.25f, 0.5f, -0.25f));
+        REQUIRE(std::holds_alternative<laya::mouse_motion_event>(ev));
+
+        const auto& motion = std::get<laya::mouse_motion_event>(ev);
+        CHECK(motion.x == 10);
+        CHECK(motion.xrel == 0);
+        CHECK(motion.precise_x == doctest::Approx(10.75f));
+        CHECK(motion.precise_y == doctest::Approx(20.25f));
+        CHECK(motion.precise_xrel == doctest::Approx(0.5f));
+        CHECK(motion.precise_yrel == doctest::Approx(-0.25f));
+
+        SDL_Event round_trip{};
+        laya::to_sdl_event(ev, round_trip);
+        CHECK(round_trip.motion.x == doctest::Approx(10.75f));
+        CHECK(round_trip.motion.yrel == doctest::Approx(-0.25f));
+    }
+
+    TEST_CASE("mouse_motion_accumulator integrates fractional motion") {
+        laya::mouse_motion_accumulator accumulator;
+
+        // A high-rate mouse reporting motion too small to survive int truncation
+        for (int i = 0; i < 1000; ++i) {
+            CHECK(accumulator.add(laya::from_sdl_event(make_motion(0.0f, 0.0f, 0.1f, -0.05f))));
+        }
+        CHECK_FALSE(accumulator.add(laya::event{laya::quit_event{0}}));
+        CHECK(accumulator.sample_count() == 1000);
+
+        const auto total = accumulator.take();
+        CHECK(total.x == doctest::Approx(100.0f));
+        CHECK(total.y == doctest::Approx(-50.0f));
+        CHECK(accumulator.sample_count() == 0);
+        CHECK(accumulator.delta() == laya::point_f{});
+    }
+
+    TEST_CASE("mouse_motion_accumulator carries sub-pixel remainders") {
+        laya::mouse_motion_accumulator accumulator;
+
+        accumulator.add(0.6f, -0.6f);
+        CHECK(accumulator.take_pixels() == laya::point{0, 0});
+
+        accumulator.add(0.6f, -0.6f);
+        CHECK(accumulator.take_pixels() == laya::point{1, -1});
+        CHECK(accumulator.delta().x == doctest::Approx(0.2f));
+
+        accumulator.reset();
+        CHECK(accumulator.delta() == laya::point_f{});
+    }
+}
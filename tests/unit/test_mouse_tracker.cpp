@@ -0,0 +1,65 @@
+/// @file test_mouse_tracker.cpp
+/// @brief Unit tests for window-relative mouse tracking
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+
+namespace {
+
+laya::event make_window_event(laya::window_id id, laya::window_event_type type, laya::window_event_data data) {
+    return laya::window_event{0, id, type, data};
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("mouse_tracker computes positions for every window from one global position") {
+        const laya::window_id left{1};
+        const laya::window_id right{2};
+
+        laya::mouse_tracker tracker;
+        CHECK(tracker.global_position() == laya::point_f{});
+
+        tracker.track(left, {0, 0}, {800, 600});
+        tracker.track(right, {800, 0}, {400, 300});
+        CHECK(tracker.size() == 2);
+
+        tracker.update(laya::point_f{900.5f, 100.25f});
+        CHECK(tracker.global_position() == laya::point_f{900.5f, 100.25f});
+
+        REQUIRE(tracker.position(left).has_value());
+        CHECK(*tracker.position(left) == laya::point_f{900.5f, 100.25f});
+        CHECK_FALSE(tracker.is_inside(left));
+
+        REQUIRE(tracker.position(right).has_value());
+        CHECK(*tracker.position(right) == laya::point_f{100.5f, 100.25f});
+        CHECK(tracker.is_inside(right));
+
+        CHECK_FALSE(tracker.position(laya::window_id{3}).has_value());
+    }
+
+    TEST_CASE("mouse_tracker follows moved and resized events") {
+        const laya::window_id id{7};
+
+        laya::mouse_tracker tracker;
+        tracker.track(id, {100, 100}, {200, 200});
+
+        tracker.handle(make_window_event(id, laya::window_event_type::moved, laya::window_event_data_position{50, 60}));
+        tracker.handle(make_window_event(id, laya::window_event_type::resized, laya::window_event_data_size{20, 20}));
+        // Pixel sizes are ignored, they are not in the mouse's coordinate space
+        tracker.handle(
+            make_window_event(id, laya::window_event_type::size_changed, laya::window_event_data_size{40, 40}));
+        tracker.handle(laya::event{laya::quit_event{0}});
+
+        tracker.update(laya::point_f{75.0f, 70.0f});
+        CHECK(*tracker.position(id) == laya::point_f{25.0f, 10.0f});
+        CHECK_FALSE(tracker.is_inside(id));
+
+        tracker.update(laya::point_f{60.0f, 70.0f});
+        CHECK(tracker.is_inside(id));
+
+        CHECK(tracker.untrack(id));
+        CHECK_FALSE(tracker.untrack(id));
+        CHECK(tracker.size() == 0);
+    }
+}
@@ -2,8 +2,12 @@
 /// @brief Unit tests for renderer functionality
 /// @date 2025-10-07
 
+#include <algorithm>
+#include <string_view>
+
 #include <doctest/doctest.h>
 #include <laya/laya.hpp>
+#include <SDL3/SDL.h>
 
 TEST_SUITE("renderer") {
     TEST_CASE("renderer types") {
@@ -134,6 +138,63 @@ TEST_SUITE("renderer") {
         CHECK(id2 == laya::renderer_id{42});
     }
 
+    TEST_CASE("renderer_args defaults") {
+        const laya::renderer_args args;
+        CHECK(args.flags == laya::renderer_flags::accelerated);
+        CHECK(args.vsync == laya::vsync_mode::enabled);
+        CHECK(args.driver.empty());
+        CHECK(args.lines == laya::line_method::automatic);
+        CHECK(args.vsync_interval == 1);
+
+        // Values match SDL_HINT_RENDER_LINE_METHOD
+        CHECK(static_cast<int>(laya::line_method::points) == 1);
+        CHECK(static_cast<int>(laya::line_method::lines) == 2);
+        CHECK(static_cast<int>(laya::line_method::geometry) == 3);
+    }
+
+    TEST_CASE("renderer created from a named driver") {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        laya::context ctx{laya::subsystem::video};
+        laya::window win{"Driver Window", {64, 48}};
+
+        const auto drivers = laya::available_render_drivers();
+        REQUIRE(std::find(drivers.begin(), drivers.end(), "software") != drivers.end());
+
+        laya::renderer rend{win, laya::renderer_args{.vsync = laya::vsync_mode::disabled,
+                                                     .driver = "software",
+                                                     .lines = laya::line_method::geometry}};
+        CHECK(rend.driver_name() == "software");
+        rend.draw_line({0, 0}, {63, 47});
+        rend.flush();
+
+        // The line method hint only applies while the renderer is created
+        CHECK(SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD) == nullptr);
+
+        CHECK_FALSE(laya::renderer::try_create(win, laya::renderer_args{.driver = "no-such-driver"}).has_value());
+    }
+
+    TEST_CASE("automatic line method leaves the hint untouched") {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        laya::context ctx{laya::subsystem::video};
+        laya::window win{"Line Hint Window", {64, 48}};
+
+        SDL_SetHint(SDL_HINT_RENDER_LINE_METHOD, "2");
+        {
+            laya::renderer rend{win, laya::renderer_args{.vsync = laya::vsync_mode::disabled, .driver = "software"}};
+            REQUIRE(SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD) != nullptr);
+            CHECK(std::string_view{SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD)} == "2");
+        }
+        {
+            // An explicit method overrides the hint only while the renderer is created
+            laya::renderer rend{win, laya::renderer_args{.vsync = laya::vsync_mode::disabled,
+                                                         .driver = "software",
+                                                         .lines = laya::line_method::points}};
+            REQUIRE(SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD) != nullptr);
+            CHECK(std::string_view{SDL_GetHint(SDL_HINT_RENDER_LINE_METHOD)} == "2");
+        }
+        SDL_ResetHint(SDL_HINT_RENDER_LINE_METHOD);
+    }
+
     // Note: Full renderer functionality tests would require SDL initialization
     // and window creation, which is more complex for unit tests.
     // Integration tests would be better suited for testing actual rendering.
@@ -0,0 +1,106 @@
+/// @file test_result.cpp
+/// @brief Unit tests for laya::result and the non-throwing wrapper operations
+/// @date 2026-10-17
+
+#include <string>
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+TEST_SUITE("unit") {
+    TEST_CASE("result holds a value or an error") {
+        laya::result<int> ok{42};
+        REQUIRE(ok.has_value());
+        CHECK(static_cast<bool>(ok));
+        CHECK(*ok == 42);
+        CHECK(ok.value() == 42);
+        CHECK(ok.value_or(7) == 42);
+
+        laya::result<int> failed{laya::error_info{laya::error_code::invalid_argument, "Bad input", "negative size"}};
+        REQUIRE_FALSE(failed.has_value());
+        CHECK(failed.value_or(7) == 7);
+        CHECK(failed.error().code() == laya::error_code::invalid_argument);
+        CHECK(failed.error().message() == "Bad input: negative size");
+        CHECK_THROWS_AS((void)failed.value(), laya::error);
+
+        laya::result<void> done;
+        CHECK(done.has_value());
+        CHECK_NOTHROW(done.value());
+
+        laya::result<void> not_done{laya::error_info{laya::error_code::unsupported, "Not available"}};
+        CHECK_FALSE(not_done.has_value());
+        CHECK(not_done.error().message() == "Not available");
+        CHECK_THROWS_AS(not_done.value(), laya::error);
+    }
+
+    TEST_CASE("error_info keeps the failure site and formats on demand") {
+        SDL_SetError("device lost");
+        const auto info = laya::error_info::from_sdl("Failed to present renderer");
+
+        CHECK(info.code() == laya::error_code::sdl);
+        CHECK(info.detail() == "device lost");
+        CHECK(std::string{info.location().file_name()}.find("test_result.cpp") != std::string::npos);
+
+        // SDL's message is copied, later SDL errors do not change it
+        SDL_SetError("something else");
+        CHECK(info.message() == "Failed to present renderer: device lost");
+
+        const std::string what = info.to_error().what();
+        CHECK(what.find("test_result.cpp") != std::string::npos);
+        CHECK(what.find("Failed to present renderer: device lost") != std::string::npos);
+    }
+
+    TEST_CASE("surface try_ operations report failures without throwing") {
+        laya::context ctx{laya::subsystem::video};
+
+        auto created = laya::surface::try_create(laya::surface_args{.size = {32, 32}});
+        REQUIRE(created.has_value());
+        CHECK(created->size().width == 32);
+        CHECK(created->try_fill(laya::colors::white).has_value());
+        CHECK(created->try_fill_rect({4, 4, 8, 8}, laya::colors::black).has_value());
+
+        auto unsupported = laya::surface::try_create(
+            laya::surface_args{.size = {32, 32}, .flags = laya::surface_flags::preallocated});
+        REQUIRE_FALSE(unsupported.has_value());
+        CHECK(unsupported.error().code() == laya::error_code::unsupported);
+
+        // The throwing API reports the same failure as laya::error
+        CHECK_THROWS_AS(laya::surface(laya::surface_args{.size = {32, 32}, .flags = laya::surface_flags::preallocated}),
+                        laya::error);
+    }
+
+    TEST_CASE("window and renderer try_ operations") {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        laya::context ctx{laya::subsystem::video};
+
+        auto win = laya::window::try_create(laya::window_args{"Result Window", {64, 48}, std::nullopt});
+        REQUIRE(win.has_value());
+        CHECK(win->try_set_title("Renamed").has_value());
+        CHECK(win->try_set_size({80, 60}).has_value());
+
+        auto rend = laya::renderer::try_create(*win, laya::renderer_args{laya::renderer_flags::software});
+        REQUIRE(rend.has_value());
+        CHECK(rend->try_set_draw_color(laya::colors::black).has_value());
+        CHECK(rend->try_clear().has_value());
+        CHECK(rend->try_fill_rect({0, 0, 8, 8}).has_value());
+
+        auto tex = laya::texture::try_create(
+            *rend, laya::texture_args{laya::pixel_format::rgba32, {8, 8}, laya::texture_access::streaming});
+        REQUIRE(tex.has_value());
+        {
+            auto lock = tex->try_lock();
+            REQUIRE(lock.has_value());
+            CHECK(lock->pixels() != nullptr);
+        }
+        CHECK(rend->try_render(*tex, laya::point{0, 0}).has_value());
+        CHECK(rend->try_present().has_value());
+
+        // A moved-from window reports an invalid handle instead of throwing
+        laya::window moved = std::move(*win);
+        CHECK(moved.is_valid());
+        auto shown = win->try_show();
+        REQUIRE_FALSE(shown.has_value());
+        CHECK(shown.error().code() == laya::error_code::invalid_handle);
+    }
+}
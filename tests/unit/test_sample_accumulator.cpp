@@ -0,0 +1,136 @@
+/// @file test_sample_accumulator.cpp
+/// @brief Unit tests for sensor/pen events and the sample accumulator
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+laya::pen_motion_event make_pen_motion(std::uint32_t pen, float x) {
+    laya::pen_motion_event ev{};
+    ev.which = pen;
+    ev.x = x;
+    return ev;
+}
+
+}  // namespace
+
+TEST_SUITE("unit") {
+    TEST_CASE("sensor and pen events convert from SDL") {
+        SDL_Event sensor{};
+        sensor.type = SDL_EVENT_SENSOR_UPDATE;
+        sensor.sensor.which = 4;
+        sensor.sensor.data[2] = 9.81f;
+        sensor.sensor.sensor_timestamp = 1234;
+
+        const auto converted_sensor = laya::from_sdl_event(sensor);
+        REQUIRE(std::holds_alternative<laya::sensor_event>(converted_sensor));
+        CHECK(std::get<laya::sensor_event>(converted_sensor).which == 4);
+        CHECK(std::get<laya::sensor_event>(converted_sensor).data[2] == doctest::Approx(9.81f));
+        CHECK(std::get<laya::sensor_event>(converted_sensor).sensor_timestamp == 1234);
+
+        SDL_Event axis{};
+        axis.type = SDL_EVENT_PEN_AXIS;
+        axis.paxis.which = 2;
+        axis.paxis.axis = SDL_PEN_AXIS_PRESSURE;
+        axis.paxis.value = 0.5f;
+
+        const auto converted_axis = laya::from_sdl_event(axis);
+        REQUIRE(std::holds_alternative<laya::pen_axis_event>(converted_axis));
+        CHECK(std::get<laya::pen_axis_event>(converted_axis).axis == laya::pen_axis::pressure);
+        CHECK(std::get<laya::pen_axis_event>(converted_axis).value == doctest::Approx(0.5f));
+
+        SDL_Event touch{};
+        touch.type = SDL_EVENT_PEN_DOWN;
+        touch.ptouch.eraser = true;
+        touch.ptouch.down = true;
+
+        const auto converted_touch = laya::from_sdl_event(touch);
+        REQUIRE(std::holds_alternative<laya::pen_touch_event>(converted_touch));
+        CHECK(std::get<laya::pen_touch_event>(converted_touch).eraser);
+        CHECK(std::get<laya::pen_touch_event>(converted_touch).touch_state == laya::pen_touch_event::state::down);
+    }
+
+    TEST_CASE("sample_ring overwrites the oldest samples") {
+        laya::sample_ring<int> ring{4};
+        for (int i = 0; i < 6; ++i) {
+            ring.push(i);
+        }
+
+        CHECK(ring.size() == 4);
+        CHECK(ring.dropped() == 2);
+
+        const auto view = ring.view();
+        REQUIRE(view.size() == 4);
+        CHECK(view.first.size() == 2);
+        CHECK(view.second.size() == 2);
+        CHECK(view[0] == 2);
+        CHECK(view[3] == 5);
+        CHECK(view.back() == 5);
+
+        ring.clear();
+        CHECK(ring.view().empty());
+        CHECK(ring.dropped() == 0);
+    }
+
+    TEST_CASE("sample_accumulator keeps samples per device") {
+        laya::sample_accumulator accumulator{8};
+
+        CHECK(accumulator.add(make_pen_motion(1, 10.0f)));
+        CHECK(accumulator.add(make_pen_motion(2, 20.0f)));
+        CHECK(accumulator.add(make_pen_motion(1, 11.0f)));
+        CHECK_FALSE(accumulator.add(laya::quit_event{}));
+
+        const auto pens = accumulator.devices<laya::pen_motion_event>();
+        REQUIRE(pens.size() == 2);
+
+        const auto pen1 = accumulator.samples<laya::pen_motion_event>(1);
+        REQUIRE(pen1.size() == 2);
+        CHECK(pen1[0].x == doctest::Approx(10.0f));
+        CHECK(pen1.back().x == doctest::Approx(11.0f));
+
+        CHECK(accumulator.samples<laya::pen_motion_event>(3).empty());
+        CHECK(accumulator.samples<laya::sensor_event>(1).empty());
+
+        accumulator.clear();
+        CHECK(accumulator.samples<laya::pen_motion_event>(1).empty());
+        CHECK(accumulator.devices<laya::pen_motion_event>().size() == 2);
+    }
+
+    TEST_CASE("sample_accumulator drains only high-rate events from the queue") {
+        laya::context ctx(laya::subsystem::video);
+        laya::flush_events();
+
+        for (int i = 0; i < 20; ++i) {
+            SDL_Event motion{};
+            motion.type = SDL_EVENT_PEN_MOTION;
+            motion.pmotion.which = 1;
+            motion.pmotion.x = static_cast<float>(i);
+            REQUIRE(SDL_PushEvent(&motion));
+        }
+
+        SDL_Event touch{};
+        touch.type = SDL_EVENT_PEN_DOWN;
+        touch.ptouch.which = 1;
+        touch.ptouch.down = true;
+        REQUIRE(SDL_PushEvent(&touch));
+
+        laya::sample_accumulator accumulator{16};
+        CHECK(accumulator.collect() == 20);
+        CHECK(accumulator.dropped() == 4);
+
+        const auto samples = accumulator.samples<laya::pen_motion_event>(1);
+        REQUIRE(samples.size() == 16);
+        CHECK(samples[0].x == doctest::Approx(4.0f));
+        CHECK(samples.back().x == doctest::Approx(19.0f));
+
+        // The discrete pen event is left for the main event stream
+        std::size_t remaining = 0;
+        for (const auto& ev : laya::events_view()) {
+            CHECK(std::holds_alternative<laya::pen_touch_event>(ev));
+            ++remaining;
+        }
+        CHECK(remaining == 1);
+    }
+}
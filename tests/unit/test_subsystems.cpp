@@ -2,10 +2,26 @@
 /// @brief Unit tests for laya subsystem initialization
 /// @date 2025-10-01
 
+#include <cstdint>
 #include <iostream>
 
 #include <doctest/doctest.h>
 #include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+/// Number of SDL_InitSubSystem calls laya made for a single subsystem
+std::uint32_t init_count(laya::subsystem system) {
+    for (const auto& t : laya::subsystem_timings()) {
+        if (t.system == system) {
+            return t.init_count;
+        }
+    }
+    return 0;
+}
+
+}  // namespace
 
 TEST_SUITE("unit") {
     TEST_CASE("context initialization with video subsystem") {
@@ -36,4 +52,60 @@ TEST_SUITE("unit") {
             laya::context ctx2(laya::subsystem::video);
         }
     }
+
+    TEST_CASE("subsystems are reference counted") {
+        const auto before = init_count(laya::subsystem::events);
+        {
+            laya::context outer(laya::subsystem::events);
+            const auto after_outer = init_count(laya::subsystem::events);
+            CHECK(after_outer == before + 1);
+            {
+                laya::context inner(laya::subsystem::events);
+            }
+            // The inner context neither initialized events again nor shut them down
+            CHECK(init_count(laya::subsystem::events) == after_outer);
+            CHECK(SDL_WasInit(SDL_INIT_EVENTS) != 0);
+        }
+
+        // A new context after the last one went away initializes again
+        laya::context again(laya::subsystem::events);
+        CHECK(init_count(laya::subsystem::events) == before + 2);
+    }
+
+    TEST_CASE("context defers subsystems to first use") {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        const auto video_before = init_count(laya::subsystem::video);
+        const auto audio_before = init_count(laya::subsystem::audio);
+        {
+            laya::context ctx(laya::context_args{.init = laya::subsystem::events,
+                                                 .on_first_use = laya::subsystem::video | laya::subsystem::audio});
+            CHECK(SDL_WasInit(SDL_INIT_VIDEO) == 0);
+            CHECK(init_count(laya::subsystem::video) == video_before);
+
+            // Creating a window is the first use of video, audio is never used
+            laya::window win("Lazy Window", {64, 48});
+            CHECK(SDL_WasInit(SDL_INIT_VIDEO) != 0);
+            CHECK(SDL_WasInit(SDL_INIT_AUDIO) == 0);
+            CHECK(init_count(laya::subsystem::video) == video_before + 1);
+            CHECK(init_count(laya::subsystem::audio) == audio_before);
+        }
+        CHECK(SDL_WasInit(SDL_INIT_VIDEO) == 0);
+    }
+
+    TEST_CASE("subsystem_timings keeps the first initialization of each subsystem") {
+        {
+            laya::context first(laya::subsystem::events);
+        }
+        laya::context second(laya::subsystem::events);
+
+        std::size_t entries = 0;
+        for (const auto& t : laya::subsystem_timings()) {
+            if (t.system == laya::subsystem::events) {
+                ++entries;
+                CHECK(t.init_count >= 2);
+                CHECK(laya::subsystem_name(t.system) == "events");
+            }
+        }
+        CHECK(entries == 1);
+    }
 }  // TEST_SUITE("unit")
@@ -2,6 +2,8 @@
 /// @brief Unit tests for window wrapper
 /// @date 2025-12-12
 
+#include <array>
+
 #include <doctest/doctest.h>
 #include <laya/laya.hpp>
 #include <SDL3/SDL.h>
@@ -57,4 +59,87 @@ TEST_SUITE("window") {
         CHECK_THROWS_AS(first.show(), laya::error);
         CHECK_THROWS_AS(first.set_size({100, 100}), laya::error);
     }
+
+    TEST_CASE("state cache follows window events") {
+        set_headless_video_driver();
+        laya::context ctx(laya::subsystem::video);
+
+        laya::window win(laya::window_args{"Cached Window", {320, 240}, std::nullopt, laya::window_flags::none,
+                                           laya::window_state_cache::events});
+        CHECK(win.state_cache() == laya::window_state_cache::events);
+        CHECK(win.get_size().width == 320);
+
+        const laya::window_event resized{0, win.id(), laya::window_event_type::resized,
+                                         laya::window_event_data_size{640, 480}};
+        CHECK(win.handle(resized));
+        CHECK(win.get_size().width == 640);
+        CHECK(win.get_size().height == 480);
+
+        const laya::window_event moved{0, win.id(), laya::window_event_type::moved,
+                                       laya::window_event_data_position{12, 34}};
+        CHECK(win.handle(moved));
+        CHECK(win.get_position().x == 12);
+        CHECK(win.get_position().y == 34);
+
+        CHECK(win.handle(laya::window_event{0, win.id(), laya::window_event_type::minimized, {}}));
+        CHECK(win.state().minimized);
+
+        // Events for other windows are ignored
+        const laya::window_event other{0, laya::window_id{win.id().value() + 1}, laya::window_event_type::resized,
+                                       laya::window_event_data_size{1, 1}};
+        CHECK_FALSE(win.handle(other));
+        CHECK(win.get_size().width == 640);
+
+        // Setters without events refresh the cache themselves
+        win.set_minimum_size({100, 80});
+        CHECK(win.get_minimum_size().width == 100);
+
+        // Checked and uncached reads come from SDL
+        win.set_state_cache(laya::window_state_cache::checked);
+        CHECK(win.get_size().width == 320);
+        win.set_state_cache(laya::window_state_cache::none);
+        CHECK_FALSE(win.handle(resized));
+        CHECK(win.get_size().width == 320);
+    }
+
+    TEST_CASE("state cache is refreshed by setters") {
+        set_headless_video_driver();
+        laya::context ctx(laya::subsystem::video);
+
+        laya::window win(laya::window_args{"Cached Window", {320, 240}, std::nullopt, laya::window_flags::none,
+                                           laya::window_state_cache::events});
+
+        // No event is passed to handle(), the cache must still match what SDL reports
+        win.set_size({400, 300});
+        int w = 0, h = 0;
+        REQUIRE(SDL_GetWindowSize(win.native_handle(), &w, &h));
+        CHECK(win.get_size().width == w);
+        CHECK(win.get_size().height == h);
+
+        win.set_position({40, 50});
+        int x = 0, y = 0;
+        REQUIRE(SDL_GetWindowPosition(win.native_handle(), &x, &y));
+        CHECK(win.get_position().x == x);
+        CHECK(win.get_position().y == y);
+    }
+
+    TEST_CASE("window surface presents dirty rects") {
+        set_headless_video_driver();
+        laya::context ctx(laya::subsystem::video);
+
+        laya::window win("Surface Window", {64, 48});
+        {
+            auto surf = win.surface();
+            CHECK_FALSE(surf.owns_handle());
+            CHECK(surf.size().width == 64);
+            CHECK(surf.size().height == 48);
+            CHECK_NOTHROW(surf.fill(laya::colors::red));
+        }
+
+        // The borrowed surface must not have destroyed the window's framebuffer
+        const std::array dirty{laya::rect{0, 0, 8, 8}, laya::rect{16, 16, 8, 8}};
+        CHECK_NOTHROW(win.update_surface_rects(dirty));
+        CHECK_NOTHROW(win.update_surface_rects({}));
+        CHECK_NOTHROW(win.update_surface());
+    }
 }
@@ -0,0 +1,88 @@
+/// @file test_window_registry.cpp
+/// @brief Unit tests for the window registry
+
+#include <doctest/doctest.h>
+#include <laya/laya.hpp>
+#include <SDL3/SDL.h>
+
+namespace {
+
+void set_headless_video_driver() {
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+}
+
+laya::window_args tool_window(std::string_view title) {
+    return laya::window_args{title, {160, 120}, std::nullopt, laya::window_flags::hidden,
+                             laya::window_state_cache::events};
+}
+
+}  // namespace
+
+TEST_SUITE("window") {
+    TEST_CASE("window_registry looks windows up by handle and id") {
+        set_headless_video_driver();
+        laya::context ctx(laya::subsystem::video);
+
+        laya::window_registry registry;
+        const auto first = registry.create(tool_window("first"));
+        const auto second = registry.create(tool_window("second"));
+        CHECK(registry.size() == 2);
+        CHECK(first != second);
+
+        laya::window* win = registry.get(second);
+        REQUIRE(win != nullptr);
+        CHECK(registry.find(win->id()) == second);
+        CHECK(registry.get(win->id()) == win);
+        CHECK(registry.get_renderer(second) == nullptr);
+
+        // Destroying a window makes its handle stale, even once the slot is reused
+        const auto second_id = win->id();
+        CHECK(registry.destroy(second));
+        CHECK_FALSE(registry.destroy(second));
+        CHECK_FALSE(registry.contains(second));
+        CHECK(registry.get(second_id) == nullptr);
+        CHECK_FALSE(registry.find(second_id).is_valid());
+
+        const auto third = registry.create(tool_window("third"));
+        CHECK(third.index == second.index);
+        CHECK(registry.get(second) == nullptr);
+        CHECK(registry.get(third) != nullptr);
+        CHECK(registry.contains(first));
+    }
+
+    TEST_CASE("window_registry routes events and batches renderer calls") {
+        set_headless_video_driver();
+        laya::context ctx(laya::subsystem::video);
+
+        laya::window_registry registry;
+        const laya::renderer_args software{laya::renderer_flags::software, laya::vsync_mode::disabled};
+        const auto a = registry.create(tool_window("a"), software);
+        const auto b = registry.create(tool_window("b"), software);
+        registry.insert(laya::window{tool_window("no renderer")});
+        CHECK(registry.size() == 3);
+        CHECK(registry.get_renderer(a) != nullptr);
+
+        const laya::event resized =
+            laya::window_event{0, registry.get(b)->id(), laya::window_event_type::resized,
+                               laya::window_event_data_size{300, 200}};
+        CHECK(registry.handle(resized));
+        CHECK(registry.get(b)->get_size().width == 300);
+        CHECK_FALSE(registry.handle(laya::quit_event{0}));
+
+        CHECK_NOTHROW(registry.show_all());
+        CHECK_NOTHROW(registry.clear_all());
+        CHECK_NOTHROW(registry.present_all());
+        CHECK_NOTHROW(registry.hide_all());
+
+        int with_renderer = 0;
+        registry.for_each([&](laya::window_handle, laya::window&, laya::renderer* rend) {
+            with_renderer += rend ? 1 : 0;
+        });
+        CHECK(with_renderer == 2);
+
+        registry.clear();
+        CHECK(registry.empty());
+        CHECK_FALSE(registry.contains(a));
+    }
+}